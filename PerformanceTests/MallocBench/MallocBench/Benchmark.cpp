@@ -35,11 +35,13 @@
 #include "medium.h"
 #include "memalign.h"
 #include "message.h"
+#include "phase_churn.h"
 #include "reddit.h"
 #include "realloc.h"
 #include "stress.h"
 #include "stress_aligned.h"
 #include "theverge.h"
+#include "trace_replay.h"
 #include "tree.h"
 #include <dispatch/dispatch.h>
 #include <iostream>
@@ -75,6 +77,7 @@ static const BenchmarkPair benchmarkPairs[] = {
     { "memalign", benchmark_memalign },
     { "message_many", benchmark_message_many },
     { "message_one", benchmark_message_one },
+    { "phase_churn", benchmark_phase_churn },
     { "realloc", benchmark_realloc },
     { "reddit", benchmark_reddit },
     { "reddit_memory_warning", benchmark_reddit_memory_warning },
@@ -82,6 +85,7 @@ static const BenchmarkPair benchmarkPairs[] = {
     { "stress_aligned", benchmark_stress_aligned },
     { "theverge", benchmark_theverge },
     { "theverge_memory_warning", benchmark_theverge_memory_warning },
+    { "trace_replay", benchmark_trace_replay },
     { "tree_allocate", benchmark_tree_allocate },
     { "tree_churn", benchmark_tree_churn },
     { "tree_traverse", benchmark_tree_traverse },
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "CPUCount.h"
+#include "phase_churn.h"
+#include <cstddef>
+#include <vector>
+
+#include "mbmalloc.h"
+
+using namespace std;
+
+// Emulates a process whose size-class mix shifts over time, like a WebContent
+// process navigating from a JS-heavy page (lots of tiny cells) to an image-heavy
+// page (larger pixel row buffers). An adaptive per-thread cache should return the
+// previous phase's cached ranges to the heap instead of holding them for the rest
+// of the run.
+void benchmark_phase_churn(bool isParallel)
+{
+    size_t phases = 40;
+    size_t objectsPerPhase = 50000;
+    if (isParallel)
+        objectsPerPhase /= cpuCount();
+
+    static const size_t phaseObjectSizes[] = { 16, 48, 256, 1024, 4096 };
+    static const size_t phaseObjectSizeCount = sizeof(phaseObjectSizes) / sizeof(phaseObjectSizes[0]);
+
+    vector<void*> objects(objectsPerPhase);
+    vector<void*> survivors;
+    size_t survivorSize = 0;
+
+    for (size_t phase = 0; phase < phases; ++phase) {
+        size_t size = phaseObjectSizes[phase % phaseObjectSizeCount];
+
+        for (size_t i = 0; i < objectsPerPhase; ++i)
+            objects[i] = mbmalloc(size);
+
+        // Holding a sparse survivor set across the phase boundary keeps pages
+        // partially referenced, so memory can only come back through the
+        // allocator's own cache policy rather than whole-page reclamation.
+        for (size_t i = 0; i < survivors.size(); ++i)
+            mbfree(survivors[i], survivorSize);
+        survivors.clear();
+
+        for (size_t i = 0; i < objectsPerPhase; ++i) {
+            if (i % 64)
+                mbfree(objects[i], size);
+            else
+                survivors.push_back(objects[i]);
+        }
+        survivorSize = size;
+    }
+
+    for (size_t i = 0; i < survivors.size(); ++i)
+        mbfree(survivors[i], survivorSize);
+}
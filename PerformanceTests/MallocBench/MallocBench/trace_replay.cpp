@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "trace_replay.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mbmalloc.h"
+
+// Replays an allocation trace captured by a bmalloc build with
+// BENABLE_ALLOCATION_TRACE (see Source/bmalloc/bmalloc/AllocationTrace.h).
+// The trace file is named by the MALLOC_BENCH_TRACE_FILE environment
+// variable; each line is "a <pointer> <size>" or "d <pointer>".
+
+struct TraceOperation {
+    bool isAllocate;
+    size_t slot;
+    size_t size;
+};
+
+struct ParsedTrace {
+    std::vector<TraceOperation> operations;
+    size_t slotCount;
+};
+
+static ParsedTrace parseTrace(const char* path)
+{
+    ParsedTrace trace;
+    trace.slotCount = 0;
+
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Failed to open trace file: %s\n", path);
+        exit(1);
+    }
+
+    // Maps the pointers the traced process saw onto dense slot indices; a
+    // pointer is recycled by the traced allocator as soon as it's freed, so
+    // the live mapping is dropped on deallocation.
+    std::unordered_map<unsigned long long, size_t> liveSlots;
+    std::unordered_map<unsigned long long, size_t> liveSizes;
+
+    char line[128];
+    while (fgets(line, sizeof(line), file)) {
+        unsigned long long pointer;
+        unsigned long size;
+        if (sscanf(line, "a %llx %lu", &pointer, &size) == 2) {
+            size_t slot = trace.slotCount++;
+            liveSlots[pointer] = slot;
+            liveSizes[pointer] = size;
+            trace.operations.push_back({ true, slot, size });
+            continue;
+        }
+        if (sscanf(line, "d %llx", &pointer) == 1) {
+            auto it = liveSlots.find(pointer);
+            if (it == liveSlots.end())
+                continue; // Freed object allocated before tracing began.
+            trace.operations.push_back({ false, it->second, liveSizes[pointer] });
+            liveSlots.erase(it);
+            liveSizes.erase(pointer);
+        }
+    }
+
+    fclose(file);
+
+    if (trace.operations.empty()) {
+        fprintf(stderr, "Trace file contains no operations: %s\n", path);
+        exit(1);
+    }
+
+    return trace;
+}
+
+static const ParsedTrace& cachedTrace()
+{
+    static ParsedTrace* trace = nullptr;
+    if (!trace) {
+        const char* path = getenv("MALLOC_BENCH_TRACE_FILE");
+        if (!path) {
+            fprintf(stderr, "trace_replay requires MALLOC_BENCH_TRACE_FILE to name a bmalloc allocation trace.\n");
+            exit(1);
+        }
+        trace = new ParsedTrace(parseTrace(path));
+    }
+    return *trace;
+}
+
+void benchmark_trace_replay(bool isParallel)
+{
+    (void)isParallel; // Traces record a single process's order of operations.
+
+    const ParsedTrace& trace = cachedTrace();
+
+    std::vector<void*> slots(trace.slotCount, nullptr);
+    std::vector<size_t> sizes(trace.slotCount, 0);
+
+    for (const TraceOperation& operation : trace.operations) {
+        if (operation.isAllocate) {
+            void* object = mbmalloc(operation.size);
+            // Touch the object the way real code would before the allocator
+            // sees it again.
+            memset(object, 0x42, operation.size < 128 ? operation.size : 128);
+            slots[operation.slot] = object;
+            sizes[operation.slot] = operation.size;
+        } else {
+            mbfree(slots[operation.slot], sizes[operation.slot]);
+            slots[operation.slot] = nullptr;
+        }
+    }
+
+    // Objects still live at the end of the trace died with the traced process.
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        if (slots[slot])
+            mbfree(slots[slot], sizes[slot]);
+    }
+
+    mbscavenge();
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+
+#include "HashTableBenchmark.h"
+#include "SelectorMatchingBenchmark.h"
+#include "StyleRecalcBenchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sys/time.h>
+
+using namespace std;
+
+struct BenchmarkPair {
+    const char* const name;
+    const BenchmarkFunction function;
+};
+
+static const BenchmarkPair benchmarkPairs[] = {
+    { "hash_table_probe_hit", benchmark_hash_table_probe_hit },
+    { "hash_table_probe_miss", benchmark_hash_table_probe_miss },
+    { "hash_table_probe_mixed", benchmark_hash_table_probe_mixed },
+    { "selector_matching", benchmark_selector_matching },
+    { "style_recalc", benchmark_style_recalc },
+};
+
+static const size_t benchmarksPairsCount = sizeof(benchmarkPairs) / sizeof(BenchmarkPair);
+
+static inline bool operator==(const BenchmarkPair& benchmarkPair, const string& string)
+{
+    return string == benchmarkPair.name;
+}
+
+Benchmark::Benchmark(const string& benchmarkName, size_t runs)
+    : m_benchmarkPair()
+    , m_runs(runs)
+{
+    const BenchmarkPair* benchmarkPair = std::find(
+        benchmarkPairs, benchmarkPairs + benchmarksPairsCount, benchmarkName);
+    if (benchmarkPair == benchmarkPairs + benchmarksPairsCount)
+        return;
+
+    m_benchmarkPair = benchmarkPair;
+}
+
+void Benchmark::printBenchmarks()
+{
+    cout << "Benchmarks: " << endl;
+    for (size_t i = 0; i < benchmarksPairsCount; ++i)
+        cout << "\t" << benchmarkPairs[i].name << endl;
+}
+
+void Benchmark::runOnce()
+{
+    m_benchmarkPair->function();
+}
+
+void Benchmark::run()
+{
+    double warmUpStart = currentTimeMS();
+    runOnce(); // Warmup run.
+    double warmUpEnd = currentTimeMS();
+    cout << "Ignoring warm-up run (" << warmUpEnd - warmUpStart << ")" << endl;
+
+    for (size_t i = 0; i < m_runs; ++i) {
+        double start = currentTimeMS();
+        runOnce();
+        double end = currentTimeMS();
+        m_elapsedTimes.push_back(end - start);
+    }
+}
+
+void Benchmark::printReport()
+{
+    vector<double> sortedTimes = m_elapsedTimes;
+    sort(sortedTimes.begin(), sortedTimes.end());
+
+    double sum = 0;
+    for (double time : m_elapsedTimes)
+        sum += time;
+    double average = sum / m_elapsedTimes.size();
+
+    size_t middle = sortedTimes.size() / 2;
+    double median = sortedTimes.size() % 2 ? sortedTimes[middle]
+        : (sortedTimes[middle - 1] + sortedTimes[middle]) / 2;
+
+    double squareSum = 0;
+    for (double time : m_elapsedTimes)
+        squareSum += (time - average) * (time - average);
+    double standardDeviation = m_elapsedTimes.size() > 1
+        ? sqrt(squareSum / (m_elapsedTimes.size() - 1)) : 0;
+
+    cout << endl;
+    cout << "Time:" << endl;
+    cout << "values ";
+    for (size_t i = 0; i < m_elapsedTimes.size(); ++i) {
+        if (i)
+            cout << ", ";
+        cout << m_elapsedTimes[i];
+    }
+    cout << " ms" << endl;
+    cout << "avg " << average << " ms" << endl;
+    cout << "median " << median << " ms" << endl;
+    cout << "stdev " << standardDeviation << " ms" << endl;
+    cout << "min " << sortedTimes.front() << " ms" << endl;
+    cout << "max " << sortedTimes.back() << " ms" << endl;
+}
+
+double Benchmark::currentTimeMS()
+{
+    struct timeval now;
+    gettimeofday(&now, 0);
+    return (now.tv_sec * 1000.0) + now.tv_usec / 1000.0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "HashTableBenchmark.h"
+
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+
+static const size_t tableSize = 100000;
+static const size_t probePasses = 20;
+
+// Scrambles loop indices so probe order doesn't follow table order. Indices
+// start at 1 so no key collides with the hash traits' empty value.
+static inline unsigned keyForIndex(size_t index)
+{
+    return static_cast<unsigned>(index) * 2654435761U;
+}
+
+static WTF::HashMap<unsigned, unsigned> populatedMap()
+{
+    WTF::HashMap<unsigned, unsigned> map;
+    for (size_t i = 1; i <= tableSize; ++i)
+        map.add(keyForIndex(i), static_cast<unsigned>(i));
+    return map;
+}
+
+void benchmark_hash_table_probe_hit()
+{
+    WTF::HashMap<unsigned, unsigned> map = populatedMap();
+
+    size_t found = 0;
+    for (size_t pass = 0; pass < probePasses; ++pass) {
+        for (size_t i = 1; i <= tableSize; ++i) {
+            if (map.contains(keyForIndex(i)))
+                ++found;
+        }
+    }
+
+    if (found != probePasses * tableSize)
+        abort();
+}
+
+void benchmark_hash_table_probe_miss()
+{
+    WTF::HashMap<unsigned, unsigned> map = populatedMap();
+
+    size_t found = 0;
+    for (size_t pass = 0; pass < probePasses; ++pass) {
+        for (size_t i = tableSize + 1; i <= 2 * tableSize; ++i) {
+            if (map.contains(keyForIndex(i)))
+                ++found;
+        }
+    }
+
+    // Almost every probe misses; a handful of the scrambled keys can collide
+    // with populated ones, so only guard against wildly wrong results.
+    if (found > probePasses * tableSize / 2)
+        abort();
+}
+
+void benchmark_hash_table_probe_mixed()
+{
+    // Add/find/remove churn in the proportions rule and element hash tables
+    // tend to see during style resolution: mostly lookups, some insertion and
+    // removal keeping the table near a steady size.
+    WTF::HashMap<unsigned, unsigned> map = populatedMap();
+
+    size_t found = 0;
+    for (size_t pass = 0; pass < probePasses; ++pass) {
+        for (size_t i = 1; i <= tableSize; ++i) {
+            if (map.contains(keyForIndex(i)))
+                ++found;
+            if (!(i % 8)) {
+                map.remove(keyForIndex(i));
+                map.add(keyForIndex(tableSize + i), static_cast<unsigned>(i));
+                map.remove(keyForIndex(tableSize + i));
+                map.add(keyForIndex(i), static_cast<unsigned>(i));
+            }
+        }
+    }
+
+    if (found != probePasses * tableSize)
+        abort();
+}
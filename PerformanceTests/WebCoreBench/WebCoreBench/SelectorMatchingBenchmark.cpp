@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "SelectorMatchingBenchmark.h"
+
+#include "SyntheticTree.h"
+#include <WebCore/CSSParser.h>
+#include <WebCore/CSSSelectorList.h>
+#include <WebCore/ElementTraversal.h>
+#include <WebCore/SelectorChecker.h>
+#include <stdlib.h>
+#include <vector>
+
+using namespace WebCore;
+
+// Roughly the selector mix of a content page: mostly class and descendant
+// selectors, a few ids, attributes and structural pseudo-classes.
+static const char* const selectorTexts[] = {
+    "div",
+    "span",
+    ".row",
+    ".cell",
+    ".row.odd",
+    "#item-500",
+    "div > span",
+    "div .cell",
+    "p + span",
+    "[data-index]",
+    "[data-index=\"250\"]",
+    "div.row span.cell",
+    "div.odd > .cell",
+    ".root .row .cell",
+    ":nth-child(2n)",
+    "div:first-child span:last-child",
+};
+
+static const size_t selectorTextsCount = sizeof(selectorTexts) / sizeof(const char*);
+
+void benchmark_selector_matching()
+{
+    Ref<Document> document = createSyntheticTree(1000, 8);
+
+    CSSParser parser(CSSParserContext(CSSStrictMode));
+    std::vector<CSSSelectorList> selectorLists(selectorTextsCount);
+    for (size_t i = 0; i < selectorTextsCount; ++i)
+        parser.parseSelector(selectorTexts[i], selectorLists[i]);
+
+    SelectorChecker checker(document.get());
+
+    size_t matches = 0;
+    for (Element* element = ElementTraversal::firstWithin(document.get()); element; element = ElementTraversal::next(*element)) {
+        for (size_t i = 0; i < selectorTextsCount; ++i) {
+            for (const CSSSelector* selector = selectorLists[i].first(); selector; selector = CSSSelectorList::next(selector)) {
+                SelectorChecker::CheckingContext context(SelectorChecker::Mode::QueryingRules);
+                unsigned specificity = 0;
+                if (checker.match(*selector, *element, context, specificity))
+                    ++matches;
+            }
+        }
+    }
+
+    // Every element matches at least the universal-ish tag selectors.
+    if (!matches)
+        abort();
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "StyleRecalcBenchmark.h"
+
+#include "SyntheticTree.h"
+#include <WebCore/CSSStyleSheet.h>
+#include <WebCore/ElementTraversal.h>
+#include <WebCore/RenderStyle.h>
+#include <WebCore/StyleResolver.h>
+#include <WebCore/StyleSheetContents.h>
+#include <stdlib.h>
+
+using namespace WebCore;
+
+// A rule set in the shape the synthetic tree expects: class, descendant, id
+// and structural rules over rows and cells, plus some that never match.
+static const char* styleSheetText =
+    "div { display: block; margin: 1px; }"
+    "span { display: inline; }"
+    ".row { padding: 2px; border: 1px solid black; }"
+    ".row.odd { background-color: gray; }"
+    ".row.even { background-color: white; }"
+    ".cell { font-size: 12px; }"
+    ".row .cell { color: blue; }"
+    "div.odd > .cell { font-weight: bold; }"
+    "#item-500 { color: red; }"
+    "[data-index=\"250\"] { text-decoration: underline; }"
+    ":nth-child(2n) { letter-spacing: 1px; }"
+    ".no-such-class .cell { color: green; }"
+    "table td.missing { border-collapse: collapse; }";
+
+void benchmark_style_recalc()
+{
+    Ref<Document> document = createSyntheticTree(1000, 8);
+
+    Ref<StyleSheetContents> contents = StyleSheetContents::create(CSSParserContext(CSSStrictMode));
+    contents->parseString(styleSheetText);
+
+    Vector<RefPtr<CSSStyleSheet>> styleSheets;
+    styleSheets.append(CSSStyleSheet::create(WTFMove(contents)));
+
+    StyleResolver& resolver = document->ensureStyleResolver();
+    resolver.appendAuthorStyleSheets(styleSheets);
+
+    // Resolve style for every element top-down like Style::TreeResolver does,
+    // but without a render tree.
+    size_t resolvedCount = 0;
+    Element* documentElement = document->documentElement();
+    Ref<RenderStyle> rootStyle = resolver.styleForElement(*documentElement, nullptr);
+    ++resolvedCount;
+
+    for (Element* element = ElementTraversal::firstWithin(*documentElement); element; element = ElementTraversal::next(*element, documentElement)) {
+        Ref<RenderStyle> style = resolver.styleForElement(*element, rootStyle.ptr());
+        ++resolvedCount;
+    }
+
+    if (!resolvedCount)
+        abort();
+}
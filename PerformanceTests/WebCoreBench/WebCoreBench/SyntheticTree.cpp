@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "SyntheticTree.h"
+
+#include <WebCore/Element.h>
+#include <WebCore/HTMLNames.h>
+#include <wtf/text/WTFString.h>
+
+using namespace WebCore;
+
+Ref<Document> createSyntheticTree(unsigned rowCount, unsigned cellsPerRow)
+{
+    Ref<Document> document = Document::create(nullptr, URL());
+
+    Ref<Element> root = document->createElement(HTMLNames::divTag, false);
+    root->setAttribute(HTMLNames::classAttr, "root");
+
+    unsigned elementIndex = 0;
+    for (unsigned i = 0; i < rowCount; ++i) {
+        Ref<Element> row = document->createElement(HTMLNames::divTag, false);
+        row->setAttribute(HTMLNames::classAttr, i % 2 ? "row odd" : "row even");
+        row->setIdAttribute(AtomicString(String("item-" + String::number(elementIndex++))));
+
+        for (unsigned j = 0; j < cellsPerRow; ++j) {
+            Ref<Element> cell = document->createElement(j % 3 ? HTMLNames::spanTag : HTMLNames::pTag, false);
+            cell->setAttribute(HTMLNames::classAttr, "cell");
+            cell->setAttribute(QualifiedName(nullAtom, "data-index", nullAtom), AtomicString(String::number(elementIndex++)));
+            row->appendChild(WTFMove(cell));
+        }
+
+        root->appendChild(WTFMove(row));
+    }
+
+    document->appendChild(WTFMove(root));
+    return document;
+}
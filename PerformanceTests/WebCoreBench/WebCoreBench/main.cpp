@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Benchmark.h"
+#include "CommandLine.h"
+#include <WebCore/HTMLNames.h>
+#include <WebCore/MathMLNames.h>
+#include <WebCore/MediaFeatureNames.h>
+#include <WebCore/QualifiedName.h>
+#include <WebCore/SVGNames.h>
+#include <WebCore/WebKitFontFamilyNames.h>
+#include <WebCore/XLinkNames.h>
+#include <WebCore/XMLNSNames.h>
+#include <WebCore/XMLNames.h>
+#include <iostream>
+#include <runtime/InitializeThreading.h>
+#include <wtf/MainThread.h>
+
+using namespace std;
+
+// The benchmarks drive WebCore directly without a WebKit layer, so set up the
+// global name tables the same way Frame construction would.
+static void initializeWebCore()
+{
+    JSC::initializeThreading();
+    WTF::initializeMainThread();
+
+    AtomicString::init();
+    WebCore::HTMLNames::init();
+    WebCore::QualifiedName::init();
+    WebCore::MediaFeatureNames::init();
+    WebCore::SVGNames::init();
+    WebCore::XLinkNames::init();
+    WebCore::MathMLNames::init();
+    WebCore::XMLNSNames::init();
+    WebCore::XMLNames::init();
+    WebCore::WebKitFontFamilyNames::init();
+}
+
+int main(int argc, char** argv)
+{
+    CommandLine commandLine(argc, argv);
+    if (!commandLine.isValid()) {
+        commandLine.printUsage();
+        exit(1);
+    }
+
+    Benchmark benchmark(commandLine.benchmarkName(), commandLine.runs());
+    if (!benchmark.isValid()) {
+        cout << "Invalid benchmark: " << commandLine.benchmarkName() << endl << endl;
+        benchmark.printBenchmarks();
+        exit(1);
+    }
+
+    initializeWebCore();
+
+    cout << "Running " << commandLine.runs() << " times" << endl;
+    benchmark.run();
+    benchmark.printReport();
+
+    return 0;
+}
@@ -92,7 +92,9 @@ void generateToAir(Procedure& procedure, unsigned optLevel)
 
     lowerMacros(procedure);
 
-    if (optLevel >= 1) {
+    // The second optimization pass mostly cleans up what lowerMacros() exposed. It's the
+    // first thing to shed when a compile is already over its phase budget.
+    if (optLevel >= 1 && !timingScope.hasExceededBudget()) {
         reduceStrength(procedure);
 
         // FIXME: Add more optimizations here.
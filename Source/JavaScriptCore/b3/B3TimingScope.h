@@ -38,6 +38,12 @@ public:
     TimingScope(const char* name);
     ~TimingScope();
 
+    double elapsedMS() const;
+
+    // True if a phase budget is configured (Options::b3PhaseBudgetMS()) and this scope has
+    // already consumed it. Callers use this to shed optional phases on long compiles.
+    bool hasExceededBudget() const;
+
 private:
     const char* m_name;
     double m_before;
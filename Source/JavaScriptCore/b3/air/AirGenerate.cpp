@@ -41,6 +41,7 @@
 #include "AirLowerMacros.h"
 #include "AirOpcodeUtils.h"
 #include "AirOptimizeBlockOrder.h"
+#include "AirOptimizePeepholes.h"
 #include "AirReportUsedRegisters.h"
 #include "AirSimplifyCFG.h"
 #include "AirSpillEverything.h"
@@ -73,9 +74,11 @@ void prepareForGeneration(Code& code)
     lowerMacros(code);
 
     // This is where we run our optimizations and transformations.
-    // FIXME: Add Air optimizations.
+    // FIXME: Add more Air optimizations.
     // https://bugs.webkit.org/show_bug.cgi?id=150456
-    
+
+    optimizePeepholes(code);
+
     eliminateDeadCode(code);
 
     // Register allocation for all the Tmps that do not have a corresponding machine register.
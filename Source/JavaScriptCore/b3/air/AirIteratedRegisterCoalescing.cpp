@@ -46,6 +46,10 @@ namespace {
 
 bool debug = false;
 bool traceDebug = false;
+
+// Procedures at or below this instruction count skip graph coloring entirely when
+// every Tmp can get its own register. See tryDirectRegisterAssignment().
+const unsigned maxInstructionCountForDirectAssignment = 20;
 bool reportStats = false;
 
 // The AbstractColoringAllocator defines all the code that is independant
@@ -1250,14 +1254,77 @@ public:
 
     void run()
     {
-        iteratedRegisterCoalescingOnType<Arg::GP>();
-        iteratedRegisterCoalescingOnType<Arg::FP>();
+        if (!tryDirectRegisterAssignment<Arg::GP>())
+            iteratedRegisterCoalescingOnType<Arg::GP>();
+        if (!tryDirectRegisterAssignment<Arg::FP>())
+            iteratedRegisterCoalescingOnType<Arg::FP>();
 
         if (reportStats)
             dataLog("Num iterations = ", m_numIterations, "\n");
     }
 
 private:
+    // Tiny procedures - outlined stubs, leaf math helpers - don't need the full
+    // build/simplify/select machinery. When every Tmp of this type fits in its own
+    // register we hand registers out directly; distinct registers trivially satisfy
+    // any interference, so no liveness is needed. Specials disqualify the procedure
+    // because they can clobber registers that don't appear as arguments. The price
+    // is that reg-to-reg moves coalescing would have removed stay behind, which is
+    // why this only kicks in below a small instruction count where the compile-time
+    // win dominates.
+    template<Arg::Type type>
+    bool tryDirectRegisterAssignment()
+    {
+        unsigned numTmps = m_code.numTmps(type);
+        if (!numTmps)
+            return true;
+
+        unsigned instructionCount = 0;
+        for (BasicBlock* block : m_code)
+            instructionCount += block->size();
+        if (instructionCount > maxInstructionCountForDirectAssignment)
+            return false;
+
+        RegisterSet unavailableRegs;
+        for (BasicBlock* block : m_code) {
+            for (Inst& inst : *block) {
+                for (Arg& arg : inst.args) {
+                    if (arg.isSpecial())
+                        return false;
+                }
+                inst.forEachTmpFast([&] (Tmp& tmp) {
+                    if (tmp.isReg())
+                        unavailableRegs.set(tmp.reg());
+                });
+            }
+        }
+
+        Vector<Reg, 16> assignedRegs;
+        for (Reg reg : regsInPriorityOrder(type)) {
+            if (unavailableRegs.get(reg))
+                continue;
+            assignedRegs.append(reg);
+            if (assignedRegs.size() == numTmps)
+                break;
+        }
+        if (assignedRegs.size() < numTmps)
+            return false;
+
+        for (BasicBlock* block : m_code) {
+            for (Inst& inst : *block) {
+                inst.forEachTmpFast([&] (Tmp& tmp) {
+                    if (tmp.isReg() || tmp.isGP() != (type == Arg::GP))
+                        return;
+                    tmp = Tmp(assignedRegs[tmp.tmpIndex()]);
+                });
+            }
+        }
+
+        if (traceDebug)
+            dataLog("Direct register assignment of ", numTmps, " tmps:\n", m_code);
+
+        return true;
+    }
     template<Arg::Type type>
     void iteratedRegisterCoalescingOnType()
     {
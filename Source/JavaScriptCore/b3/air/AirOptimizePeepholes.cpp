@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "AirOptimizePeepholes.h"
+
+#if ENABLE(B3_JIT)
+
+#include "AirCode.h"
+#include "AirInstInlines.h"
+#include "AirPhaseScope.h"
+#include <wtf/HashMap.h>
+
+namespace JSC { namespace B3 { namespace Air {
+
+namespace {
+
+bool isSimpleMove(Opcode opcode)
+{
+    switch (opcode) {
+    case Move:
+    case Move32:
+    case MoveFloat:
+    case MoveDouble:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Width of the memory access performed by one of the opcodes above. Narrower
+// loads (Load8 and friends) extend, so fusing them would change the value the
+// consumer sees; we leave them alone.
+Arg::Width moveWidth(Opcode opcode)
+{
+    switch (opcode) {
+    case Move:
+        return Arg::pointerWidth();
+    case Move32:
+    case MoveFloat:
+        return Arg::Width32;
+    case MoveDouble:
+        return Arg::Width64;
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+        return Arg::Width64;
+    }
+}
+
+Arg::Type moveType(Opcode opcode)
+{
+    switch (opcode) {
+    case Move:
+    case Move32:
+        return Arg::GP;
+    case MoveFloat:
+    case MoveDouble:
+        return Arg::FP;
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+        return Arg::GP;
+    }
+}
+
+bool isLoad(Inst& inst)
+{
+    return isSimpleMove(inst.opcode) && inst.args[0].isMemory() && inst.args[1].isTmp();
+}
+
+bool isStore(Inst& inst)
+{
+    return isSimpleMove(inst.opcode) && !inst.args[0].isMemory() && inst.args[1].isMemory();
+}
+
+// Specials can squirrel arguments away and have effects that the opcode table
+// doesn't describe, so we never rewrite their arguments.
+bool hasCustomBehavior(Inst& inst)
+{
+    switch (inst.opcode) {
+    case Patch:
+    case CCall:
+    case ColdCCall:
+    case Shuffle:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // anonymous namespace
+
+bool optimizePeepholes(Code& code)
+{
+    PhaseScope phaseScope(code, "optimizePeepholes");
+
+    // Exact appearance counts, unlike UseCounts, which weighs by block
+    // frequency. A fused load can only be deleted if its Tmp is defined once
+    // and read exactly once, so approximations are not acceptable here.
+    struct Counts {
+        unsigned uses { 0 };
+        unsigned defs { 0 };
+    };
+    HashMap<Tmp, Counts> counts;
+    unsigned instCountBefore = 0;
+    for (BasicBlock* block : code) {
+        instCountBefore += block->size();
+        for (Inst& inst : *block) {
+            inst.forEachTmp(
+                [&] (Tmp& tmp, Arg::Role role, Arg::Type, Arg::Width) {
+                    Counts& tmpCounts = counts.add(tmp, Counts()).iterator->value;
+                    if (Arg::isAnyUse(role))
+                        tmpCounts.uses++;
+                    if (Arg::isAnyDef(role))
+                        tmpCounts.defs++;
+                });
+        }
+    }
+
+    unsigned identityMoves = 0;
+    unsigned storeLoadForwards = 0;
+    unsigned loadOpFusions = 0;
+
+    for (BasicBlock* block : code) {
+        for (unsigned instIndex = 0; instIndex < block->size(); ++instIndex) {
+            Inst& inst = block->at(instIndex);
+            if (!inst)
+                continue;
+
+            // A move from a register to itself does nothing. Move32 is not an
+            // identity since it zero-extends.
+            if ((inst.opcode == Move || inst.opcode == MoveFloat || inst.opcode == MoveDouble)
+                && inst.args[0].isTmp() && inst.args[0] == inst.args[1]) {
+                inst = Inst();
+                identityMoves++;
+                continue;
+            }
+
+            Inst* next = block->get(instIndex + 1);
+            if (!next)
+                continue;
+
+            // Store followed by a reload of the same address: the loaded value
+            // is whatever we just stored, so read it from the source of the
+            // store instead of going through memory. The opcodes must match so
+            // that the access width and the extension behavior are the same.
+            if (isStore(inst) && isLoad(*next) && inst.opcode == next->opcode
+                && inst.args[1] == next->args[0]) {
+                Inst forwarded(next->opcode, next->origin, inst.args[0], next->args[1]);
+                if (forwarded.isValidForm()) {
+                    if (inst.args[0].isTmp())
+                        counts.add(inst.args[0].tmp(), Counts()).iterator->value.uses++;
+                    *next = forwarded;
+                    storeLoadForwards++;
+                    continue;
+                }
+            }
+
+            // Load whose result dies in the very next instruction: fold the
+            // memory operand into the consumer if it admits a memory form, and
+            // drop the load. Adjacency means no store can intervene, and the
+            // single-def single-use check means nothing else observes the Tmp.
+            if (isLoad(inst) && !hasCustomBehavior(*next)) {
+                Tmp loadedTmp = inst.args[1].tmp();
+                auto iter = counts.find(loadedTmp);
+                ASSERT(iter != counts.end());
+                if (iter->value.defs == 1 && iter->value.uses == 1) {
+                    unsigned argIndex = UINT_MAX;
+                    unsigned currentIndex = 0;
+                    bool roleAndWidthMatch = false;
+                    next->forEachArg(
+                        [&] (Arg& arg, Arg::Role role, Arg::Type type, Arg::Width width) {
+                            if (arg.isTmp() && arg.tmp() == loadedTmp) {
+                                argIndex = currentIndex;
+                                roleAndWidthMatch = role == Arg::Use
+                                    && type == moveType(inst.opcode)
+                                    && width == moveWidth(inst.opcode);
+                            }
+                            currentIndex++;
+                        });
+                    if (argIndex != UINT_MAX && roleAndWidthMatch) {
+                        Inst fused = *next;
+                        fused.args[argIndex] = inst.args[0];
+                        if (fused.isValidForm()) {
+                            *next = fused;
+                            inst = Inst();
+                            loadOpFusions++;
+                            continue;
+                        }
+                    }
+                }
+            }
+        }
+
+        block->insts().removeAllMatching(
+            [&] (const Inst& inst) -> bool {
+                return !inst;
+            });
+    }
+
+    bool changed = identityMoves || storeLoadForwards || loadOpFusions;
+
+    if (Options::logAirPeepholeStats()) {
+        unsigned instCountAfter = 0;
+        for (BasicBlock* block : code)
+            instCountAfter += block->size();
+        dataLog(
+            "Air peepholes: ", instCountBefore, " insts before, ", instCountAfter,
+            " after (", identityMoves, " identity moves, ", storeLoadForwards,
+            " store-load forwards, ", loadOpFusions, " load-op fusions)\n");
+    }
+
+    return changed;
+}
+
+} } } // namespace JSC::B3::Air
+
+#endif // ENABLE(B3_JIT)
@@ -28,6 +28,7 @@
 #include "AirCode.h"
 #include "AirGenerate.h"
 #include "AirInstInlines.h"
+#include "AirOptimizePeepholes.h"
 #include "AirRegisterPriority.h"
 #include "AllowMacroScratchRegisterUsage.h"
 #include "B3Compilation.h"
@@ -1633,6 +1634,65 @@ void testShuffleShiftDouble()
     CHECK(things[3] == 3);
 }
 
+void testPeepholeStoreLoadForwarding()
+{
+    B3::Procedure proc;
+    Code& code = proc.code();
+
+    int32_t memory = 0;
+
+    BasicBlock* root = code.addBlock();
+    Tmp base = code.newTmp(Arg::GP);
+    Tmp value = code.newTmp(Arg::GP);
+    Tmp reloaded = code.newTmp(Arg::GP);
+    root->append(Move, nullptr, Arg::bigImm(bitwise_cast<intptr_t>(&memory)), base);
+    root->append(Move, nullptr, Arg::imm(37), value);
+    root->append(Move32, nullptr, value, Arg::addr(base));
+    root->append(Move32, nullptr, Arg::addr(base), reloaded);
+    root->append(Move, nullptr, reloaded, Tmp(GPRInfo::returnValueGPR));
+    root->append(Ret32, nullptr, Tmp(GPRInfo::returnValueGPR));
+
+    CHECK(optimizePeepholes(code));
+
+    // The reload should have become a register-to-register move, while the
+    // store itself must remain.
+    CHECK(root->at(3).opcode == Move32);
+    CHECK(root->at(3).args[0] == Arg(value));
+    CHECK(root->at(2).args[1] == Arg::addr(base));
+
+    CHECK(compileAndRun<int>(proc) == 37);
+    CHECK(memory == 37);
+}
+
+void testPeepholeLoadOpFusion()
+{
+    B3::Procedure proc;
+    Code& code = proc.code();
+
+    int32_t memory = 42;
+
+    BasicBlock* root = code.addBlock();
+    Tmp base = code.newTmp(Arg::GP);
+    Tmp loaded = code.newTmp(Arg::GP);
+    Tmp result = code.newTmp(Arg::GP);
+    root->append(Move, nullptr, Arg::bigImm(bitwise_cast<intptr_t>(&memory)), base);
+    root->append(Move, nullptr, Arg::imm(8), result);
+    root->append(Move32, nullptr, Arg::addr(base), loaded);
+    root->append(Add32, nullptr, loaded, result);
+    root->append(Move, nullptr, result, Tmp(GPRInfo::returnValueGPR));
+    root->append(Ret32, nullptr, Tmp(GPRInfo::returnValueGPR));
+
+    if (isValidForm(Add32, Arg::Addr, Arg::Tmp)) {
+        unsigned sizeBefore = root->size();
+        CHECK(optimizePeepholes(code));
+        CHECK(root->size() == sizeBefore - 1);
+        CHECK(root->at(2).opcode == Add32);
+        CHECK(root->at(2).args[0] == Arg::addr(base));
+    }
+
+    CHECK(compileAndRun<int>(proc) == 50);
+}
+
 #define RUN(test) do {                          \
         if (!shouldRun(#test))                  \
             break;                              \
@@ -1693,6 +1753,9 @@ void run(const char* filter)
     RUN(testShuffleSwapDouble());
     RUN(testShuffleShiftDouble());
 
+    RUN(testPeepholeStoreLoadForwarding());
+    RUN(testPeepholeLoadOpFusion());
+
     if (tasks.isEmpty())
         usage();
 
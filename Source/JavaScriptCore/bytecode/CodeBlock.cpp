@@ -3649,11 +3649,39 @@ static int32_t clipThreshold(double threshold)
     return static_cast<int32_t>(threshold);
 }
 
+double CodeBlock::compilationLoadScalingFactor()
+{
+    double result = 1.0;
+#if ENABLE(DFG_JIT)
+    // Compiles already pending in the worklists mean the compiler threads are competing with
+    // execution for cores, so tier-up backs off in proportion to the queue depth rather than
+    // piling on. Note that executable pool occupancy is accounted for separately, when the
+    // threshold is applied to the execution counter (see applyMemoryUsageHeuristics()).
+    double perCompileMultiplier = Options::worklistLoadThresholdMultiplier();
+    if (perCompileMultiplier > 0) {
+        size_t queueLength = 0;
+        if (DFG::Worklist* worklist = DFG::existingGlobalDFGWorklistOrNull())
+            queueLength += worklist->queueLength();
+        if (DFG::Worklist* worklist = DFG::existingGlobalFTLWorklistOrNull())
+            queueLength += worklist->queueLength();
+        result += perCompileMultiplier * queueLength;
+    }
+#endif
+    if (m_vm->isInLoadingPhase())
+        result *= Options::loadingPhaseThresholdMultiplier();
+
+    if (Options::verboseOSR() && result != 1.0)
+        dataLog(*this, ": scaling execution counter by compilation load factor ", result, "\n");
+
+    return result;
+}
+
 int32_t CodeBlock::adjustedCounterValue(int32_t desiredThreshold)
 {
     return clipThreshold(
         static_cast<double>(desiredThreshold) *
         optimizationThresholdScalingFactor() *
+        compilationLoadScalingFactor() *
         (1 << reoptimizationRetryCounter()));
 }
 
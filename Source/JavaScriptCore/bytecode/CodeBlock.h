@@ -716,6 +716,8 @@ public:
 
     int32_t codeTypeThresholdMultiplier() const;
 
+    double compilationLoadScalingFactor();
+
     int32_t adjustedCounterValue(int32_t desiredThreshold);
 
     int32_t* addressOfJITExecuteCounter()
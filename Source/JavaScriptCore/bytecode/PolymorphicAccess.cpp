@@ -1105,8 +1105,28 @@ void AccessCase::generate(AccessGenerationState& state)
 PolymorphicAccess::PolymorphicAccess() { }
 PolymorphicAccess::~PolymorphicAccess() { }
 
-MacroAssemblerCodePtr PolymorphicAccess::regenerateWithCases(
-    VM& vm, CodeBlock* codeBlock, StructureStubInfo& stubInfo, const Identifier& ident,
+void AccessGenerationResult::dump(PrintStream& out) const
+{
+    switch (m_kind) {
+    case MadeNoChanges:
+        out.print("MadeNoChanges");
+        break;
+    case GaveUp:
+        out.print("GaveUp");
+        break;
+    case Buffered:
+        out.print("Buffered");
+        break;
+    case GeneratedNewCode:
+        out.print("GeneratedNewCode");
+        break;
+    }
+    if (m_code)
+        out.print(":", m_code);
+}
+
+AccessGenerationResult PolymorphicAccess::addCases(
+    VM&, CodeBlock*, StructureStubInfo&,
     Vector<std::unique_ptr<AccessCase>> originalCasesToAdd)
 {
     // This method will add the originalCasesToAdd to the list one at a time while preserving the
@@ -1116,10 +1136,14 @@ MacroAssemblerCodePtr PolymorphicAccess::regenerateWithCases(
     //   can be removed via the canReplace() rule.
     // - Cases in the list always appear in ascending order of time of addition. Therefore, if you
     //   cascade through the cases in reverse order, you will get the most recent cases first.
-    // - If this method fails (returns null, doesn't add the cases), then both the previous case list
-    //   and the previous stub are kept intact and the new cases are destroyed. It's OK to attempt to
-    //   add more things after failure.
-    
+    // - If this method fails (returns GaveUp, doesn't add the cases), then both the previous case
+    //   list and the previous stub are kept intact and the new cases are destroyed. It's OK to
+    //   attempt to add more things after failure.
+    //
+    // Note that this does not generate any code: the surviving cases are merely buffered into the
+    // list, and the old stub keeps running. The owning StructureStubInfo calls regenerate() once it
+    // decides that the batch is worth committing.
+
     // First, verify that we can generate code for all of the new cases while eliminating any of the
     // new cases that replace each other.
     Vector<std::unique_ptr<AccessCase>> casesToAdd;
@@ -1144,61 +1168,68 @@ MacroAssemblerCodePtr PolymorphicAccess::regenerateWithCases(
     if (verbose)
         dataLog("casesToAdd: ", listDump(casesToAdd), "\n");
 
-    // If there aren't any cases to add, then fail on the grounds that there's no point to generating a
-    // new stub that will be identical to the old one. Returning null should tell the caller to just
-    // keep doing what they were doing before.
+    // If there aren't any cases to add, then don't change anything: there's no point to buffering a
+    // case that is subsumed by what we already have. The caller should just keep doing what they
+    // were doing before.
     if (casesToAdd.isEmpty())
-        return MacroAssemblerCodePtr();
-
-    // Now construct the list of cases as they should appear if we are successful. This means putting
-    // all of the previous cases in this list in order but excluding those that can be replaced, and
-    // then adding the new cases.
-    ListType newCases;
-    for (auto& oldCase : m_list) {
-        // Ignore old cases that cannot possibly succeed anymore.
-        if (!oldCase->couldStillSucceed())
-            continue;
-
-        // Figure out if this is replaced by any new cases.
-        bool found = false;
-        for (auto& caseToAdd : casesToAdd) {
-            if (caseToAdd->canReplace(*oldCase)) {
-                found = true;
-                break;
+        return AccessGenerationResult::MadeNoChanges;
+
+    // Now prune the list down to the cases that should survive: drop cases that cannot possibly
+    // succeed anymore and cases that the new ones replace. Since no code is generated here, the old
+    // stub is unaffected; it just contains checks that can never pass.
+    m_list.removeAllMatching(
+        [&] (std::unique_ptr<AccessCase>& oldCase) -> bool {
+            if (!oldCase->couldStillSucceed())
+                return true;
+
+            // Figure out if this is replaced by any new cases.
+            for (auto& caseToAdd : casesToAdd) {
+                if (caseToAdd->canReplace(*oldCase))
+                    return true;
             }
-        }
-        if (found)
-            continue;
-        
-        newCases.append(oldCase->clone());
-    }
-    for (auto& caseToAdd : casesToAdd)
-        newCases.append(WTFMove(caseToAdd));
-
-    if (verbose)
-        dataLog("newCases: ", listDump(newCases), "\n");
+            return false;
+        });
 
-    if (newCases.size() > Options::maxAccessVariantListSize()) {
+    if (m_list.size() + casesToAdd.size() > Options::maxAccessVariantListSize()) {
         if (verbose)
             dataLog("Too many cases.\n");
-        return MacroAssemblerCodePtr();
+        return AccessGenerationResult::GaveUp;
     }
 
-    MacroAssemblerCodePtr result = regenerate(vm, codeBlock, stubInfo, ident, newCases);
-    if (!result)
-        return MacroAssemblerCodePtr();
+    for (auto& caseToAdd : casesToAdd)
+        m_list.append(WTFMove(caseToAdd));
 
-    m_list = WTFMove(newCases);
-    return result;
+    if (verbose)
+        dataLog("After addCases: ", listDump(m_list), "\n");
+
+    return AccessGenerationResult::Buffered;
 }
 
-MacroAssemblerCodePtr PolymorphicAccess::regenerateWithCase(
-    VM& vm, CodeBlock* codeBlock, StructureStubInfo& stubInfo, const Identifier& ident,
+AccessGenerationResult PolymorphicAccess::addCase(
+    VM& vm, CodeBlock* codeBlock, StructureStubInfo& stubInfo,
     std::unique_ptr<AccessCase> newAccess)
 {
     Vector<std::unique_ptr<AccessCase>> newAccesses;
     newAccesses.append(WTFMove(newAccess));
-    return regenerateWithCases(vm, codeBlock, stubInfo, ident, WTFMove(newAccesses));
+    return addCases(vm, codeBlock, stubInfo, WTFMove(newAccesses));
+}
+
+MacroAssemblerCodePtr PolymorphicAccess::regenerate(
+    VM& vm, CodeBlock* codeBlock, StructureStubInfo& stubInfo, const Identifier& ident)
+{
+    // Generate against clones: the stub we are replacing has code that points into the existing
+    // AccessCase objects (call link infos and so on), and it keeps running until the caller
+    // repatches the jump to the new stub. If generation fails, the old list and stub stay intact.
+    ListType cases;
+    for (auto& entry : m_list)
+        cases.append(entry->clone());
+
+    MacroAssemblerCodePtr result = regenerate(vm, codeBlock, stubInfo, ident, cases);
+    if (!result)
+        return MacroAssemblerCodePtr();
+
+    m_list = WTFMove(cases);
+    return result;
 }
 
 bool PolymorphicAccess::visitWeak(VM& vm) const
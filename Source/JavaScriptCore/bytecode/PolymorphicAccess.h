@@ -308,6 +308,53 @@ private:
     std::unique_ptr<RareData> m_rareData;
 };
 
+// This is the result of attempting to add an AccessCase to a StructureStubInfo. The interesting
+// case is Buffered: the case was added to the list but no code was generated, so the IC will keep
+// taking the slow path for it. The StructureStubInfo commits the whole buffer in one regeneration
+// once it sees evidence that the buffered cases are hot, which means one stub compile, one jump
+// repatch, and one cross-modifying-code flush per batch of cases rather than per case.
+class AccessGenerationResult {
+public:
+    enum Kind {
+        MadeNoChanges,
+        GaveUp,
+        Buffered,
+        GeneratedNewCode
+    };
+
+    AccessGenerationResult()
+    {
+    }
+
+    AccessGenerationResult(Kind kind)
+        : m_kind(kind)
+    {
+        ASSERT(kind != GeneratedNewCode);
+    }
+
+    AccessGenerationResult(MacroAssemblerCodePtr code)
+        : m_kind(GeneratedNewCode)
+        , m_code(code)
+    {
+        RELEASE_ASSERT(code);
+    }
+
+    Kind kind() const { return m_kind; }
+
+    const MacroAssemblerCodePtr& code() const { return m_code; }
+
+    bool madeNoChanges() const { return m_kind == MadeNoChanges; }
+    bool gaveUp() const { return m_kind == GaveUp; }
+    bool buffered() const { return m_kind == Buffered; }
+    bool generatedNewCode() const { return m_kind == GeneratedNewCode; }
+
+    void dump(PrintStream&) const;
+
+private:
+    Kind m_kind { MadeNoChanges };
+    MacroAssemblerCodePtr m_code;
+};
+
 class PolymorphicAccess {
     WTF_MAKE_NONCOPYABLE(PolymorphicAccess);
     WTF_MAKE_FAST_ALLOCATED;
@@ -315,15 +362,22 @@ public:
     PolymorphicAccess();
     ~PolymorphicAccess();
 
-    // This may return null, in which case the old stub routine is left intact. You are required to
-    // pass a vector of non-null access cases. This will prune the access cases by rejecting any case
-    // in the list that is subsumed by a later case in the list.
-    MacroAssemblerCodePtr regenerateWithCases(
-        VM&, CodeBlock*, StructureStubInfo&, const Identifier&, Vector<std::unique_ptr<AccessCase>>);
+    // This may return GaveUp, in which case both the old case list and the old stub are left
+    // intact. You are required to pass a vector of non-null access cases. This will prune the
+    // access cases by rejecting any case in the list that is subsumed by a later case in the list.
+    // The surviving cases are buffered without generating any code; call regenerate() to commit
+    // them to a new stub. Until then they just keep taking the slow path.
+    AccessGenerationResult addCases(
+        VM&, CodeBlock*, StructureStubInfo&, Vector<std::unique_ptr<AccessCase>>);
+
+    AccessGenerationResult addCase(
+        VM&, CodeBlock*, StructureStubInfo&, std::unique_ptr<AccessCase>);
+
+    // Generates a new stub covering every case in the list, including cases buffered by addCases()
+    // since the last regeneration. This is the expensive part - stub compilation and the icache
+    // flush - so the caller should batch as many case additions as it can in front of it.
+    MacroAssemblerCodePtr regenerate(VM&, CodeBlock*, StructureStubInfo&, const Identifier&);
 
-    MacroAssemblerCodePtr regenerateWithCase(
-        VM&, CodeBlock*, StructureStubInfo&, const Identifier&, std::unique_ptr<AccessCase>);
-    
     bool isEmpty() const { return m_list.isEmpty(); }
     unsigned size() const { return m_list.size(); }
     const AccessCase& at(unsigned i) const { return *m_list[i]; }
@@ -105,43 +105,69 @@ void StructureStubInfo::aboutToDie()
     RELEASE_ASSERT_NOT_REACHED();
 }
 
-MacroAssemblerCodePtr StructureStubInfo::addAccessCase(
+AccessGenerationResult StructureStubInfo::addAccessCase(
     CodeBlock* codeBlock, const Identifier& ident, std::unique_ptr<AccessCase> accessCase)
 {
     VM& vm = *codeBlock->vm();
-    
+
     if (!accessCase)
-        return MacroAssemblerCodePtr();
-    
-    if (cacheType == CacheType::Stub)
-        return u.stub->regenerateWithCase(vm, codeBlock, *this, ident, WTFMove(accessCase));
+        return AccessGenerationResult::GaveUp;
 
-    std::unique_ptr<PolymorphicAccess> access = std::make_unique<PolymorphicAccess>();
-    
-    Vector<std::unique_ptr<AccessCase>> accessCases;
-    
-    std::unique_ptr<AccessCase> previousCase =
-        AccessCase::fromStructureStubInfo(vm, codeBlock, *this);
-    if (previousCase)
-        accessCases.append(WTFMove(previousCase));
+    if (cacheType != CacheType::Stub) {
+        // This is the first transition to a polymorphic stub. Generate immediately: the IC is
+        // currently pointed at the slow path (or a self-access that just failed), so there is no
+        // old stub whose lifetime we could extend by buffering.
+        std::unique_ptr<PolymorphicAccess> access = std::make_unique<PolymorphicAccess>();
 
-    accessCases.append(WTFMove(accessCase));
+        Vector<std::unique_ptr<AccessCase>> accessCases;
 
-    MacroAssemblerCodePtr result =
-        access->regenerateWithCases(vm, codeBlock, *this, ident, WTFMove(accessCases));
+        std::unique_ptr<AccessCase> previousCase =
+            AccessCase::fromStructureStubInfo(vm, codeBlock, *this);
+        if (previousCase)
+            accessCases.append(WTFMove(previousCase));
 
-    if (!result)
-        return MacroAssemblerCodePtr();
+        accessCases.append(WTFMove(accessCase));
+
+        AccessGenerationResult result =
+            access->addCases(vm, codeBlock, *this, WTFMove(accessCases));
+        if (!result.buffered())
+            return result;
+
+        MacroAssemblerCodePtr code = access->regenerate(vm, codeBlock, *this, ident);
+        if (!code)
+            return AccessGenerationResult::GaveUp;
+
+        initStub(codeBlock, WTFMove(access));
+        return AccessGenerationResult(code);
+    }
 
-    initStub(codeBlock, WTFMove(access));
-    return result;
+    // We already have a stub. Regenerating it for every new case is what makes warmup of big
+    // programs repatch-bound, so instead we buffer the case and let the slow path keep servicing
+    // its structure. Only when a buffered structure shows up a second time - evidence that the
+    // batch has repeat traffic - do we pay for one regeneration that commits everything at once.
+    Structure* structure = accessCase->structure();
+    bool shouldCommit = !structure || !bufferedStructures.add(structure);
+
+    AccessGenerationResult result = u.stub->addCase(vm, codeBlock, *this, WTFMove(accessCase));
+    if (!result.buffered() || !shouldCommit)
+        return result;
+
+    bufferedStructures.clear();
+
+    MacroAssemblerCodePtr code = u.stub->regenerate(vm, codeBlock, *this, ident);
+    if (!code)
+        return AccessGenerationResult::GaveUp;
+
+    return AccessGenerationResult(code);
 }
 
 void StructureStubInfo::reset(CodeBlock* codeBlock)
 {
+    bufferedStructures.clear();
+
     if (cacheType == CacheType::Unset)
         return;
-    
+
     if (Options::verboseOSR()) {
         // This can be called from GC destructor calls, so we don't try to do a full dump
         // of the CodeBlock.
@@ -168,6 +194,11 @@ void StructureStubInfo::visitWeakReferences(CodeBlock* codeBlock)
 {
     VM& vm = *codeBlock->vm();
 
+    bufferedStructures.genericFilter(
+        [&] (Structure* structure) -> bool {
+            return Heap::isMarked(structure);
+        });
+
     switch (cacheType) {
     case CacheType::GetByIdSelf:
     case CacheType::PutByIdReplace:
@@ -36,6 +36,7 @@
 #include "PolymorphicAccess.h"
 #include "RegisterSet.h"
 #include "Structure.h"
+#include "StructureSet.h"
 #include "StructureStubClearingWatchpoint.h"
 
 namespace JSC {
@@ -68,7 +69,7 @@ public:
     void initPutByIdReplace(CodeBlock*, Structure* baseObjectStructure, PropertyOffset);
     void initStub(CodeBlock*, std::unique_ptr<PolymorphicAccess>);
 
-    MacroAssemblerCodePtr addAccessCase(
+    AccessGenerationResult addAccessCase(
         CodeBlock*, const Identifier&, std::unique_ptr<AccessCase>);
 
     void reset(CodeBlock*);
@@ -122,6 +123,12 @@ public:
     CodeOrigin codeOrigin;
     CallSiteIndex callSiteIndex;
 
+    // Structures whose cases are buffered in the stub but not yet compiled into it. When a
+    // structure shows up in the slow path a second time, we know the buffer is seeing repeat
+    // traffic and commit the whole batch with a single regeneration. Entries are only ever
+    // compared by pointer, but we still prune dead ones during GC.
+    StructureSet bufferedStructures;
+
     bool containsPC(void* pc) const;
 
     union {
@@ -149,6 +149,16 @@ ParserError BytecodeGenerator::generate()
     return ParserError(ParserError::ErrorNone);
 }
 
+static const size_t maximumInitialInstructionCapacity = 32768;
+
+// Emitted bytecode size correlates roughly with source text size. Reserving the
+// instruction buffer up front saves a dozen reallocations (each a full copy) when
+// generating large top-level bodies, which is pure main-thread stall at cold start.
+static size_t initialInstructionCapacity(const ScopeNode* scopeNode)
+{
+    return std::min<size_t>(maximumInitialInstructionCapacity, scopeNode->source().length() / 4);
+}
+
 BytecodeGenerator::BytecodeGenerator(VM& vm, ProgramNode* programNode, UnlinkedProgramCodeBlock* codeBlock, DebuggerMode debuggerMode, ProfilerMode profilerMode, const VariableEnvironment* parentScopeTDZVariables)
     : m_shouldEmitDebugHooks(Options::forceDebuggerBytecodeGeneration() || debuggerMode == DebuggerOn)
     , m_shouldEmitProfileHooks(Options::forceProfilerBytecodeGeneration() || profilerMode == ProfilerOn)
@@ -161,6 +171,8 @@ BytecodeGenerator::BytecodeGenerator(VM& vm, ProgramNode* programNode, UnlinkedP
 {
     ASSERT_UNUSED(parentScopeTDZVariables, !parentScopeTDZVariables->size());
 
+    m_instructions.reserveInitialCapacity(initialInstructionCapacity(m_scopeNode));
+
     for (auto& constantRegister : m_linkTimeConstantRegisters)
         constantRegister = nullptr;
 
@@ -213,6 +225,8 @@ BytecodeGenerator::BytecodeGenerator(VM& vm, FunctionNode* functionNode, Unlinke
     , m_needsToUpdateArrowFunctionContext(functionNode->usesArrowFunction() || functionNode->usesEval())
     , m_derivedContextType(codeBlock->derivedContextType())
 {
+    m_instructions.reserveInitialCapacity(initialInstructionCapacity(m_scopeNode));
+
     for (auto& constantRegister : m_linkTimeConstantRegisters)
         constantRegister = nullptr;
 
@@ -597,6 +611,8 @@ BytecodeGenerator::BytecodeGenerator(VM& vm, EvalNode* evalNode, UnlinkedEvalCod
     , m_needsToUpdateArrowFunctionContext(evalNode->usesArrowFunction() || evalNode->usesEval())
     , m_derivedContextType(codeBlock->derivedContextType())
 {
+    m_instructions.reserveInitialCapacity(initialInstructionCapacity(m_scopeNode));
+
     for (auto& constantRegister : m_linkTimeConstantRegisters)
         constantRegister = nullptr;
 
@@ -649,6 +665,8 @@ BytecodeGenerator::BytecodeGenerator(VM& vm, ModuleProgramNode* moduleProgramNod
 {
     ASSERT_UNUSED(parentScopeTDZVariables, !parentScopeTDZVariables->size());
 
+    m_instructions.reserveInitialCapacity(initialInstructionCapacity(m_scopeNode));
+
     for (auto& constantRegister : m_linkTimeConstantRegisters)
         constantRegister = nullptr;
 
@@ -1489,6 +1507,35 @@ RegisterID* BytecodeGenerator::emitMove(RegisterID* dst, RegisterID* src)
     ASSERT(src != m_emptyValueRegister);
 
     m_staticPropertyAnalyzer.mov(dst->index(), src->index());
+
+    // A register already holds itself.
+    if (dst->index() == src->index())
+        return dst;
+
+    if (m_lastOpcodeID == op_mov) {
+        int lastDstIndex;
+        int lastSrcIndex;
+        retrieveLastUnaryOp(lastDstIndex, lastSrcIndex);
+
+        // After "mov A, B", "mov B, A" is a no-op: no jump target can
+        // intervene (emitLabel resets m_lastOpcodeID), so B still holds the
+        // value A was loaded from.
+        if (lastDstIndex == src->index() && lastSrcIndex == dst->index())
+            return dst;
+
+        // Collapse "mov tmp, X; mov dst, tmp" into "mov dst, X" when tmp dies
+        // here, using the same deadness test as the compare/jump fusion above.
+        if (lastDstIndex == src->index() && src->isTemporary() && !src->refCount()) {
+            rewindUnaryOp();
+            if (lastSrcIndex == dst->index())
+                return dst;
+            emitOpcode(op_mov);
+            instructions().append(dst->index());
+            instructions().append(lastSrcIndex);
+            return dst;
+        }
+    }
+
     emitOpcode(op_mov);
     instructions().append(dst->index());
     instructions().append(src->index());
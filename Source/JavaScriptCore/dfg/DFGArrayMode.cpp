@@ -120,10 +120,26 @@ ArrayMode ArrayMode::fromObserved(const ConcurrentJITLocker& locker, ArrayProfil
     default:
         if ((observed & asArrayModes(NonArray)) && profile->mayInterceptIndexedAccesses(locker))
             return ArrayMode(Array::SelectUsingPredictions).withSpeculationFromProfile(locker, profile, makeSafe);
-        
+
         Array::Type type;
         Array::Class arrayClass;
-        
+
+        // A read that only sees Int32 and Contiguous shapes doesn't need to convert anything:
+        // both shapes store JSValues, so one fast path covers both. We only get here with a
+        // genuine mix, since uniform sites were handled above. Writes can't do this - they
+        // have to know whether the Int32 invariant is in play - so they convert as before.
+        if (action == Array::Read
+            && !(observed & ~(asArrayModes(NonArrayWithInt32) | asArrayModes(ArrayWithInt32) | asArrayModes(NonArrayWithContiguous) | asArrayModes(ArrayWithContiguous)))) {
+            if (hasSeenArray(observed) && hasSeenNonArray(observed))
+                arrayClass = Array::PossiblyArray;
+            else if (hasSeenArray(observed))
+                arrayClass = Array::Array;
+            else
+                arrayClass = nonArray;
+
+            return ArrayMode(Array::Int32OrContiguous, arrayClass, Array::AsIs).withSpeculationFromProfile(locker, profile, makeSafe);
+        }
+
         if (shouldUseSlowPutArrayStorage(observed))
             type = Array::SlowPutArrayStorage;
         else if (shouldUseFastArrayStorage(observed))
@@ -215,6 +231,7 @@ ArrayMode ArrayMode::refine(
         return withTypeAndConversion(Array::Contiguous, Array::Convert);
         
     case Array::Contiguous:
+    case Array::Int32OrContiguous:
         return *this;
 
     case Array::Int8Array:
@@ -411,7 +428,44 @@ bool ArrayMode::alreadyChecked(Graph& graph, Node* node, const AbstractValue& va
         
     case Array::Contiguous:
         return alreadyChecked(graph, node, value, ContiguousShape);
-        
+
+    case Array::Int32OrContiguous:
+        switch (arrayClass()) {
+        case Array::OriginalArray: {
+            CRASH();
+            return false;
+        }
+
+        case Array::Array: {
+            if (arrayModesAlreadyChecked(value.m_arrayModes, asArrayModes(ArrayWithInt32) | asArrayModes(ArrayWithContiguous)))
+                return true;
+            if (value.m_structure.isTop())
+                return false;
+            for (unsigned i = value.m_structure.size(); i--;) {
+                Structure* structure = value.m_structure[i];
+                IndexingType shape = structure->indexingType() & IndexingShapeMask;
+                if (shape != Int32Shape && shape != ContiguousShape)
+                    return false;
+                if (!(structure->indexingType() & IsArray))
+                    return false;
+            }
+            return true;
+        }
+
+        default: {
+            if (arrayModesAlreadyChecked(value.m_arrayModes, asArrayModes(NonArrayWithInt32) | asArrayModes(ArrayWithInt32) | asArrayModes(NonArrayWithContiguous) | asArrayModes(ArrayWithContiguous)))
+                return true;
+            if (value.m_structure.isTop())
+                return false;
+            for (unsigned i = value.m_structure.size(); i--;) {
+                Structure* structure = value.m_structure[i];
+                IndexingType shape = structure->indexingType() & IndexingShapeMask;
+                if (shape != Int32Shape && shape != ContiguousShape)
+                    return false;
+            }
+            return true;
+        } }
+
     case Array::ArrayStorage:
         return alreadyChecked(graph, node, value, ArrayStorageShape);
 
@@ -522,6 +576,8 @@ const char* arrayTypeToString(Array::Type type)
         return "Double";
     case Array::Contiguous:
         return "Contiguous";
+    case Array::Int32OrContiguous:
+        return "Int32OrContiguous";
     case Array::ArrayStorage:
         return "ArrayStorage";
     case Array::SlowPutArrayStorage:
@@ -697,6 +753,7 @@ bool permitsBoundsCheckLowering(Array::Type type)
     case Array::Int32:
     case Array::Double:
     case Array::Contiguous:
+    case Array::Int32OrContiguous:
     case Array::Int8Array:
     case Array::Int16Array:
     case Array::Int32Array:
@@ -63,6 +63,7 @@ enum Type {
     Int32,
     Double,
     Contiguous,
+    Int32OrContiguous, // Read-only access to storage that is either Int32 or Contiguous. Both shapes hold JSValues, so loads don't care which one we have; stores do, so writes never use this.
     ArrayStorage,
     SlowPutArrayStorage,
     
@@ -237,6 +238,7 @@ public:
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::ArrayStorage:
         case Array::SlowPutArrayStorage:
             return true;
@@ -244,7 +246,7 @@ public:
             return false;
         }
     }
-    
+
     bool isJSArray() const
     {
         switch (arrayClass()) {
@@ -315,6 +317,7 @@ public:
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::ArrayStorage:
         case Array::SlowPutArrayStorage:
             return true;
@@ -329,6 +332,7 @@ public:
         case Array::String:
         case Array::DirectArguments:
         case Array::ScopedArguments:
+        case Array::Int32OrContiguous: // Writes have to know which shape they have, so they can maintain the Int32 invariant.
             return ArrayMode(Array::Generic);
         default:
             return *this;
@@ -370,6 +374,7 @@ public:
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::ArrayStorage:
         case Array::SlowPutArrayStorage:
             return isJSArray();
@@ -419,6 +424,8 @@ public:
             return arrayModesWithIndexingShape(DoubleShape);
         case Array::Contiguous:
             return arrayModesWithIndexingShape(ContiguousShape);
+        case Array::Int32OrContiguous:
+            return arrayModesWithIndexingShapes(Int32Shape, ContiguousShape);
         case Array::ArrayStorage:
             return arrayModesWithIndexingShape(ArrayStorageShape);
         case Array::SlowPutArrayStorage:
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "DFGBlockLayoutPhase.h"
+
+#if ENABLE(DFG_JIT)
+
+#include "DFGBasicBlockInlines.h"
+#include "DFGGraph.h"
+#include "DFGPhase.h"
+#include "JSCInlines.h"
+
+namespace JSC { namespace DFG {
+
+class BlockLayoutPhase : public Phase {
+public:
+    BlockLayoutPhase(Graph& graph)
+        : Phase(graph, "block layout")
+    {
+    }
+
+    bool run()
+    {
+        // Partition the block list into hot blocks followed by cold blocks,
+        // preserving the relative order within each partition. This runs after
+        // all other phases, so nothing downstream depends on the old indices
+        // except the code generator's emission order, which is the point.
+        Vector<RefPtr<BasicBlock>, 8> hotBlocks;
+        Vector<RefPtr<BasicBlock>, 8> coldBlocks;
+
+        for (BlockIndex blockIndex = 0; blockIndex < m_graph.numBlocks(); ++blockIndex) {
+            RefPtr<BasicBlock> block = WTFMove(m_graph.m_blocks[blockIndex]);
+            if (!block)
+                continue;
+            if (isColdBlock(block.get()))
+                coldBlocks.append(WTFMove(block));
+            else
+                hotBlocks.append(WTFMove(block));
+        }
+
+        bool changed = !coldBlocks.isEmpty();
+
+        m_graph.m_blocks.resize(0);
+        for (auto& block : hotBlocks)
+            m_graph.m_blocks.append(WTFMove(block));
+        for (auto& block : coldBlocks)
+            m_graph.m_blocks.append(WTFMove(block));
+
+        for (BlockIndex blockIndex = 0; blockIndex < m_graph.numBlocks(); ++blockIndex)
+            m_graph.block(blockIndex)->index = blockIndex;
+
+        m_graph.invalidateCFG();
+
+        return changed;
+    }
+
+private:
+    bool isColdBlock(BasicBlock* block)
+    {
+        // The entry block must stay first: the prologue falls through into it.
+        if (!block->index)
+            return false;
+
+        // OSR entry data is collected in block list order and looked up by
+        // bytecode index, so keep entry targets in their original order.
+        if (block->isOSRTarget)
+            return false;
+
+        // Blocks that CFA proved unreachable are emitted as a breakpoint.
+        if (!block->intersectionOfCFAHasVisited)
+            return true;
+
+        // A block that ends in Unreachable never falls through: it throws,
+        // deoptimizes via ForceOSRExit, or aborts. These are the slow paths
+        // that were polluting the hot path's cache lines.
+        return block->terminal()->op() == Unreachable;
+    }
+};
+
+bool performBlockLayout(Graph& graph)
+{
+    SamplingRegion samplingRegion("DFG Block Layout Phase");
+    return runPhase<BlockLayoutPhase>(graph);
+}
+
+} } // namespace JSC::DFG
+
+#endif // ENABLE(DFG_JIT)
@@ -237,6 +237,19 @@ void clobberize(Graph& graph, Node* node, const ReadFunctor& read, const WriteFu
             return;
         }
 
+        case Array::Int32OrContiguous: {
+            // No def: a HeapLocation names one heap, and this result would have to be
+            // invalidated by writes to either of them.
+            if (mode.isInBounds()) {
+                read(Butterfly_publicLength);
+                read(IndexedInt32Properties);
+                read(IndexedContiguousProperties);
+                return;
+            }
+            read(Heap);
+            return;
+        }
+
         case Array::ArrayStorage: {
             if (mode.isInBounds()) {
                 read(Butterfly_vectorLength);
@@ -597,6 +610,19 @@ void clobberize(Graph& graph, Node* node, const ReadFunctor& read, const WriteFu
             write(Heap);
             return;
 
+        case Array::Int32OrContiguous:
+            // No def: a HeapLocation names one heap, and this load would have to be
+            // invalidated by writes to either of them.
+            if (mode.isInBounds()) {
+                read(Butterfly_publicLength);
+                read(IndexedInt32Properties);
+                read(IndexedContiguousProperties);
+                return;
+            }
+            read(World);
+            write(Heap);
+            return;
+
         case Array::Undecided:
             def(PureValue(node));
             return;
@@ -875,6 +901,7 @@ void clobberize(Graph& graph, Node* node, const ReadFunctor& read, const WriteFu
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::ArrayStorage:
         case Array::SlowPutArrayStorage:
             read(Butterfly_publicLength);
@@ -30,6 +30,7 @@
 
 #include "DFGArgumentsEliminationPhase.h"
 #include "DFGBackwardsPropagationPhase.h"
+#include "DFGBlockLayoutPhase.h"
 #include "DFGByteCodeParser.h"
 #include "DFGCFAPhase.h"
 #include "DFGCFGSimplificationPhase.h"
@@ -363,6 +364,7 @@ Plan::CompilationPath Plan::compileInThreadImpl(LongLivedState& longLivedState)
         performStackLayout(dfg);
         performVirtualRegisterAllocation(dfg);
         performWatchpointCollection(dfg);
+        performBlockLayout(dfg);
         dumpAndVerifyGraph(dfg, "Graph after optimization:");
         
         JITCompiler dataFlowJIT(dfg);
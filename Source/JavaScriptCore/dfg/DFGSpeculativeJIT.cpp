@@ -719,6 +719,24 @@ JITCompiler::JumpList SpeculativeJIT::jumpSlowForUnwantedArrayMode(GPRReg tempGP
     case Array::Undecided:
         return jumpSlowForUnwantedArrayMode(tempGPR, arrayMode, UndecidedShape);
 
+    case Array::Int32OrContiguous: {
+        ASSERT(!arrayMode.isJSArrayWithOriginalStructure());
+
+        int32_t mask = IsArray | IndexingShapeMask;
+        int32_t expected = arrayMode.isJSArray() ? IsArray : 0;
+        if (arrayMode.arrayClass() == Array::PossiblyArray)
+            mask = IndexingShapeMask;
+
+        m_jit.and32(TrustedImm32(mask), tempGPR);
+        JITCompiler::Jump isInt32 = m_jit.branch32(
+            MacroAssembler::Equal, tempGPR, TrustedImm32(expected | Int32Shape));
+        result.append(
+            m_jit.branch32(
+                MacroAssembler::NotEqual, tempGPR, TrustedImm32(expected | ContiguousShape)));
+        isInt32.link(&m_jit);
+        break;
+    }
+
     case Array::ArrayStorage:
     case Array::SlowPutArrayStorage: {
         ASSERT(!arrayMode.isJSArrayWithOriginalStructure());
@@ -785,6 +803,7 @@ void SpeculativeJIT::checkArray(Node* node)
     case Array::Int32:
     case Array::Double:
     case Array::Contiguous:
+    case Array::Int32OrContiguous:
     case Array::Undecided:
     case Array::ArrayStorage:
     case Array::SlowPutArrayStorage: {
@@ -5403,7 +5422,8 @@ void SpeculativeJIT::compileGetArrayLength(Node* node)
     switch (node->arrayMode().type()) {
     case Array::Int32:
     case Array::Double:
-    case Array::Contiguous: {
+    case Array::Contiguous:
+    case Array::Int32OrContiguous: {
         StorageOperand storage(this, node->child2());
         GPRTemporary result(this, Reuse, storage);
         GPRReg storageReg = storage.gpr();
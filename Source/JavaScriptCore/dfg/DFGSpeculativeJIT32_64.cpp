@@ -2440,19 +2440,20 @@ void SpeculativeJIT::compile(Node* node)
             break;
         }
         case Array::Int32:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             if (node->arrayMode().isInBounds()) {
                 SpeculateStrictInt32Operand property(this, node->child2());
                 StorageOperand storage(this, node->child3());
-            
+
                 GPRReg propertyReg = property.gpr();
                 GPRReg storageReg = storage.gpr();
-            
+
                 if (!m_compileOkay)
                     return;
-            
+
                 speculationCheck(OutOfBounds, JSValueRegs(), 0, m_jit.branch32(MacroAssembler::AboveOrEqual, propertyReg, MacroAssembler::Address(storageReg, Butterfly::offsetOfPublicLength())));
-            
+
                 GPRTemporary resultPayload(this);
                 if (node->arrayMode().type() == Array::Int32) {
                     ASSERT(!node->arrayMode().isSaneChain());
@@ -4545,11 +4546,12 @@ void SpeculativeJIT::compile(Node* node)
         ArrayMode mode = node->arrayMode();
         switch (mode.type()) {
         case Array::Int32:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             ASSERT(!!node->child3());
             StorageOperand storage(this, node->child3());
             GPRTemporary scratch(this);
-            
+
             GPRReg storageGPR = storage.gpr();
             GPRReg scratchGPR = scratch.gpr();
 
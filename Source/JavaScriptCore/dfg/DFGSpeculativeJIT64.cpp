@@ -2577,11 +2577,12 @@ void SpeculativeJIT::compile(Node* node)
             break;
         }
         case Array::Int32:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             if (node->arrayMode().isInBounds()) {
                 SpeculateStrictInt32Operand property(this, node->child2());
                 StorageOperand storage(this, node->child3());
-                
+
                 GPRReg propertyReg = property.gpr();
                 GPRReg storageReg = storage.gpr();
                 
@@ -4594,11 +4595,12 @@ void SpeculativeJIT::compile(Node* node)
         ArrayMode mode = node->arrayMode();
         switch (mode.type()) {
         case Array::Int32:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             ASSERT(!!node->child3());
             StorageOperand storage(this, node->child3());
             GPRTemporary scratch(this);
-            
+
             GPRReg storageGPR = storage.gpr();
             GPRReg scratchGPR = scratch.gpr();
 
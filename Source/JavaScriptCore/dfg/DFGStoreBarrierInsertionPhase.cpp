@@ -34,6 +34,7 @@
 #include "DFGGraph.h"
 #include "DFGInPlaceAbstractState.h"
 #include "DFGInsertionSet.h"
+#include "DFGNaturalLoops.h"
 #include "DFGPhase.h"
 #include "JSCInlines.h"
 #include <wtf/CommaPrinter.h>
@@ -149,12 +150,26 @@ public:
                 }
             }
             
-            // Tell handleBlock() that it's time to actually insert barriers for real.
+            // Tell handleBlock() that it's time to actually insert barriers for real. The
+            // insertion pass will hoist barriers that would land inside a GC-free loop up to
+            // the loop's pre-header, so it needs loop structure.
+            m_graph.ensureNaturalLoops();
+            m_loopData.resize(m_graph.m_naturalLoops->numLoops());
             m_isConverged = true;
-            
+
             for (BasicBlock* block : m_graph.blocksInNaturalOrder())
                 handleBlock(block);
-            
+
+            // Materialize the hoisted barriers now that the insertion sets of all blocks
+            // have run, so the pre-headers' node indices are stable.
+            for (auto& hoist : m_hoistedBarriers) {
+                BasicBlock* preHeader = hoist.first;
+                Node* barrier = m_graph.addNode(
+                    SpecNone, StoreBarrier, preHeader->terminal()->origin,
+                    Edge(hoist.second, CellUse));
+                preHeader->insertBeforeTerminal(barrier);
+            }
+
             return true;
         } }
         
@@ -171,8 +186,9 @@ private:
                 dataLog("    Really inserting barriers.\n");
         }
         
+        m_block = block;
         m_currentEpoch = Epoch::first();
-        
+
         if (mode == PhaseMode::Global) {
             if (!block->cfaHasVisited)
                 return false;
@@ -479,9 +495,101 @@ private:
         
         if (verbose)
             dataLog("            Inserting barrier.\n");
+        if (tryHoistBarrier(base))
+            return;
         insertBarrier(m_nodeIndex, base);
     }
 
+    bool tryHoistBarrier(Edge base)
+    {
+        if (mode != PhaseMode::Global || !m_isConverged)
+            return false;
+
+        // A barrier executed in a loop's pre-header keeps the object remembered for as long
+        // as nothing in the loop triggers a GC. So, if this store sits in a GC-free loop and
+        // the stored-to object is available before the loop, the barrier can run once ahead
+        // of the loop rather than once per iteration.
+        if (!isCellSpeculation(base->prediction())) {
+            // The hoisted barrier speculates cell at the pre-header, where the store's own
+            // cell check has not run yet; don't risk exiting on a value the store would
+            // never have seen.
+            return false;
+        }
+
+        BasicBlock* target = nullptr;
+        for (const NaturalLoop* loop = m_graph.m_naturalLoops->innerMostLoopOf(m_block); loop;
+            loop = m_graph.m_naturalLoops->innerMostOuterLoop(*loop)) {
+            LoopData& data = dataForLoop(loop);
+            if (!data.isGCFree) {
+                // Any outer loop contains this one, so it cannot be GC-free either.
+                break;
+            }
+            if (data.preHeader && data.preHeader->ssa->liveAtTail.contains(base.node())) {
+                // Keep looking outward; the outermost qualifying pre-header executes the
+                // fewest times.
+                target = data.preHeader;
+            }
+        }
+        if (!target)
+            return false;
+
+        if (verbose)
+            dataLog("            Hoisting barrier on ", base, " to ", pointerDump(target), "\n");
+
+        m_hoistedBarriers.add(std::make_pair(target, base.node()));
+        base->setEpoch(m_currentEpoch);
+        return true;
+    }
+
+    struct LoopData {
+        bool computed { false };
+        bool isGCFree { false };
+        BasicBlock* preHeader { nullptr };
+    };
+
+    LoopData& dataForLoop(const NaturalLoop* loop)
+    {
+        LoopData& data = m_loopData[loop->index()];
+        if (data.computed)
+            return data;
+        data.computed = true;
+
+        for (unsigned i = loop->size(); i--;) {
+            BasicBlock* block = loop->at(i);
+            for (unsigned nodeIndex = block->size(); nodeIndex--;) {
+                if (doesGC(m_graph, block->at(nodeIndex)))
+                    return data;
+            }
+        }
+        data.isGCFree = true;
+
+        // Find the pre-header the way LICM does: the unique non-backedge predecessor of the
+        // header. Loops that are reachable some other way - for example through an OSR entry
+        // block - have no unique pre-header and are not eligible.
+        BasicBlock* header = loop->header();
+        BasicBlock* preHeader = nullptr;
+        unsigned numberOfPreHeaders = 0;
+        for (unsigned i = header->predecessors.size(); i--;) {
+            BasicBlock* predecessor = header->predecessors[i];
+            if (m_graph.m_dominators->dominates(header, predecessor))
+                continue;
+            preHeader = predecessor;
+            ++numberOfPreHeaders;
+        }
+        if (numberOfPreHeaders != 1)
+            return data;
+        if (preHeader->terminal()->op() != Jump)
+            return data;
+        if (!preHeader->terminal()->origin.exitOK) {
+            // The hoisted barrier carries a cell check, so we must be allowed to exit from
+            // the point where it lands.
+            return data;
+        }
+
+        data.preHeader = preHeader;
+        return data;
+    }
+
     void insertBarrier(unsigned nodeIndex, Edge base, bool exitOK = true)
     {
         // If we're in global mode, we should only insert the barriers once we have converged.
@@ -515,12 +623,15 @@ private:
     Epoch m_currentEpoch;
     unsigned m_nodeIndex;
     Node* m_node;
-    
+    BasicBlock* m_block;
+
     // Things we only use in Global mode.
     std::unique_ptr<InPlaceAbstractState> m_state;
     std::unique_ptr<AbstractInterpreter<InPlaceAbstractState>> m_interpreter;
     std::unique_ptr<BlockMap<HashSet<Node*>>> m_stateAtHead;
     std::unique_ptr<BlockMap<HashSet<Node*>>> m_stateAtTail;
+    Vector<LoopData> m_loopData;
+    HashSet<std::pair<BasicBlock*, Node*>> m_hoistedBarriers;
     bool m_isConverged;
 };
 
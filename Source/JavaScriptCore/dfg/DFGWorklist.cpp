@@ -96,7 +96,13 @@ void Worklist::enqueue(PassRefPtr<Plan> passedPlan)
     }
     ASSERT(m_plans.find(plan->key()) == m_plans.end());
     m_plans.add(plan->key(), plan);
-    m_queue.append(plan);
+    // A plan with an OSR entry target means the mutator is spinning in a hot loop right
+    // now waiting to tier up, so it jumps the queue ahead of ordinary threshold-triggered
+    // compiles.
+    if (plan->osrEntryBytecodeIndex != UINT_MAX)
+        m_queue.prepend(plan);
+    else
+        m_queue.append(plan);
     m_planEnqueued.notifyOne();
 }
 
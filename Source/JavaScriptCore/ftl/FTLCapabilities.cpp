@@ -254,6 +254,7 @@ inline CapabilityLevel canCompile(Node* node)
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::DirectArguments:
         case Array::ScopedArguments:
             break;
@@ -268,6 +269,7 @@ inline CapabilityLevel canCompile(Node* node)
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::String:
         case Array::DirectArguments:
         case Array::ScopedArguments:
@@ -284,6 +286,7 @@ inline CapabilityLevel canCompile(Node* node)
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
             break;
         default:
             return CannotCompile;
@@ -297,6 +300,7 @@ inline CapabilityLevel canCompile(Node* node)
         case Array::Int32:
         case Array::Double:
         case Array::Contiguous:
+        case Array::Int32OrContiguous:
         case Array::Undecided:
         case Array::DirectArguments:
         case Array::ScopedArguments:
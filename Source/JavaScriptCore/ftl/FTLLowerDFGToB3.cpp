@@ -2465,7 +2465,8 @@ private:
         switch (m_node->arrayMode().type()) {
         case Array::Int32:
         case Array::Double:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             setInt32(m_out.load32NonNegative(lowStorage(m_node->child2()), m_heaps.Butterfly_publicLength));
             return;
         }
@@ -2517,15 +2518,28 @@ private:
     {
         switch (m_node->arrayMode().type()) {
         case Array::Int32:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             LValue index = lowInt32(m_node->child2());
             LValue storage = lowStorage(m_node->child3());
-            
-            IndexedAbstractHeap& heap = m_node->arrayMode().type() == Array::Int32 ?
-                m_heaps.indexedInt32Properties : m_heaps.indexedContiguousProperties;
-            
+
+            TypedPointer elementPointer;
+            switch (m_node->arrayMode().type()) {
+            case Array::Int32:
+                elementPointer = baseIndex(m_heaps.indexedInt32Properties, storage, index, m_node->child2());
+                break;
+            case Array::Contiguous:
+                elementPointer = baseIndex(m_heaps.indexedContiguousProperties, storage, index, m_node->child2());
+                break;
+            default:
+                // Int32OrContiguous may load from either indexed heap, and a TypedPointer
+                // names just one, so decorate the load with the most conservative heap.
+                elementPointer = m_out.baseIndex(m_heaps.root, storage, m_out.zeroExtPtr(index), ScaleEight);
+                break;
+            }
+
             if (m_node->arrayMode().isInBounds()) {
-                LValue result = m_out.load64(baseIndex(heap, storage, index, m_node->child2()));
+                LValue result = m_out.load64(elementPointer);
                 LValue isHole = m_out.isZero64(result);
                 if (m_node->arrayMode().isSaneChain()) {
                     DFG_ASSERT(
@@ -2551,7 +2565,7 @@ private:
             
             LBasicBlock lastNext = m_out.appendTo(fastCase, slowCase);
 
-            LValue fastResultValue = m_out.load64(baseIndex(heap, storage, index, m_node->child2()));
+            LValue fastResultValue = m_out.load64(elementPointer);
             ValueFromBlock fastResult = m_out.anchor(fastResultValue);
             m_out.branch(
                 m_out.isZero64(fastResultValue), rarely(slowCase), usually(continuation));
@@ -5992,13 +6006,26 @@ private:
     {
         switch (m_node->arrayMode().type()) {
         case Array::Int32:
-        case Array::Contiguous: {
+        case Array::Contiguous:
+        case Array::Int32OrContiguous: {
             LValue base = lowCell(m_node->child1());
             LValue index = lowInt32(m_node->child2());
             LValue storage = lowStorage(m_node->child3());
 
-            IndexedAbstractHeap& heap = m_node->arrayMode().type() == Array::Int32 ?
-                m_heaps.indexedInt32Properties : m_heaps.indexedContiguousProperties;
+            TypedPointer elementPointer;
+            switch (m_node->arrayMode().type()) {
+            case Array::Int32:
+                elementPointer = baseIndex(m_heaps.indexedInt32Properties, storage, index, m_node->child2());
+                break;
+            case Array::Contiguous:
+                elementPointer = baseIndex(m_heaps.indexedContiguousProperties, storage, index, m_node->child2());
+                break;
+            default:
+                // Int32OrContiguous may load from either indexed heap, and a TypedPointer
+                // names just one, so decorate the load with the most conservative heap.
+                elementPointer = m_out.baseIndex(m_heaps.root, storage, m_out.zeroExtPtr(index), ScaleEight);
+                break;
+            }
 
             LBasicBlock checkHole = m_out.newBlock();
             LBasicBlock slowCase = m_out.newBlock();
@@ -6014,7 +6041,7 @@ private:
 
             LBasicBlock lastNext = m_out.appendTo(checkHole, slowCase);
             LValue checkHoleResultValue =
-                m_out.notZero64(m_out.load64(baseIndex(heap, storage, index, m_node->child2())));
+                m_out.notZero64(m_out.load64(elementPointer));
             ValueFromBlock checkHoleResult = m_out.anchor(checkHoleResultValue);
             m_out.branch(checkHoleResultValue, usually(continuation), rarely(slowCase));
 
@@ -9542,7 +9569,23 @@ private:
             
             DFG_CRASH(m_graph, m_node, "Corrupt array class");
         }
-            
+
+        case Array::Int32OrContiguous: {
+            LValue indexingType = m_out.load8ZeroExt32(cell, m_heaps.JSCell_indexingType);
+
+            int32_t mask = IsArray | IndexingShapeMask;
+            int32_t expected = arrayMode.isJSArray() ? IsArray : 0;
+            if (arrayMode.arrayClass() == Array::PossiblyArray)
+                mask = IndexingShapeMask;
+            if (arrayMode.arrayClass() == Array::OriginalArray)
+                DFG_CRASH(m_graph, m_node, "Unexpected original array");
+
+            LValue maskedType = m_out.bitAnd(indexingType, m_out.constInt32(mask));
+            return m_out.bitOr(
+                m_out.equal(maskedType, m_out.constInt32(expected | Int32Shape)),
+                m_out.equal(maskedType, m_out.constInt32(expected | ContiguousShape)));
+        }
+
         case Array::DirectArguments:
             return m_out.equal(
                 m_out.load8ZeroExt32(cell, m_heaps.JSCell_typeInfoType),
@@ -36,6 +36,12 @@
 
 namespace JSC { namespace FTL {
 
+// This emits the only code an exit costs at compile time: a push of the exit
+// index and a patchable jump to the VM-shared generation stub
+// (osrExitGenerationThunkGenerator, cached via getCTIStub). The stub calls
+// compileFTLOSRExit on the first time the exit fires, which compiles the real
+// exit ramp and repatches the jump to it, so exits that never fire never get
+// code beyond these two instructions.
 void OSRExitHandle::emitExitThunk(State& state, CCallHelpers& jit)
 {
     Profiler::Compilation* compilation = state.graph.compilation();
@@ -196,12 +196,9 @@ void CopiedSpace::doneFillingBlock(CopiedBlock* block, CopiedBlock** exchange)
         m_oldGen.blockFilter.add(reinterpret_cast<Bits>(block));
     }
 
-    {
-        LockHolder locker(m_loanedBlocksLock);
-        ASSERT(m_numberOfLoanedBlocks > 0);
-        ASSERT(m_inCopyingPhase);
-        m_numberOfLoanedBlocks--;
-    }
+    ASSERT(m_numberOfLoanedBlocks > 0);
+    ASSERT(m_inCopyingPhase);
+    m_numberOfLoanedBlocks--;
 }
 
 void CopiedSpace::didStartFullCollection()
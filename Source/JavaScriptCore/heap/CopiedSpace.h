@@ -29,6 +29,7 @@
 #include "CopiedAllocator.h"
 #include "HeapOperation.h"
 #include "TinyBloomFilter.h"
+#include <atomic>
 #include <wtf/Assertions.h>
 #include <wtf/CheckedBoolean.h>
 #include <wtf/DoublyLinkedList.h>
@@ -132,8 +133,9 @@ private:
     bool m_inCopyingPhase;
     bool m_shouldDoCopyPhase;
 
-    Lock m_loanedBlocksLock;
-    size_t m_numberOfLoanedBlocks;
+    // Accounted with atomics so that copying-phase threads returning or borrowing blocks
+    // don't serialize on a shared lock.
+    std::atomic<size_t> m_numberOfLoanedBlocks;
     
     size_t m_bytesRemovedFromOldSpaceDueToReallocation;
 
@@ -111,12 +111,9 @@ inline void CopiedSpace::recycleBorrowedBlock(CopiedBlock* block)
 {
     CopiedBlock::destroy(*heap(), block);
 
-    {
-        LockHolder locker(m_loanedBlocksLock);
-        ASSERT(m_numberOfLoanedBlocks > 0);
-        ASSERT(m_inCopyingPhase);
-        m_numberOfLoanedBlocks--;
-    }
+    ASSERT(m_numberOfLoanedBlocks > 0);
+    ASSERT(m_inCopyingPhase);
+    m_numberOfLoanedBlocks--;
 }
 
 inline CopiedBlock* CopiedSpace::allocateBlockForCopyingPhase()
@@ -124,10 +121,7 @@ inline CopiedBlock* CopiedSpace::allocateBlockForCopyingPhase()
     ASSERT(m_inCopyingPhase);
     CopiedBlock* block = CopiedBlock::createNoZeroFill(*m_heap);
 
-    {
-        LockHolder locker(m_loanedBlocksLock);
-        m_numberOfLoanedBlocks++;
-    }
+    m_numberOfLoanedBlocks++;
 
     ASSERT(!block->dataSize());
     return block;
@@ -34,6 +34,7 @@
 #include "JSObject.h"
 #include "VM.h"
 
+#include <wtf/CurrentTime.h>
 #include <wtf/RetainPtr.h>
 #include <wtf/WTFThreadData.h>
 
@@ -129,12 +130,14 @@ void GCActivityCallback::scheduleTimer(double newDelay)
     if (newDelay * timerSlop > m_delay)
         return;
     m_delay = newDelay;
+    m_nextFireTime = WTF::currentTime() + newDelay;
     m_timer.start(newDelay * 1000, this);
 }
 
 void GCActivityCallback::cancelTimer()
 {
     m_delay = s_hour;
+    m_nextFireTime = 0;
     m_timer.stop();
 }
 #elif USE(GLIB)
@@ -145,6 +148,7 @@ void GCActivityCallback::scheduleTimer(double newDelay)
         return;
 
     m_delay = newDelay;
+    m_nextFireTime = WTF::currentTime() + newDelay;
     if (!m_delay) {
         g_source_set_ready_time(m_timer.get(), 0);
         return;
@@ -163,6 +167,7 @@ void GCActivityCallback::scheduleTimer(double newDelay)
 void GCActivityCallback::cancelTimer()
 {
     m_delay = -1;
+    m_nextFireTime = 0;
     g_source_set_ready_time(m_timer.get(), -1);
 }
 #endif
@@ -65,6 +65,12 @@ public:
     double nextFireTime() const { return m_nextFireTime; }
 #endif
 
+#if USE(CF) || USE(GLIB) || PLATFORM(QT)
+    // True when allocation since the last collection has armed the timer, meaning a
+    // collection of this type is already due to run in the near future.
+    bool isScheduled() const { return !!m_nextFireTime; }
+#endif
+
 protected:
     virtual double lastGCLength() = 0;
     virtual double gcTimeSlice(size_t bytes) = 0;
@@ -53,6 +53,7 @@
 #include <wtf/ParallelVectorIterator.h>
 #include <wtf/ProcessID.h>
 #include <wtf/RAMSize.h>
+#include <wtf/SystemTracing.h>
 
 using namespace std;
 
@@ -549,6 +550,7 @@ void Heap::markRoots(double gcStartTime, void* stackOrigin, void* stackTop, Mach
     clearLivenessData();
 
     m_parallelMarkersShouldExit = false;
+    m_mutatorShouldReGreyDuringMarking = Options::useConcurrentMarking();
 
     m_helperClient.setFunction(
         [this] () {
@@ -597,8 +599,18 @@ void Heap::markRoots(double gcStartTime, void* stackOrigin, void* stackTop, Mach
         visitSamplingProfiler();
         traceCodeBlocksAndJITStubRoutines();
         converge();
+
+        // Objects the store barrier re-greyed while marking was in flight get rescanned
+        // until we reach a fixpoint. With the mutator stopped this terminates after one
+        // extra pass at most; once the mutator runs concurrently it's a genuine wavefront.
+        while (m_mutatorShouldReGreyDuringMarking && drainMutatorMarkStack())
+            converge();
     }
 
+    // It's safe to drop the barrier back to its generational form here because the
+    // mutator is stopped until marking is over.
+    m_mutatorShouldReGreyDuringMarking = false;
+
     // Weak references must be marked last because their liveness depends on
     // the liveness of the rest of the object graph.
     visitWeakHandles(heapRootVisitor);
@@ -1022,6 +1034,27 @@ void Heap::addToRememberedSet(const JSCell* cell)
     m_slotVisitor.appendToMarkStack(const_cast<JSCell*>(cell));
 }
 
+void Heap::addToMutatorMarkStack(const JSCell* cell)
+{
+    ASSERT(cell);
+    ASSERT(cell->cellState() == CellState::OldBlack);
+    cell->setCellState(CellState::OldGrey);
+    LockHolder locker(m_mutatorMarkStackLock);
+    m_mutatorMarkStack.append(cell);
+}
+
+bool Heap::drainMutatorMarkStack()
+{
+    Vector<const JSCell*> cells;
+    {
+        LockHolder locker(m_mutatorMarkStackLock);
+        cells.swap(m_mutatorMarkStack);
+    }
+    for (const JSCell* cell : cells)
+        m_slotVisitor.appendToMarkStack(const_cast<JSCell*>(cell));
+    return !cells.isEmpty();
+}
+
 void* Heap::copyBarrier(const JSCell*, void*& pointer)
 {
     // Do nothing for now, except making sure that the low bits are masked off. This helps to
@@ -1048,6 +1081,27 @@ void Heap::collectAndSweep(HeapOperation collectionType)
     sweepAllLogicallyEmptyWeakBlocks();
 }
 
+void Heap::collectDuringIdlePeriod(double deadline)
+{
+    if (!m_isSafeToCollect || isDeferred() || m_operationInProgress != NoOperation)
+        return;
+
+#if USE(CF) || USE(GLIB) || PLATFORM(QT)
+    // An eden collection only pays off here if one is coming anyway: the eden timer being
+    // armed means allocation has already scheduled one. Predict its pause from the last
+    // eden collection (allocation behavior changes slowly between frames) and run it now
+    // if the prediction fits the interval, so the timer doesn't fire mid-frame instead.
+    if (m_edenActivityCallback && m_edenActivityCallback->isScheduled()
+        && WTF::monotonicallyIncreasingTime() + m_lastEdenGCLength <= deadline)
+        collect(EdenCollection);
+#endif
+
+    // Whatever remains of the interval goes to retiring not-yet-swept blocks; the sweeper
+    // meters that with its own per-block cost estimate.
+    if (m_sweeper)
+        m_sweeper->sweepUntil(deadline);
+}
+
 NEVER_INLINE void Heap::collect(HeapOperation collectionType)
 {
     void* stackTop;
@@ -1086,6 +1140,9 @@ NEVER_INLINE void Heap::collectImpl(HeapOperation collectionType, void* stackOri
 
     suspendCompilerThreads();
     willStartCollection(collectionType);
+    TraceScope traceScope(
+        m_operationInProgress == FullCollection ? GCFullCollectionStart : GCEdenCollectionStart,
+        m_operationInProgress == FullCollection ? GCFullCollectionEnd : GCEdenCollectionEnd);
     GCPHASE(Collect);
 
     double gcStartTime = WTF::monotonicallyIncreasingTime();
@@ -1124,6 +1181,9 @@ NEVER_INLINE void Heap::collectImpl(HeapOperation collectionType, void* stackOri
     removeDeadCompilerWorklistEntries();
     deleteUnmarkedCompiledCode();
     deleteSourceProviderCaches();
+    // Sweeping may recycle structure IDs and release identifiers, so stale keys must
+    // not survive the collection.
+    m_vm->megamorphicGetByIdCache.clear();
     notifyIncrementalSweeper();
     writeBarrierCurrentlyExecutingCodeBlocks();
 
@@ -170,6 +170,10 @@ public:
     JS_EXPORT_PRIVATE void collect(HeapOperation collectionType = AnyCollection);
     bool collectIfNecessaryOrDefer(); // Returns true if it did collect.
 
+    // Runs already-pending collection work inside an idle interval reported by the embedder.
+    // The deadline is on the WTF::monotonicallyIncreasingTime() scale.
+    JS_EXPORT_PRIVATE void collectDuringIdlePeriod(double deadline);
+
     void completeAllDFGPlans();
     
     // Use this API to report non-GC memory referenced by GC objects. Be sure to
@@ -336,6 +340,8 @@ private:
     void clearUnmarkedExecutables();
     void deleteUnmarkedCompiledCode();
     JS_EXPORT_PRIVATE void addToRememberedSet(const JSCell*);
+    JS_EXPORT_PRIVATE void addToMutatorMarkStack(const JSCell*);
+    bool drainMutatorMarkStack();
     void updateAllocationLimits();
     void didFinishCollection(double gcStartTime);
     void resumeCompilerThreads();
@@ -445,6 +451,13 @@ private:
     unsigned m_numberOfWaitingParallelMarkers { 0 };
     bool m_parallelMarkersShouldExit { false };
 
+    // When Options::useConcurrentMarking() is set, stores into black objects re-grey the
+    // object onto this stack instead of the collector's own mark stack, so that the barrier
+    // stays safe once the mutator runs during the drain. See writeBarrier() in HeapInlines.h.
+    Lock m_mutatorMarkStackLock;
+    Vector<const JSCell*> m_mutatorMarkStack;
+    bool m_mutatorShouldReGreyDuringMarking { false };
+
     Lock m_opaqueRootsMutex;
     HashSet<void*> m_opaqueRoots;
 
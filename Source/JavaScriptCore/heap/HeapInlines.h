@@ -107,6 +107,13 @@ inline void Heap::writeBarrier(const JSCell* from, JSCell* to)
 #endif
     if (!from || from->cellState() != CellState::OldBlack)
         return;
+    if (UNLIKELY(m_mutatorShouldReGreyDuringMarking)) {
+        // Retreating wavefront: any store into a black object while marking is in flight
+        // must re-grey the object so the collector rescans it, regardless of the target's
+        // generation.
+        addToMutatorMarkStack(from);
+        return;
+    }
     if (!to || to->cellState() != CellState::NewWhite)
         return;
     addToRememberedSet(from);
@@ -117,6 +124,10 @@ inline void Heap::writeBarrier(const JSCell* from)
     ASSERT_GC_OBJECT_LOOKS_VALID(const_cast<JSCell*>(from));
     if (!from || from->cellState() != CellState::OldBlack)
         return;
+    if (UNLIKELY(m_mutatorShouldReGreyDuringMarking)) {
+        addToMutatorMarkStack(from);
+        return;
+    }
     addToRememberedSet(from);
 }
 
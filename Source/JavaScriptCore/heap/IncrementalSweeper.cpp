@@ -131,8 +131,13 @@ void IncrementalSweeper::doWork()
 
 void IncrementalSweeper::doSweep(double sweepBeginTime)
 {
+    double blockBeginTime = sweepBeginTime;
     while (sweepNextBlock()) {
-        double elapsedTime = WTF::monotonicallyIncreasingTime() - sweepBeginTime;
+        double now = WTF::monotonicallyIncreasingTime();
+        updateBlockSweepCostEstimate(now - blockBeginTime);
+        blockBeginTime = now;
+
+        double elapsedTime = now - sweepBeginTime;
         if (elapsedTime < sweepTimeSlice)
             continue;
 
@@ -144,6 +149,30 @@ void IncrementalSweeper::doSweep(double sweepBeginTime)
     cancelTimer();
 }
 
+bool IncrementalSweeper::sweepUntil(double deadline)
+{
+    while (WTF::monotonicallyIncreasingTime() + m_estimatedBlockSweepCost <= deadline) {
+        double blockBeginTime = WTF::monotonicallyIncreasingTime();
+        if (!sweepNextBlock()) {
+            m_blocksToSweep.clear();
+            cancelTimer();
+            return true;
+        }
+        updateBlockSweepCostEstimate(WTF::monotonicallyIncreasingTime() - blockBeginTime);
+    }
+    return false;
+}
+
+void IncrementalSweeper::updateBlockSweepCostEstimate(double cost)
+{
+    // Exponentially-weighted average biased toward recent blocks, since sweep cost tracks
+    // the mix of cell sizes in whatever the program just allocated.
+    if (!m_estimatedBlockSweepCost)
+        m_estimatedBlockSweepCost = cost;
+    else
+        m_estimatedBlockSweepCost = 0.75 * m_estimatedBlockSweepCost + 0.25 * cost;
+}
+
 bool IncrementalSweeper::sweepNextBlock()
 {
     while (!m_blocksToSweep.isEmpty()) {
@@ -197,6 +226,11 @@ bool IncrementalSweeper::sweepNextBlock()
     return false;
 }
 
+bool IncrementalSweeper::sweepUntil(double)
+{
+    return true;
+}
+
 #endif
 
 } // namespace JSC
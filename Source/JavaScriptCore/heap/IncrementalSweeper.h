@@ -49,13 +49,21 @@ public:
     bool sweepNextBlock();
     void willFinishSweeping();
 
+    // Sweeps until either no sweeping remains or the monotonic clock would pass the given
+    // deadline (seconds, on the WTF::monotonicallyIncreasingTime() scale), using a running
+    // estimate of per-block sweep cost to avoid starting a block that won't fit. Returns
+    // true once sweeping is complete. Intended to be driven from an embedder idle callback.
+    JS_EXPORT_PRIVATE bool sweepUntil(double deadline);
+
 #if USE(CF) || PLATFORM(EFL) || USE(GLIB) || PLATFORM(QT)
 private:
     void doSweep(double startTime);
+    void updateBlockSweepCostEstimate(double cost);
     void scheduleTimer();
     void cancelTimer();
     
     Vector<MarkedBlock*>& m_blocksToSweep;
+    double m_estimatedBlockSweepCost { 0 };
 #endif
 };
 
@@ -59,8 +59,48 @@ bool MarkedAllocator::isPagedOut(double deadline)
     return false;
 }
 
+// The number of cells from a bump interval that we link onto the free list at a time.
+// The inline allocation paths, including the JIT's, only understand the free list, so
+// cells must be on it to be allocated inline; threading them in batches keeps most
+// allocations on those paths while only touching a batch worth of cold cells at once.
+static const size_t bumpAllocationBatchCells = 64;
+
+MarkedBlock::FreeList MarkedAllocator::threadBumpInterval()
+{
+    ASSERT(m_currentBlock);
+    ASSERT(m_bumpCursor && m_bumpCursor != m_bumpEnd);
+
+    size_t cellSize = m_currentBlock->cellSize();
+    size_t cellCount = std::min(bumpAllocationBatchCells, static_cast<size_t>(m_bumpEnd - m_bumpCursor) / cellSize);
+
+    // Thread the batch in reverse so that cells pop off the list in address order.
+    MarkedBlock::FreeCell* head = 0;
+    for (size_t i = cellCount; i--;) {
+        MarkedBlock::FreeCell* freeCell = reinterpret_cast<MarkedBlock::FreeCell*>(m_bumpCursor + i * cellSize);
+        freeCell->next = head;
+        head = freeCell;
+    }
+
+    m_bumpCursor += cellCount * cellSize;
+    if (m_bumpCursor == m_bumpEnd) {
+        m_bumpCursor = 0;
+        m_bumpEnd = 0;
+    }
+
+    return MarkedBlock::FreeList(head, cellCount * cellSize);
+}
+
 inline void* MarkedAllocator::tryAllocateHelper(size_t bytes)
 {
+    if (m_bumpCursor != m_bumpEnd) {
+        // The current block still has an untouched run of free cells; thread the next batch
+        // of it onto the free list rather than moving on to sweep another block.
+        m_freeList = threadBumpInterval();
+        void* head = tryPopFreeList(bytes);
+        ASSERT(head);
+        return head;
+    }
+
     if (m_currentBlock) {
         ASSERT(m_currentBlock == m_nextBlockToSweep);
         m_currentBlock->didConsumeFreeList();
@@ -71,6 +111,18 @@ inline void* MarkedAllocator::tryAllocateHelper(size_t bytes)
     for (MarkedBlock*& block = m_nextBlockToSweep; block; block = next) {
         next = block->next();
 
+        if (block->isNewBlock() && bytes <= block->cellSize()) {
+            // A block nothing has been allocated in yet is one contiguous run of free
+            // cells, so take it as a bump interval instead of linking every cell onto a
+            // free list up front.
+            block->willBumpAllocate();
+            m_currentBlock = block;
+            m_bumpCursor = block->bumpAllocationStart();
+            m_bumpEnd = block->bumpAllocationEnd();
+            m_freeList = threadBumpInterval();
+            break;
+        }
+
         MarkedBlock::FreeList freeList = block->sweep(MarkedBlock::SweepToFreeList);
         
         double utilization = ((double)MarkedBlock::blockSize - (double)freeList.bytes) / (double)MarkedBlock::blockSize;
@@ -199,6 +251,8 @@ void MarkedAllocator::removeBlock(MarkedBlock* block)
     if (m_currentBlock == block) {
         m_currentBlock = m_currentBlock->next();
         m_freeList = MarkedBlock::FreeList();
+        m_bumpCursor = 0;
+        m_bumpEnd = 0;
     }
     if (m_nextBlockToSweep == block)
         m_nextBlockToSweep = m_nextBlockToSweep->next();
@@ -209,9 +263,12 @@ void MarkedAllocator::removeBlock(MarkedBlock* block)
 
 void MarkedAllocator::reset()
 {
+    ASSERT(m_bumpCursor == m_bumpEnd);
     m_lastActiveBlock = 0;
     m_currentBlock = 0;
     m_freeList = MarkedBlock::FreeList();
+    m_bumpCursor = 0;
+    m_bumpEnd = 0;
     if (m_heap->operationInProgress() == FullCollection)
         m_blockList.append(m_retiredBlocks);
 
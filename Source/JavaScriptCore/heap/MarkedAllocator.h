@@ -70,13 +70,19 @@ private:
     void* tryAllocate(size_t);
     void* tryAllocateHelper(size_t);
     void* tryPopFreeList(size_t);
+    MarkedBlock::FreeList threadBumpInterval();
     MarkedBlock* allocateBlock(size_t);
     ALWAYS_INLINE void doTestCollectionsIfNeeded();
-    
+
     MarkedBlock::FreeList m_freeList;
     MarkedBlock* m_currentBlock;
     MarkedBlock* m_lastActiveBlock;
     MarkedBlock* m_nextBlockToSweep;
+    // The not-yet-handed-out portion of the current block's contiguous run of free cells.
+    // Cells become visible to the inline allocation paths, which only understand the free
+    // list, as threadBumpInterval() links them onto it a batch at a time.
+    char* m_bumpCursor;
+    char* m_bumpEnd;
     DoublyLinkedList<MarkedBlock> m_blockList;
     DoublyLinkedList<MarkedBlock> m_retiredBlocks;
     size_t m_cellSize;
@@ -94,6 +100,8 @@ inline MarkedAllocator::MarkedAllocator()
     : m_currentBlock(0)
     , m_lastActiveBlock(0)
     , m_nextBlockToSweep(0)
+    , m_bumpCursor(0)
+    , m_bumpEnd(0)
     , m_cellSize(0)
     , m_heap(0)
     , m_markedSpace(0)
@@ -134,6 +142,20 @@ inline void MarkedAllocator::stopAllocating()
         return;
     }
     
+    if (m_bumpCursor != m_bumpEnd) {
+        // The block rebuilds its cell liveness data from the free list, so the unconsumed
+        // part of the bump interval has to be on the list before we hand the list over.
+        size_t cellSize = m_currentBlock->cellSize();
+        for (char* cell = m_bumpCursor; cell != m_bumpEnd; cell += cellSize) {
+            MarkedBlock::FreeCell* freeCell = reinterpret_cast<MarkedBlock::FreeCell*>(cell);
+            freeCell->next = m_freeList.head;
+            m_freeList.head = freeCell;
+            m_freeList.bytes += cellSize;
+        }
+        m_bumpCursor = 0;
+        m_bumpEnd = 0;
+    }
+
     m_currentBlock->stopAllocating(m_freeList);
     m_lastActiveBlock = m_currentBlock;
     m_currentBlock = 0;
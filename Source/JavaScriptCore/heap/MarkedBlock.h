@@ -123,6 +123,14 @@ namespace JSC {
         enum SweepMode { SweepOnly, SweepToFreeList };
         FreeList sweep(SweepMode = SweepOnly);
 
+        // A block that has never been allocated in consists of one contiguous run of free
+        // cells, so instead of sweeping it onto a free list the allocator can hand its cells
+        // out by bumping a cursor through the run.
+        bool isNewBlock() const;
+        char* bumpAllocationStart();
+        char* bumpAllocationEnd();
+        void willBumpAllocate();
+
         void shrink();
 
         void visitWeakSet(HeapRootVisitor&);
@@ -275,6 +283,35 @@ namespace JSC {
         ASSERT(m_state != Retired);
     }
 
+    inline bool MarkedBlock::isNewBlock() const
+    {
+        return m_state == New;
+    }
+
+    inline char* MarkedBlock::bumpAllocationStart()
+    {
+        ASSERT(m_state == New || m_state == FreeListed);
+        return reinterpret_cast<char*>(&atoms()[firstAtom()]);
+    }
+
+    inline char* MarkedBlock::bumpAllocationEnd()
+    {
+        ASSERT(m_state == New || m_state == FreeListed);
+        size_t cellCount = (m_endAtom - firstAtom() + m_atomsPerCell - 1) / m_atomsPerCell;
+        return bumpAllocationStart() + cellCount * cellSize();
+    }
+
+    inline void MarkedBlock::willBumpAllocate()
+    {
+        HEAP_LOG_BLOCK_STATE_TRANSITION(this);
+
+        // A new block has no weak references and nothing to destroy, so the only part of
+        // sweeping it to a free list that matters is the state transition.
+        ASSERT(m_state == New);
+        ASSERT(!m_newlyAllocated);
+        m_state = FreeListed;
+    }
+
     inline void MarkedBlock::didConsumeFreeList()
     {
         HEAP_LOG_BLOCK_STATE_TRANSITION(this);
@@ -71,17 +71,40 @@ void WeakBlock::lastChanceToFinalize()
     }
 }
 
+void WeakBlock::finalizeDeadImpls()
+{
+    // Finalizers are virtual calls on WeakHandleOwner, and all wrappers of a given class
+    // share one owner. Running each owner's dead handles back to back keeps that owner's
+    // finalize() hot in the icache instead of ping-ponging between owners in slot order.
+    for (size_t i = 0; i < weakImplCount(); ++i) {
+        WeakImpl* weakImpl = &weakImpls()[i];
+        if (weakImpl->state() != WeakImpl::Dead)
+            continue;
+
+        WeakHandleOwner* weakHandleOwner = weakImpl->weakHandleOwner();
+        finalize(weakImpl);
+        if (!weakHandleOwner)
+            continue;
+
+        for (size_t j = i + 1; j < weakImplCount(); ++j) {
+            WeakImpl* batchedWeakImpl = &weakImpls()[j];
+            if (batchedWeakImpl->state() == WeakImpl::Dead && batchedWeakImpl->weakHandleOwner() == weakHandleOwner)
+                finalize(batchedWeakImpl);
+        }
+    }
+}
+
 void WeakBlock::sweep()
 {
     // If a block is completely empty, a sweep won't have any effect.
     if (isEmpty())
         return;
 
+    finalizeDeadImpls();
+
     SweepResult sweepResult;
     for (size_t i = 0; i < weakImplCount(); ++i) {
         WeakImpl* weakImpl = &weakImpls()[i];
-        if (weakImpl->state() == WeakImpl::Dead)
-            finalize(weakImpl);
         if (weakImpl->state() == WeakImpl::Deallocated)
             addToFreeList(&sweepResult.freeList, weakImpl);
         else {
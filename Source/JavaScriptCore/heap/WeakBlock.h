@@ -75,6 +75,7 @@ private:
 
     explicit WeakBlock(MarkedBlock&);
     void finalize(WeakImpl*);
+    void finalizeDeadImpls();
     WeakImpl* weakImpls();
     size_t weakImplCount();
     void addToFreeList(FreeCell**, WeakImpl*);
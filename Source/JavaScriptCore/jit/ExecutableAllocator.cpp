@@ -89,6 +89,22 @@ public:
         return total;
     }
 
+    static MetaAllocator::FreeSpaceStatistics freeSpaceStatisticsFromAllAllocators()
+    {
+        MetaAllocator::FreeSpaceStatistics total;
+        total.freeBlockCount = 0;
+        total.largestFreeBlock = 0;
+        total.totalFreeBytes = 0;
+        std::lock_guard<StaticLock> lock(allocatorsMutex());
+        for (HashSet<DemandExecutableAllocator*>::const_iterator allocator = allocators().begin(); allocator != allocators().end(); ++allocator) {
+            MetaAllocator::FreeSpaceStatistics statistics = (*allocator)->currentFreeSpaceStatistics();
+            total.freeBlockCount += statistics.freeBlockCount;
+            total.largestFreeBlock = std::max(total.largestFreeBlock, statistics.largestFreeBlock);
+            total.totalFreeBytes += statistics.totalFreeBytes;
+        }
+        return total;
+    }
+
 #if ENABLE(META_ALLOCATOR_PROFILE)
     static void dumpProfileFromAllAllocators()
     {
@@ -225,6 +241,11 @@ size_t ExecutableAllocator::committedByteCount()
     return DemandExecutableAllocator::bytesCommittedByAllocactors();
 }
 
+MetaAllocator::FreeSpaceStatistics ExecutableAllocator::currentFreeSpaceStatistics()
+{
+    return DemandExecutableAllocator::freeSpaceStatisticsFromAllAllocators();
+}
+
 #if ENABLE(META_ALLOCATOR_PROFILE)
 void ExecutableAllocator::dumpProfile()
 {
@@ -104,9 +104,13 @@ public:
     bool isValid() const;
 
     static bool underMemoryPressure();
-    
+
     static double memoryPressureMultiplier(size_t addedMemoryUsage);
-    
+
+    // Diagnostic snapshot of the executable pool's free space, exposed through
+    // $vm so fragmentation can be tracked in long-running processes.
+    static MetaAllocator::FreeSpaceStatistics currentFreeSpaceStatistics();
+
 #if ENABLE(META_ALLOCATOR_PROFILE)
     static void dumpProfile();
 #else
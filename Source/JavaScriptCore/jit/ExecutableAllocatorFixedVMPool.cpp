@@ -136,17 +136,18 @@ bool ExecutableAllocator::isValid() const
 
 bool ExecutableAllocator::underMemoryPressure()
 {
-    MetaAllocator::Statistics statistics = allocator->currentStatistics();
-    return statistics.bytesAllocated > statistics.bytesReserved / 2;
+    // This is a heuristic, so a racy unlocked read of the byte counts is fine;
+    // taking the allocator lock here would make every compiler thread contend
+    // on it just to make a fuzzy decision.
+    return allocator->bytesAllocated() > allocator->bytesReserved() / 2;
 }
 
 double ExecutableAllocator::memoryPressureMultiplier(size_t addedMemoryUsage)
 {
-    MetaAllocator::Statistics statistics = allocator->currentStatistics();
-    ASSERT(statistics.bytesAllocated <= statistics.bytesReserved);
-    size_t bytesAllocated = statistics.bytesAllocated + addedMemoryUsage;
+    // Like underMemoryPressure(), this tolerates racy reads.
+    size_t bytesAllocated = allocator->bytesAllocated() + addedMemoryUsage;
     size_t bytesAvailable = static_cast<size_t>(
-        statistics.bytesReserved * (1 - executablePoolReservationFraction));
+        allocator->bytesReserved() * (1 - executablePoolReservationFraction));
     if (bytesAllocated >= bytesAvailable)
         bytesAllocated = bytesAvailable;
     double result = 1.0;
@@ -170,11 +171,12 @@ RefPtr<ExecutableMemoryHandle> ExecutableAllocator::allocate(VM&, size_t sizeInB
         return nullptr;
     
     if (effort == JITCompilationCanFail) {
-        // Don't allow allocations if we are down to reserve.
-        MetaAllocator::Statistics statistics = allocator->currentStatistics();
-        size_t bytesAllocated = statistics.bytesAllocated + sizeInBytes;
+        // Don't allow allocations if we are down to reserve. An unlocked read
+        // of the byte counts is good enough for this check; the allocation
+        // itself will take the lock.
+        size_t bytesAllocated = allocator->bytesAllocated() + sizeInBytes;
         size_t bytesAvailable = static_cast<size_t>(
-            statistics.bytesReserved * (1 - executablePoolReservationFraction));
+            allocator->bytesReserved() * (1 - executablePoolReservationFraction));
         if (bytesAllocated > bytesAvailable)
             return nullptr;
     }
@@ -205,6 +207,11 @@ size_t ExecutableAllocator::committedByteCount()
     return allocator->bytesCommitted();
 }
 
+MetaAllocator::FreeSpaceStatistics ExecutableAllocator::currentFreeSpaceStatistics()
+{
+    return allocator->currentFreeSpaceStatistics();
+}
+
 #if ENABLE(META_ALLOCATOR_PROFILE)
 void ExecutableAllocator::dumpProfile()
 {
@@ -158,11 +158,33 @@ EncodedJSValue JIT_OPERATION operationGetById(ExecState* exec, StructureStubInfo
     NativeCallFrameTracer tracer(vm, exec);
     
     stubInfo->tookSlowPath = true;
-    
+
     JSValue baseValue = JSValue::decode(base);
+
+    // This operation is the permanent home of accesses that exhausted their
+    // PolymorphicAccess list, so consult the megamorphic cache before doing a full
+    // lookup. Hits are own value properties on non-dictionary structures, so the
+    // cached offset is valid for as long as the structure is.
+    if (baseValue.isCell() && baseValue.asCell()->isObject()) {
+        JSObject* object = asObject(baseValue);
+        PropertyOffset offset = vm->megamorphicGetByIdCache.tryGet(object->structure(*vm)->id(), uid);
+        if (isValidOffset(offset))
+            return JSValue::encode(object->getDirect(offset));
+    }
+
     PropertySlot slot(baseValue, PropertySlot::InternalMethodType::Get);
     Identifier ident = Identifier::fromUid(vm, uid);
-    return JSValue::encode(baseValue.get(exec, ident, slot));
+    JSValue result = baseValue.get(exec, ident, slot);
+
+    if (!vm->exception() && baseValue.isCell() && slot.isCacheableValue() && slot.slotBase() == baseValue) {
+        Structure* structure = baseValue.asCell()->structure(*vm);
+        if (!structure->isDictionary()
+            && !structure->typeInfo().prohibitsPropertyCaching()
+            && !structure->needImpurePropertyWatchpoint())
+            vm->megamorphicGetByIdCache.set(structure->id(), uid, slot.cachedOffset());
+    }
+
+    return JSValue::encode(result);
 }
 
 EncodedJSValue JIT_OPERATION operationGetByIdGeneric(ExecState* exec, EncodedJSValue base, UniquedStringImpl* uid)
@@ -315,14 +315,15 @@ static InlineCacheAction tryCacheGetByID(ExecState* exec, JSValue baseValue, con
         }
     }
 
-    MacroAssemblerCodePtr codePtr =
+    AccessGenerationResult result =
         stubInfo.addAccessCase(codeBlock, propertyName, WTFMove(newCase));
 
-    if (!codePtr)
+    if (result.gaveUp())
         return GiveUpOnCache;
 
-    replaceWithJump(stubInfo, codePtr);
-    
+    if (result.generatedNewCode())
+        replaceWithJump(stubInfo, result.code());
+
     return RetryCacheLater;
 }
 
@@ -457,17 +458,19 @@ static InlineCacheAction tryCachePutByID(ExecState* exec, JSValue baseValue, Str
         }
     }
 
-    MacroAssemblerCodePtr codePtr = stubInfo.addAccessCase(codeBlock, ident, WTFMove(newCase));
-    
-    if (!codePtr)
+    AccessGenerationResult result = stubInfo.addAccessCase(codeBlock, ident, WTFMove(newCase));
+
+    if (result.gaveUp())
         return GiveUpOnCache;
 
-    resetPutByIDCheckAndLoad(stubInfo);
-    MacroAssembler::repatchJump(
-        stubInfo.callReturnLocation.jumpAtOffset(
-            stubInfo.patch.deltaCallToJump),
-        CodeLocationLabel(codePtr));
-    
+    if (result.generatedNewCode()) {
+        resetPutByIDCheckAndLoad(stubInfo);
+        MacroAssembler::repatchJump(
+            stubInfo.callReturnLocation.jumpAtOffset(
+                stubInfo.patch.deltaCallToJump),
+            CodeLocationLabel(result.code()));
+    }
+
     return RetryCacheLater;
 }
 
@@ -514,14 +517,17 @@ static InlineCacheAction tryRepatchIn(
     std::unique_ptr<AccessCase> newCase = AccessCase::in(
         vm, codeBlock, wasFound ? AccessCase::InHit : AccessCase::InMiss, structure, conditionSet);
 
-    MacroAssemblerCodePtr codePtr = stubInfo.addAccessCase(codeBlock, ident, WTFMove(newCase));
-    if (!codePtr)
+    AccessGenerationResult result = stubInfo.addAccessCase(codeBlock, ident, WTFMove(newCase));
+
+    if (result.gaveUp())
         return GiveUpOnCache;
 
-    MacroAssembler::repatchJump(
-        stubInfo.callReturnLocation.jumpAtOffset(stubInfo.patch.deltaCallToJump),
-        CodeLocationLabel(codePtr));
-    
+    if (result.generatedNewCode()) {
+        MacroAssembler::repatchJump(
+            stubInfo.callReturnLocation.jumpAtOffset(stubInfo.patch.deltaCallToJump),
+            CodeLocationLabel(result.code()));
+    }
+
     return RetryCacheLater;
 }
 
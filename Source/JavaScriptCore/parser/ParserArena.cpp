@@ -28,9 +28,53 @@
 
 #include "Nodes.h"
 #include "JSCInlines.h"
+#include <wtf/NeverDestroyed.h>
+#include <wtf/ThreadSpecific.h>
 
 namespace JSC {
 
+// Parsing creates one short-lived arena per function, so the common case is a single
+// pool that gets allocated and torn down over and over on the same thread. Caching a
+// few pools per thread turns that pattern into a pointer pop/push instead of
+// fastMalloc/fastFree churn, which dominates cold-load parse time on large bundles.
+static const size_t maximumCachedPools = 4;
+
+struct PoolCache {
+    // ThreadSpecific destroys the cache when its thread exits; any pools still cached
+    // belong to this thread alone and must be returned to the allocator here.
+    ~PoolCache()
+    {
+        for (size_t i = 0; i < pools.size(); ++i)
+            fastFree(pools[i]);
+    }
+
+    Vector<void*, maximumCachedPools> pools;
+};
+
+static PoolCache& poolCacheForCurrentThread()
+{
+    static NeverDestroyed<ThreadSpecific<PoolCache>> cache;
+    return *cache.get();
+}
+
+static void* allocatePool()
+{
+    PoolCache& cache = poolCacheForCurrentThread();
+    if (!cache.pools.isEmpty())
+        return cache.pools.takeLast();
+    return fastMalloc(ParserArena::freeablePoolSize);
+}
+
+static void deallocatePool(void* pool)
+{
+    PoolCache& cache = poolCacheForCurrentThread();
+    if (cache.pools.size() < maximumCachedPools) {
+        cache.pools.uncheckedAppend(pool);
+        return;
+    }
+    fastFree(pool);
+}
+
 ParserArena::ParserArena()
     : m_freeableMemory(0)
     , m_freeablePoolEnd(0)
@@ -50,11 +94,11 @@ inline void ParserArena::deallocateObjects()
         m_deletableObjects[i]->~ParserArenaDeletable();
 
     if (m_freeablePoolEnd)
-        fastFree(freeablePool());
+        deallocatePool(freeablePool());
 
     size = m_freeablePools.size();
     for (size_t i = 0; i < size; ++i)
-        fastFree(m_freeablePools[i]);
+        deallocatePool(m_freeablePools[i]);
 }
 
 ParserArena::~ParserArena()
@@ -67,7 +111,7 @@ void ParserArena::allocateFreeablePool()
     if (m_freeablePoolEnd)
         m_freeablePools.append(freeablePool());
 
-    char* pool = static_cast<char*>(fastMalloc(freeablePoolSize));
+    char* pool = static_cast<char*>(allocatePool());
     m_freeableMemory = pool;
     m_freeablePoolEnd = pool + freeablePoolSize;
     ASSERT(freeablePool() == pool);
@@ -168,9 +168,10 @@ namespace JSC {
             return *m_identifierArena;
         }
 
-    private:
         static const size_t freeablePoolSize = 8000;
 
+    private:
+
         static size_t alignSize(size_t size)
         {
             return (size + sizeof(WTF::AllocAlignmentInteger) - 1) & ~(sizeof(WTF::AllocAlignmentInteger) - 1);
@@ -29,10 +29,65 @@
 #include "ArrayBufferNeuteringWatchpoint.h"
 #include "JSArrayBufferView.h"
 #include "JSCInlines.h"
+#include <wtf/Lock.h>
 #include <wtf/RefPtr.h>
 
 namespace JSC {
 
+// Backing stores at or above this size come out of fastMalloc's VM-allocated
+// range, so freeing one returns its pages to the OS and the next allocation
+// pays for mapping and faulting them back in. Recycling them directly keeps
+// steady-state workloads - like a worker transferring a 16MB frame buffer per
+// tick - from doing that dance on every iteration. Matching on exact size
+// means a recycled store is always at least as big and as aligned as what
+// fastMalloc originally handed out for that request.
+static const unsigned minimumPooledSizeInBytes = 512 * 1024;
+static const unsigned maximumPooledEntries = 8;
+static const size_t maximumPooledBytes = 64 * 1024 * 1024;
+
+struct PooledBackingStore {
+    void* data;
+    unsigned sizeInBytes;
+};
+
+static StaticLock backingStorePoolLock;
+static PooledBackingStore backingStorePool[maximumPooledEntries];
+static unsigned backingStorePoolSize;
+static size_t backingStorePoolBytes;
+
+void* ArrayBufferContents::tryTakePooledBackingStore(unsigned sizeInBytes)
+{
+    if (sizeInBytes < minimumPooledSizeInBytes)
+        return nullptr;
+
+    LockHolder locker(backingStorePoolLock);
+    for (unsigned i = backingStorePoolSize; i--;) {
+        if (backingStorePool[i].sizeInBytes != sizeInBytes)
+            continue;
+        void* data = backingStorePool[i].data;
+        backingStorePoolBytes -= sizeInBytes;
+        backingStorePool[i] = backingStorePool[--backingStorePoolSize];
+        return data;
+    }
+    return nullptr;
+}
+
+bool ArrayBufferContents::tryRecycleBackingStore(void* data, unsigned sizeInBytes)
+{
+    if (sizeInBytes < minimumPooledSizeInBytes)
+        return false;
+
+    LockHolder locker(backingStorePoolLock);
+    if (backingStorePoolSize == maximumPooledEntries
+        || backingStorePoolBytes + sizeInBytes > maximumPooledBytes)
+        return false;
+    backingStorePool[backingStorePoolSize].data = data;
+    backingStorePool[backingStorePoolSize].sizeInBytes = sizeInBytes;
+    backingStorePoolSize++;
+    backingStorePoolBytes += sizeInBytes;
+    return true;
+}
+
 bool ArrayBuffer::transfer(ArrayBufferContents& result)
 {
     Ref<ArrayBuffer> protect(*this);
@@ -65,6 +65,14 @@ private:
     };
 
     static inline void tryAllocate(unsigned numElements, unsigned elementByteSize, InitializationPolicy, ArrayBufferContents&);
+
+    // Large backing stores are recycled on a free list keyed by exact size
+    // instead of going back to fastMalloc, so pipelines that allocate and
+    // transfer big buffers at a steady rate do not pay for a fresh VM
+    // allocation (and its page faults) on every iteration.
+    JS_EXPORT_PRIVATE static void* tryTakePooledBackingStore(unsigned sizeInBytes);
+    JS_EXPORT_PRIVATE static bool tryRecycleBackingStore(void* data, unsigned sizeInBytes);
+
     void transfer(ArrayBufferContents& other)
     {
         ASSERT(!other.m_data);
@@ -261,6 +269,15 @@ void ArrayBufferContents::tryAllocate(unsigned numElements, unsigned elementByte
             return;
         }
     }
+    unsigned totalSize = numElements * elementByteSize;
+    if (void* pooledData = tryTakePooledBackingStore(totalSize)) {
+        if (policy == ZeroInitialize)
+            memset(pooledData, 0, totalSize);
+        result.m_data = pooledData;
+        result.m_sizeInBytes = totalSize;
+        return;
+    }
+
     bool allocationSucceeded = false;
     if (policy == ZeroInitialize)
         allocationSucceeded = WTF::tryFastCalloc(numElements, elementByteSize).getValue(result.m_data);
@@ -278,6 +295,8 @@ void ArrayBufferContents::tryAllocate(unsigned numElements, unsigned elementByte
 
 ArrayBufferContents::~ArrayBufferContents()
 {
+    if (m_data && tryRecycleBackingStore(m_data, m_sizeInBytes))
+        return;
     WTF::fastFree(m_data);
 }
 
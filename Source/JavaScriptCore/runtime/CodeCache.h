@@ -27,6 +27,7 @@
 #define CodeCache_h
 
 #include "CodeSpecializationKind.h"
+#include "Options.h"
 #include "ParserModes.h"
 #include "SourceCode.h"
 #include "SourceCodeKey.h"
@@ -82,8 +83,8 @@ public:
         : m_size(0)
         , m_sizeAtLastPrune(0)
         , m_timeAtLastPrune(monotonicallyIncreasingTime())
-        , m_minCapacity(0)
-        , m_capacity(0)
+        , m_minCapacity(static_cast<int64_t>(Options::codeCacheMinimumCapacityMB()) * 1024 * 1024)
+        , m_capacity(m_minCapacity)
         , m_age(0)
     {
     }
@@ -26,6 +26,7 @@
 
 #include "ConstructData.h"
 #include "ErrorConstructor.h"
+#include "ErrorInstance.h"
 #include "ExceptionHelpers.h"
 #include "FunctionPrototype.h"
 #include "JSArray.h"
@@ -176,7 +177,13 @@ bool addErrorInfoAndGetBytecodeOffset(ExecState* exec, VM& vm, JSObject* obj, bo
     
         if (!useCurrentFrame)
             stackTrace.remove(0);
-        obj->putDirect(vm, vm.propertyNames->stack, vm.interpreter->stackTraceAsString(vm.topCallFrame, stackTrace), DontEnum);
+        // Error instances defer building the trace string, which dwarfs the cost of walking the
+        // stack, until the stack property is first accessed. Other objects get the string eagerly
+        // since they have nowhere to keep the captured frames.
+        if (obj->inherits(ErrorInstance::info()))
+            jsCast<ErrorInstance*>(obj)->setStackTrace(RefCountedArray<StackFrame>(stackTrace));
+        else
+            obj->putDirect(vm, vm.propertyNames->stack, vm.interpreter->stackTraceAsString(vm.topCallFrame, stackTrace), DontEnum);
 
         return true;
     }
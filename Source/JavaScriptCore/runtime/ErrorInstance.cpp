@@ -30,13 +30,16 @@
 
 namespace JSC {
 
-STATIC_ASSERT_IS_TRIVIALLY_DESTRUCTIBLE(ErrorInstance);
-
-const ClassInfo ErrorInstance::s_info = { "Error", &JSNonFinalObject::s_info, 0, CREATE_METHOD_TABLE(ErrorInstance) };
+const ClassInfo ErrorInstance::s_info = { "Error", &Base::s_info, 0, CREATE_METHOD_TABLE(ErrorInstance) };
 
 ErrorInstance::ErrorInstance(VM& vm, Structure* structure)
-    : JSNonFinalObject(vm, structure)
+    : JSDestructibleObject(vm, structure)
+{
+}
+
+void ErrorInstance::destroy(JSCell* cell)
 {
+    static_cast<ErrorInstance*>(cell)->ErrorInstance::~ErrorInstance();
 }
 
 static void appendSourceToError(CallFrame* callFrame, ErrorInstance* exception, unsigned bytecodeOffset)
@@ -147,9 +150,66 @@ void ErrorInstance::finishCreation(ExecState* exec, VM& vm, const String& messag
     bool hasTrace = addErrorInfoAndGetBytecodeOffset(exec, vm, this, useCurrentFrame, callFrame, bytecodeOffset);
 
     if (hasTrace && callFrame && hasSourceAppender()) {
-        if (callFrame && callFrame->codeBlock()) 
+        if (callFrame && callFrame->codeBlock())
             appendSourceToError(callFrame, this, bytecodeOffset);
     }
 }
-    
+
+void ErrorInstance::materializeStackTraceIfNeeded(ExecState* exec)
+{
+    if (m_stackTrace.isEmpty())
+        return;
+
+    VM& vm = exec->vm();
+    Vector<StackFrame> stackTrace;
+    stackTrace.reserveInitialCapacity(m_stackTrace.size());
+    for (size_t i = 0; i < m_stackTrace.size(); ++i)
+        stackTrace.uncheckedAppend(m_stackTrace[i]);
+    m_stackTrace = RefCountedArray<StackFrame>();
+
+    putDirect(vm, vm.propertyNames->stack, vm.interpreter->stackTraceAsString(exec, stackTrace), DontEnum);
+}
+
+bool ErrorInstance::getOwnPropertySlot(JSObject* object, ExecState* exec, PropertyName propertyName, PropertySlot& slot)
+{
+    ErrorInstance* thisObject = jsCast<ErrorInstance*>(object);
+    if (propertyName == exec->vm().propertyNames->stack)
+        thisObject->materializeStackTraceIfNeeded(exec);
+    return Base::getOwnPropertySlot(thisObject, exec, propertyName, slot);
+}
+
+void ErrorInstance::getOwnNonIndexPropertyNames(JSObject* object, ExecState* exec, PropertyNameArray& propertyNames, EnumerationMode mode)
+{
+    ErrorInstance* thisObject = jsCast<ErrorInstance*>(object);
+    // The stack property is DontEnum, so it can only be observed by an enumeration that
+    // includes non-enumerable properties.
+    if (mode.includeDontEnumProperties())
+        thisObject->materializeStackTraceIfNeeded(exec);
+    Base::getOwnNonIndexPropertyNames(thisObject, exec, propertyNames, mode);
+}
+
+bool ErrorInstance::defineOwnProperty(JSObject* object, ExecState* exec, PropertyName propertyName, const PropertyDescriptor& descriptor, bool shouldThrow)
+{
+    ErrorInstance* thisObject = jsCast<ErrorInstance*>(object);
+    if (propertyName == exec->vm().propertyNames->stack)
+        thisObject->materializeStackTraceIfNeeded(exec);
+    return Base::defineOwnProperty(thisObject, exec, propertyName, descriptor, shouldThrow);
+}
+
+void ErrorInstance::put(JSCell* cell, ExecState* exec, PropertyName propertyName, JSValue value, PutPropertySlot& slot)
+{
+    ErrorInstance* thisObject = jsCast<ErrorInstance*>(cell);
+    if (propertyName == exec->vm().propertyNames->stack)
+        thisObject->materializeStackTraceIfNeeded(exec);
+    Base::put(thisObject, exec, propertyName, value, slot);
+}
+
+bool ErrorInstance::deleteProperty(JSCell* cell, ExecState* exec, PropertyName propertyName)
+{
+    ErrorInstance* thisObject = jsCast<ErrorInstance*>(cell);
+    if (propertyName == exec->vm().propertyNames->stack)
+        thisObject->materializeStackTraceIfNeeded(exec);
+    return Base::deleteProperty(thisObject, exec, propertyName);
+}
+
 } // namespace JSC
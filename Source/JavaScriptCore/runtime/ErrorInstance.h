@@ -22,15 +22,18 @@
 #define ErrorInstance_h
 
 #include "Interpreter.h"
+#include "JSDestructibleObject.h"
 #include "RuntimeType.h"
 #include "SourceProvider.h"
+#include <wtf/RefCountedArray.h>
 #include <wtf/Vector.h>
 
 namespace JSC {
 
-class ErrorInstance : public JSNonFinalObject {
+class ErrorInstance : public JSDestructibleObject {
 public:
-    typedef JSNonFinalObject Base;
+    typedef JSDestructibleObject Base;
+    static const unsigned StructureFlags = Base::StructureFlags | OverridesGetOwnPropertySlot;
 
     enum SourceTextWhereErrorOccurred { FoundExactSource, FoundApproximateSource };
     typedef String (*SourceAppender) (const String& originalMessage, const String& sourceText, RuntimeType, SourceTextWhereErrorOccurred);
@@ -58,6 +61,13 @@ public:
 
     static void addErrorInfo(ExecState*, VM&, JSObject*, bool = true);
 
+    static void destroy(JSCell*);
+
+    // Building the trace string is by far the most expensive part of constructing an error, and
+    // errors created for control flow usually never have their stack looked at. We keep the frames
+    // captured at construction time and only build the string on first access to the property.
+    void setStackTrace(RefCountedArray<StackFrame>&& stackTrace) { m_stackTrace = WTFMove(stackTrace); }
+
     bool hasSourceAppender() const { return !!m_sourceAppender; }
     SourceAppender sourceAppender() const { return m_sourceAppender; }
     void setSourceAppender(SourceAppender appender) { m_sourceAppender = appender; }
@@ -71,8 +81,17 @@ protected:
 
     void finishCreation(ExecState*, VM&, const String&, bool useCurrentFrame = true);
 
+    static bool getOwnPropertySlot(JSObject*, ExecState*, PropertyName, PropertySlot&);
+    static void getOwnNonIndexPropertyNames(JSObject*, ExecState*, PropertyNameArray&, EnumerationMode);
+    static bool defineOwnProperty(JSObject*, ExecState*, PropertyName, const PropertyDescriptor&, bool shouldThrow);
+    static void put(JSCell*, ExecState*, PropertyName, JSValue, PutPropertySlot&);
+    static bool deleteProperty(JSCell*, ExecState*, PropertyName);
+
+    void materializeStackTraceIfNeeded(ExecState*);
+
     SourceAppender m_sourceAppender { nullptr };
     RuntimeType m_runtimeTypeForCause { TypeNothing };
+    RefCountedArray<StackFrame> m_stackTrace;
 };
 
 } // namespace JSC
@@ -31,8 +31,6 @@
 
 namespace JSC {
 
-STATIC_ASSERT_IS_TRIVIALLY_DESTRUCTIBLE(ErrorPrototype);
-
 static EncodedJSValue JSC_HOST_CALL errorProtoFuncToString(ExecState*);
 
 }
@@ -63,14 +63,30 @@ JSValue iteratorNext(ExecState* exec, JSValue iterator)
     return iteratorNext(exec, iterator, JSValue());
 }
 
+// Iterator result objects are almost always plain objects carrying own "value" and "done"
+// data properties, so probe the object directly before falling back to a fully generic get.
+static ALWAYS_INLINE JSValue getIteratorResultProperty(ExecState* exec, JSValue iterResult, PropertyName propertyName)
+{
+    VM& vm = exec->vm();
+    if (iterResult.isObject()) {
+        JSCell* cell = iterResult.asCell();
+        Structure& structure = *cell->structure(vm);
+        if (JSCell::canUseFastGetOwnProperty(structure)) {
+            if (JSValue result = cell->fastGetOwnProperty(vm, structure, propertyName))
+                return result;
+        }
+    }
+    return iterResult.get(exec, propertyName);
+}
+
 JSValue iteratorValue(ExecState* exec, JSValue iterResult)
 {
-    return iterResult.get(exec, exec->vm().propertyNames->value);
+    return getIteratorResultProperty(exec, iterResult, exec->vm().propertyNames->value);
 }
 
 bool iteratorComplete(ExecState* exec, JSValue iterResult)
 {
-    JSValue done = iterResult.get(exec, exec->vm().propertyNames->done);
+    JSValue done = getIteratorResultProperty(exec, iterResult, exec->vm().propertyNames->done);
     return done.toBoolean(exec);
 }
 
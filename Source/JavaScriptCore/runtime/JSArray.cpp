@@ -708,6 +708,28 @@ JSArray* JSArray::fastSlice(ExecState& exec, unsigned startIndex, unsigned count
 
         return resultArray;
     }
+    case ArrayWithArrayStorage: {
+        // Arrays commonly end up in storage mode with no holes at all (e.g. after a
+        // shift or unshift), and those can take the same memcpy path into a fresh
+        // contiguous array.
+        VM& vm = exec.vm();
+        ArrayStorage* storage = m_butterfly.get(this)->arrayStorage();
+        if (count >= MIN_SPARSE_ARRAY_INDEX || storage->hasHoles() || storage->m_sparseMap
+            || startIndex + count > storage->vectorLength()
+            || structure(vm)->holesMustForwardToPrototype(vm))
+            return nullptr;
+
+        Structure* resultStructure = exec.lexicalGlobalObject()->arrayStructureForIndexingTypeDuringAllocation(ArrayWithContiguous);
+        JSArray* resultArray = JSArray::tryCreateUninitialized(vm, resultStructure, count);
+        if (!resultArray)
+            return nullptr;
+
+        auto& resultButterfly = *resultArray->butterfly();
+        memcpy(resultButterfly.contiguous().data(), storage->m_vector + startIndex, sizeof(JSValue) * count);
+        resultButterfly.setPublicLength(count);
+
+        return resultArray;
+    }
     default:
         return nullptr;
     }
@@ -186,10 +186,20 @@ bool JSGenericTypedArrayView<Adaptor>::setWithSpecificType(
 
     unsigned otherElementSize = sizeof(typename OtherAdaptor::Type);
     
-    // Handle cases (1) and (2B).
+    // Handle case (1). Since the vectors cannot overlap, converting through a forward loop
+    // over the raw vectors is safe, and unit-stride loads and stores give the compiler a
+    // loop it can vectorize.
     if (!hasArrayBuffer() || !other->hasArrayBuffer()
-        || existingBuffer() != other->existingBuffer()
-        || (elementSize == otherElementSize && vector() > other->vector())) {
+        || existingBuffer() != other->existingBuffer()) {
+        typename Adaptor::Type* destination = typedVector() + offset;
+        const typename OtherAdaptor::Type* source = other->typedVector();
+        for (unsigned i = 0; i < length; ++i)
+            destination[i] = OtherAdaptor::template convertTo<Adaptor>(source[i]);
+        return true;
+    }
+
+    // Handle case (2B), which needs the backward copy.
+    if (elementSize == otherElementSize && vector() > other->vector()) {
         for (unsigned i = length; i--;) {
             setIndexQuicklyToNativeValue(
                 offset + i, OtherAdaptor::template convertTo<Adaptor>(
@@ -197,7 +207,7 @@ bool JSGenericTypedArrayView<Adaptor>::setWithSpecificType(
         }
         return true;
     }
-    
+
     // Now we either have (2A) or (3) - so first we try to cover (2A).
     if (elementSize == otherElementSize) {
         for (unsigned i = 0; i < length; ++i) {
@@ -330,19 +330,14 @@ void JSGlobalObject::init(VM& vm)
     m_typedArrays[toIndex(TypeDataView)].structure.set(vm, this, JSDataView::createStructure(vm, this, m_typedArrays[toIndex(TypeDataView)].prototype.get()));
     
     m_lexicalEnvironmentStructure.set(vm, this, JSLexicalEnvironment::createStructure(vm, this));
-    m_moduleEnvironmentStructure.set(vm, this, JSModuleEnvironment::createStructure(vm, this));
-    m_strictEvalActivationStructure.set(vm, this, StrictEvalActivation::createStructure(vm, this, jsNull()));
-    m_debuggerScopeStructure.set(m_vm, this, DebuggerScope::createStructure(m_vm, this));
-    m_withScopeStructure.set(vm, this, JSWithScope::createStructure(vm, this, jsNull()));
-    
+    // The debugger scope, with scope, strict eval, module environment and C API
+    // callback structures are created lazily by their accessors.
+
     m_nullPrototypeObjectStructure.set(vm, this, JSFinalObject::createStructure(vm, this, jsNull(), JSFinalObject::defaultInlineCapacity()));
-    
-    m_callbackFunctionStructure.set(vm, this, JSCallbackFunction::createStructure(vm, this, m_functionPrototype.get()));
+
     m_directArgumentsStructure.set(vm, this, DirectArguments::createStructure(vm, this, m_objectPrototype.get()));
     m_scopedArgumentsStructure.set(vm, this, ScopedArguments::createStructure(vm, this, m_objectPrototype.get()));
     m_outOfBandArgumentsStructure.set(vm, this, ClonedArguments::createStructure(vm, this, m_objectPrototype.get()));
-    m_callbackConstructorStructure.set(vm, this, JSCallbackConstructor::createStructure(vm, this, m_objectPrototype.get()));
-    m_callbackObjectStructure.set(vm, this, JSCallbackObject<JSDestructibleObject>::createStructure(vm, this, m_objectPrototype.get()));
 
 #if JSC_OBJC_API_ENABLED
     m_objcCallbackFunctionStructure.set(vm, this, ObjCCallbackFunction::createStructure(vm, this, m_functionPrototype.get()));
@@ -369,10 +364,6 @@ void JSGlobalObject::init(VM& vm)
     m_moduleRecordStructure.set(vm, this, JSModuleRecord::createStructure(vm, this, m_objectPrototype.get()));
     m_moduleNamespaceObjectStructure.set(vm, this, JSModuleNamespaceObject::createStructure(vm, this, jsNull()));
     m_proxyObjectStructure.set(vm, this, ProxyObject::createStructure(vm, this, m_objectPrototype.get()));
-    
-#if ENABLE(WEBASSEMBLY)
-    m_wasmModuleStructure.set(vm, this, JSWASMModule::createStructure(vm, this));
-#endif
 
     m_parseIntFunction.set(vm, this, JSFunction::create(vm, this, 2, vm.propertyNames->parseInt.string(), globalFuncParseInt, NoIntrinsic));
     putDirectWithoutTransition(vm, vm.propertyNames->parseInt, m_parseIntFunction.get(), DontEnum);
@@ -817,6 +808,64 @@ void JSGlobalObject::resetPrototype(VM& vm, JSValue prototype)
     setGlobalThis(vm, JSProxy::create(vm, JSProxy::createStructure(vm, this, prototype, PureForwardingProxyType), this));
 }
 
+Structure* JSGlobalObject::debuggerScopeStructure()
+{
+    if (!m_debuggerScopeStructure)
+        m_debuggerScopeStructure.set(m_vm, this, DebuggerScope::createStructure(m_vm, this));
+    return m_debuggerScopeStructure.get();
+}
+
+Structure* JSGlobalObject::withScopeStructure()
+{
+    if (!m_withScopeStructure)
+        m_withScopeStructure.set(m_vm, this, JSWithScope::createStructure(m_vm, this, jsNull()));
+    return m_withScopeStructure.get();
+}
+
+Structure* JSGlobalObject::strictEvalActivationStructure()
+{
+    if (!m_strictEvalActivationStructure)
+        m_strictEvalActivationStructure.set(m_vm, this, StrictEvalActivation::createStructure(m_vm, this, jsNull()));
+    return m_strictEvalActivationStructure.get();
+}
+
+Structure* JSGlobalObject::moduleEnvironmentStructure()
+{
+    if (!m_moduleEnvironmentStructure)
+        m_moduleEnvironmentStructure.set(m_vm, this, JSModuleEnvironment::createStructure(m_vm, this));
+    return m_moduleEnvironmentStructure.get();
+}
+
+Structure* JSGlobalObject::callbackConstructorStructure()
+{
+    if (!m_callbackConstructorStructure)
+        m_callbackConstructorStructure.set(m_vm, this, JSCallbackConstructor::createStructure(m_vm, this, m_objectPrototype.get()));
+    return m_callbackConstructorStructure.get();
+}
+
+Structure* JSGlobalObject::callbackFunctionStructure()
+{
+    if (!m_callbackFunctionStructure)
+        m_callbackFunctionStructure.set(m_vm, this, JSCallbackFunction::createStructure(m_vm, this, m_functionPrototype.get()));
+    return m_callbackFunctionStructure.get();
+}
+
+Structure* JSGlobalObject::callbackObjectStructure()
+{
+    if (!m_callbackObjectStructure)
+        m_callbackObjectStructure.set(m_vm, this, JSCallbackObject<JSDestructibleObject>::createStructure(m_vm, this, m_objectPrototype.get()));
+    return m_callbackObjectStructure.get();
+}
+
+#if ENABLE(WEBASSEMBLY)
+Structure* JSGlobalObject::wasmModuleStructure()
+{
+    if (!m_wasmModuleStructure)
+        m_wasmModuleStructure.set(m_vm, this, JSWASMModule::createStructure(m_vm, this));
+    return m_wasmModuleStructure.get();
+}
+#endif
+
 void JSGlobalObject::visitChildren(JSCell* cell, SlotVisitor& visitor)
 { 
     JSGlobalObject* thisObject = jsCast<JSGlobalObject*>(cell);
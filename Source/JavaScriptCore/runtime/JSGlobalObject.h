@@ -467,11 +467,14 @@ public:
     GeneratorFunctionPrototype* generatorFunctionPrototype() const { return m_generatorFunctionPrototype.get(); }
     GeneratorPrototype* generatorPrototype() const { return m_generatorPrototype.get(); }
 
-    Structure* debuggerScopeStructure() const { return m_debuggerScopeStructure.get(); }
-    Structure* withScopeStructure() const { return m_withScopeStructure.get(); }
-    Structure* strictEvalActivationStructure() const { return m_strictEvalActivationStructure.get(); }
+    // These structures are created on first use rather than in init(): most
+    // globals never see a debugger, a with statement, strict eval or modules,
+    // and embeddings that spin up many short-lived VMs shouldn't pay for them.
+    JS_EXPORT_PRIVATE Structure* debuggerScopeStructure();
+    JS_EXPORT_PRIVATE Structure* withScopeStructure();
+    JS_EXPORT_PRIVATE Structure* strictEvalActivationStructure();
     Structure* activationStructure() const { return m_lexicalEnvironmentStructure.get(); }
-    Structure* moduleEnvironmentStructure() const { return m_moduleEnvironmentStructure.get(); }
+    JS_EXPORT_PRIVATE Structure* moduleEnvironmentStructure();
     Structure* directArgumentsStructure() const { return m_directArgumentsStructure.get(); }
     Structure* scopedArgumentsStructure() const { return m_scopedArgumentsStructure.get(); }
     Structure* outOfBandArgumentsStructure() const { return m_outOfBandArgumentsStructure.get(); }
@@ -500,9 +503,10 @@ public:
     }
         
     Structure* booleanObjectStructure() const { return m_booleanObjectStructure.get(); }
-    Structure* callbackConstructorStructure() const { return m_callbackConstructorStructure.get(); }
-    Structure* callbackFunctionStructure() const { return m_callbackFunctionStructure.get(); }
-    Structure* callbackObjectStructure() const { return m_callbackObjectStructure.get(); }
+    // Created on first use; only the C API allocates these.
+    JS_EXPORT_PRIVATE Structure* callbackConstructorStructure();
+    JS_EXPORT_PRIVATE Structure* callbackFunctionStructure();
+    JS_EXPORT_PRIVATE Structure* callbackObjectStructure();
     Structure* propertyNameIteratorStructure() const { return m_propertyNameIteratorStructure.get(); }
 #if JSC_OBJC_API_ENABLED
     Structure* objcCallbackFunctionStructure() const { return m_objcCallbackFunctionStructure.get(); }
@@ -533,7 +537,7 @@ public:
     Structure* moduleNamespaceObjectStructure() const { return m_moduleNamespaceObjectStructure.get(); }
     Structure* proxyObjectStructure() const { return m_proxyObjectStructure.get(); }
 #if ENABLE(WEBASSEMBLY)
-    Structure* wasmModuleStructure() const { return m_wasmModuleStructure.get(); }
+    Structure* wasmModuleStructure();
 #endif
 
     JS_EXPORT_PRIVATE void setRemoteDebuggingEnabled(bool);
@@ -102,6 +102,7 @@ private:
         Local<JSObject> m_object;
         const bool m_isArray;
         bool m_isJSArray;
+        bool m_usesShapeCache;
         unsigned m_index;
         unsigned m_size;
         RefPtr<PropertyNameArrayData> m_propertyNames;
@@ -131,6 +132,12 @@ private:
     Vector<Holder, 16, UnsafeVectorOverflow> m_holderStack;
     String m_repeatedGap;
     String m_indent;
+
+    // Sibling objects in array-of-records style output overwhelmingly share a structure, so we
+    // remember the property name list and the quoted "name": prefixes of the last shape we saw.
+    Local<Structure> m_cachedShape;
+    RefPtr<PropertyNameArrayData> m_cachedShapePropertyNames;
+    Vector<String> m_cachedShapeQuotedNames;
 };
 
 // ------------------------------ helper functions --------------------------------
@@ -214,6 +221,7 @@ Stringifier::Stringifier(ExecState* exec, const Local<Unknown>& replacer, const
     , m_arrayReplacerPropertyNames(exec, PropertyNameMode::Strings)
     , m_replacerCallType(CallTypeNone)
     , m_gap(gap(exec, space.get()))
+    , m_cachedShape(exec->vm())
 {
     if (!m_replacer.isObject())
         return;
@@ -434,12 +442,30 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
                 m_size = m_object->get(exec, exec->vm().propertyNames->length).toUInt32(exec);
             builder.append('[');
         } else {
+            m_usesShapeCache = false;
             if (stringifier.m_usingArrayReplacer)
                 m_propertyNames = stringifier.m_arrayReplacerPropertyNames.data();
             else {
-                PropertyNameArray objectPropertyNames(exec, PropertyNameMode::Strings);
-                m_object->methodTable()->getOwnPropertyNames(m_object.get(), exec, objectPropertyNames, EnumerationMode());
-                m_propertyNames = objectPropertyNames.releaseData();
+                // A shape is only reusable if enumeration is fully determined by the structure's
+                // property table: no indexed properties, and no class-specific name enumeration.
+                Structure* structure = m_object->structure();
+                bool canCacheShape = structure->canAccessPropertiesQuickly()
+                    && !structure->typeInfo().overridesGetPropertyNames()
+                    && !hasIndexedProperties(m_object->indexingType());
+                if (canCacheShape && structure == stringifier.m_cachedShape.get())
+                    m_propertyNames = stringifier.m_cachedShapePropertyNames;
+                else {
+                    PropertyNameArray objectPropertyNames(exec, PropertyNameMode::Strings);
+                    m_object->methodTable()->getOwnPropertyNames(m_object.get(), exec, objectPropertyNames, EnumerationMode());
+                    m_propertyNames = objectPropertyNames.releaseData();
+                    if (canCacheShape) {
+                        stringifier.m_cachedShape = structure;
+                        stringifier.m_cachedShapePropertyNames = m_propertyNames;
+                        stringifier.m_cachedShapeQuotedNames.clear();
+                        stringifier.m_cachedShapeQuotedNames.resize(m_propertyNames->propertyNameVector().size());
+                    }
+                }
+                m_usesShapeCache = canCacheShape;
             }
             m_size = m_propertyNames->propertyNameVector().size();
             builder.append('{');
@@ -499,11 +525,27 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
             builder.append(',');
         stringifier.startNewLine(builder);
 
-        // Append the property name.
-        builder.appendQuotedJSONString(propertyName.string());
-        builder.append(':');
-        if (stringifier.willIndent())
-            builder.append(' ');
+        // Append the property name. When this holder's shape is the cached one, quote and
+        // escape each name only the first time it is emitted and reuse the prefix afterwards.
+        // A nested holder may have replaced the cache with its own shape, so recheck that the
+        // cached name list is still ours before indexing into the prefix vector.
+        if (m_usesShapeCache && stringifier.m_cachedShapePropertyNames == m_propertyNames) {
+            String& prefix = stringifier.m_cachedShapeQuotedNames[index];
+            if (prefix.isNull()) {
+                StringBuilder prefixBuilder;
+                prefixBuilder.appendQuotedJSONString(propertyName.string());
+                prefixBuilder.append(':');
+                if (stringifier.willIndent())
+                    prefixBuilder.append(' ');
+                prefix = prefixBuilder.toString();
+            }
+            builder.append(prefix);
+        } else {
+            builder.appendQuotedJSONString(propertyName.string());
+            builder.append(':');
+            if (stringifier.willIndent())
+                builder.append(' ');
+        }
 
         // Append the stringified value.
         stringifyResult = stringifier.appendStringifiedValue(builder, value, m_object.get(), propertyName);
@@ -103,11 +103,22 @@ inline JSPropertyNameEnumerator* propertyNameEnumerator(ExecState* exec, JSObjec
 {
     VM& vm = exec->vm();
 
+    Structure* structure = base->structure(vm);
+
+    // An object that uses the default getEnumerableLength and has no indexed storage
+    // trivially has an enumerable indexed length of zero, so we can return the
+    // Structure's cached enumerator without the virtual call (which walks the
+    // butterfly looking for holes).
+    if (!hasIndexedProperties(structure->indexingType())
+        && base->methodTable(vm)->getEnumerableLength == JSObject::getEnumerableLength) {
+        JSPropertyNameEnumerator* enumerator = structure->cachedPropertyNameEnumerator();
+        if (enumerator && enumerator->cachedPrototypeChain() == structure->prototypeChain(exec))
+            return enumerator;
+    }
+
     uint32_t indexedLength = base->methodTable(vm)->getEnumerableLength(exec, base);
 
     JSPropertyNameEnumerator* enumerator = nullptr;
-
-    Structure* structure = base->structure(vm);
     if (!indexedLength
         && (enumerator = structure->cachedPropertyNameEnumerator())
         && enumerator->cachedPrototypeChain() == structure->prototypeChain(exec))
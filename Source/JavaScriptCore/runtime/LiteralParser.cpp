@@ -40,6 +40,10 @@
 #include <wtf/dtoa.h>
 #include <wtf/text/StringBuilder.h>
 
+#if CPU(X86_64) && !ASAN_ENABLED
+#include <emmintrin.h>
+#endif
+
 namespace JSC {
 
 template <typename CharType>
@@ -346,6 +350,30 @@ template <ParserMode mode, typename CharType, UChar terminator> static inline bo
     return (c >= ' ' && (mode == StrictJSON || c <= 0xff) && c != '\\' && c != terminator) || (c == '\t' && mode != StrictJSON);
 }
 
+#if CPU(X86_64) && !ASAN_ENABLED
+// String bodies in large JSON payloads are overwhelmingly runs of plain characters,
+// so scan 16 bytes at a time for the next quote, backslash, or control character
+// instead of one. This is conservative: only chunks with no candidate at all are
+// skipped, and the scalar loop re-examines the chunk the scan stopped in, which
+// keeps modes with extra safe characters (\t outside StrictJSON) correct.
+template <char terminator> static ALWAYS_INLINE const LChar* findUnsafeStringCharacter(const LChar* ptr, const LChar* end)
+{
+    const __m128i quoteChars = _mm_set1_epi8(terminator);
+    const __m128i escapeChars = _mm_set1_epi8('\\');
+    const __m128i maxControlCharacter = _mm_set1_epi8(0x1F);
+    while (ptr + 16 <= end) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        __m128i unsafeChars = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quoteChars), _mm_cmpeq_epi8(chunk, escapeChars)),
+            _mm_cmpeq_epi8(_mm_min_epu8(chunk, maxControlCharacter), chunk));
+        if (_mm_movemask_epi8(unsafeChars))
+            break;
+        ptr += 16;
+    }
+    return ptr;
+}
+#endif
+
 template <typename CharType>
 template <ParserMode mode, char terminator> ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserToken<CharType>& token)
 {
@@ -354,6 +382,10 @@ template <ParserMode mode, char terminator> ALWAYS_INLINE TokenType LiteralParse
     StringBuilder builder;
     do {
         runStart = m_ptr;
+#if CPU(X86_64) && !ASAN_ENABLED
+        if (sizeof(CharType) == 1)
+            m_ptr = reinterpret_cast<const CharType*>(findUnsafeStringCharacter<terminator>(reinterpret_cast<const LChar*>(m_ptr), reinterpret_cast<const LChar*>(m_end)));
+#endif
         while (m_ptr < m_end && isSafeStringCharacter<mode, CharType, terminator>(*m_ptr))
             ++m_ptr;
         if (builder.length())
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MegamorphicGetByIdCache_h
+#define MegamorphicGetByIdCache_h
+
+#include "PropertyOffset.h"
+#include "StructureIDTable.h"
+#include <array>
+#include <wtf/text/UniquedStringImpl.h>
+
+namespace JSC {
+
+// A direct-mapped (StructureID, uid) -> offset cache for get_by_id sites that
+// have exhausted their PolymorphicAccess list and been bound to the generic
+// slow path. It only caches loads of own value properties on non-dictionary
+// structures, so an entry is an invariant of its structure: any shape change
+// allocates a new structure and therefore a new key. Structure IDs and the
+// identifiers baked into code can only die during a collection, so the heap
+// clears the cache on every cycle before recycled keys can match stale
+// entries.
+class MegamorphicGetByIdCache {
+public:
+    MegamorphicGetByIdCache()
+    {
+        clear();
+    }
+
+    PropertyOffset tryGet(StructureID structureID, UniquedStringImpl* uid)
+    {
+        Entry& entry = m_entries[hash(structureID, uid) & mask];
+        if (entry.structureID == structureID && entry.uid == uid)
+            return entry.offset;
+        return invalidOffset;
+    }
+
+    void set(StructureID structureID, UniquedStringImpl* uid, PropertyOffset offset)
+    {
+        Entry& entry = m_entries[hash(structureID, uid) & mask];
+        entry.structureID = structureID;
+        entry.uid = uid;
+        entry.offset = offset;
+    }
+
+    void clear()
+    {
+        for (Entry& entry : m_entries) {
+            entry.structureID = 0;
+            entry.uid = nullptr;
+            entry.offset = invalidOffset;
+        }
+    }
+
+private:
+    static const unsigned size = 2048;
+    static const unsigned mask = size - 1;
+
+    struct Entry {
+        StructureID structureID;
+        UniquedStringImpl* uid;
+        PropertyOffset offset;
+    };
+
+    static unsigned hash(StructureID structureID, UniquedStringImpl* uid)
+    {
+#if USE(JSVALUE64)
+        unsigned structureHash = structureID;
+#else
+        unsigned structureHash = static_cast<unsigned>(reinterpret_cast<uintptr_t>(structureID) >> 4);
+#endif
+        return structureHash ^ uid->existingSymbolAwareHash();
+    }
+
+    std::array<Entry, size> m_entries;
+};
+
+} // namespace JSC
+
+#endif // MegamorphicGetByIdCache_h
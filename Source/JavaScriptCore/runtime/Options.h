@@ -202,7 +202,7 @@ typedef const char* optionString;
     v(bool, useCopyBarrierOptimization, true, nullptr) \
     \
     v(bool, useConcurrentJIT, true, "allows the DFG / FTL compilation in threads other than the executing JS thread") \
-    v(unsigned, numberOfDFGCompilerThreads, computeNumberOfWorkerThreads(2, 2) - 1, nullptr) \
+    v(unsigned, numberOfDFGCompilerThreads, computeNumberOfWorkerThreads(4, 2) - 1, nullptr) \
     v(unsigned, numberOfFTLCompilerThreads, computeNumberOfWorkerThreads(8, 2) - 1, nullptr) \
     v(int32, priorityDeltaOfDFGCompilerThreads, computePriorityDeltaOfWorkerThreads(-1, 0), nullptr) \
     v(int32, priorityDeltaOfFTLCompilerThreads, computePriorityDeltaOfWorkerThreads(-2, 0), nullptr) \
@@ -243,6 +243,7 @@ typedef const char* optionString;
     v(bool, forceEagerCompilation, false, nullptr) \
     v(int32, thresholdForJITAfterWarmUp, 500, nullptr) \
     v(int32, thresholdForJITSoon, 100, nullptr) \
+    v(unsigned, thresholdForRegExpTierUp, 10, "number of interpreted matches before a regular expression is promoted to the Yarr JIT; 0 compiles eagerly") \
     \
     v(int32, thresholdForOptimizeAfterWarmUp, 1000, nullptr) \
     v(int32, thresholdForOptimizeAfterLongWarmUp, 1000, nullptr) \
@@ -257,6 +258,9 @@ typedef const char* optionString;
     v(unsigned, ftlOSREntryFailureCountForReoptimization, 15, nullptr) \
     v(unsigned, ftlOSREntryRetryThreshold, 100, nullptr) \
     \
+    v(double, worklistLoadThresholdMultiplier, 0.25, "additional scaling of optimization thresholds per compile pending in the DFG and FTL worklists; 0 disables load-adaptive tier-up") \
+    v(double, loadingPhaseThresholdMultiplier, 2.0, "scaling applied to optimization thresholds while the embedder signals a loading phase via VM::setIsInLoadingPhase()") \
+    \
     v(int32, evalThresholdMultiplier, 10, nullptr) \
     v(unsigned, maximumEvalCacheableSourceLength, 256, nullptr) \
     \
@@ -286,12 +290,15 @@ typedef const char* optionString;
     \
     v(unsigned, minimumNumberOfScansBetweenRebalance, 100, nullptr) \
     v(unsigned, numberOfGCMarkers, computeNumberOfGCMarkers(7), nullptr) \
+    v(bool, useConcurrentMarking, false, "enable the retreating-wavefront store barrier so marking can overlap mutator execution") \
     v(unsigned, opaqueRootMergeThreshold, 1000, nullptr) \
     v(double, minHeapUtilization, 0.8, nullptr) \
     v(double, minCopiedBlockUtilization, 0.9, nullptr) \
     v(double, minMarkedBlockUtilization, 0.9, nullptr) \
     v(unsigned, slowPathAllocsBetweenGCs, 0, "force a GC on every Nth slow path alloc, where N is specified by this option") \
     \
+    v(unsigned, codeCacheMinimumCapacityMB, 0, "floor for the unlinked code cache's adaptive capacity, so embedders that reload the same sources can keep their bytecode resident") \
+    \
     v(double, percentCPUPerMBForFullTimer, 0.0003125, nullptr) \
     v(double, percentCPUPerMBForEdenTimer, 0.0025, nullptr) \
     v(double, collectionTimerMaxPercentCPU, 0.05, nullptr) \
@@ -334,9 +341,11 @@ typedef const char* optionString;
     v(unsigned, fireOSRExitFuzzAtOrAfter, 0, nullptr) \
     \
     v(bool, logB3PhaseTimes, false, nullptr) \
+    v(double, b3PhaseBudgetMS, 0, "soft per-procedure budget in milliseconds; when exceeded, B3 sheds optional optimization phases (0 = no budget)") \
     v(double, rareBlockPenalty, 0.001, nullptr) \
     v(bool, airSpillsEverything, false, nullptr) \
     v(bool, logAirRegisterPressure, false, nullptr) \
+    v(bool, logAirPeepholeStats, false, "logs instruction counts before and after the Air peephole phase") \
     v(unsigned, maxB3TailDupBlockSize, 3, nullptr) \
     v(unsigned, maxB3TailDupBlockSuccessors, 3, nullptr) \
     \
@@ -69,7 +69,44 @@ void ProxyObject::finishCreation(VM& vm, ExecState* exec, JSValue target, JSValu
     m_handler.set(vm, this, handler);
 }
 
-static EncodedJSValue performProxyGet(ExecState* exec, EncodedJSValue thisValue, PropertyName propertyName)
+JSValue ProxyObject::getHandlerTrap(ExecState* exec, JSObject* handler, CallData& callData, CallType& callType, const Identifier& name, const char* errorMessage, TrapCache& cache)
+{
+    VM& vm = exec->vm();
+    if (cache.trap && handler->structure(vm) == cache.handlerStructure.get() && cache.replacementWatchpoint->isStillValid()) {
+        JSObject* trap = cache.trap.get();
+        callType = trap->methodTable()->getCallData(trap, callData);
+        ASSERT(callType != CallTypeNone);
+        return trap;
+    }
+
+    cache.trap.clear();
+
+    JSValue trap = handler->getMethod(exec, callData, callType, name, ASCIILiteral(errorMessage));
+    if (exec->hadException())
+        return trap;
+
+    // Cache the resolution when the trap is a plain own data property of the handler. Adding or
+    // removing handler properties changes the handler's structure, and overwriting the trap in
+    // place fires the replacement watchpoint, so a cache hit is guaranteed to see the same
+    // function a fresh lookup would.
+    Structure& structure = *handler->structure(vm);
+    if (trap.isObject() && !structure.isUncacheableDictionary() && JSCell::canUseFastGetOwnProperty(structure)) {
+        unsigned attributes;
+        PropertyOffset offset = structure.get(vm, name, attributes);
+        if (isValidOffset(offset) && !(attributes & (Accessor | CustomAccessor)) && handler->getDirect(offset) == trap) {
+            WatchpointSet* replacementWatchpoint = structure.ensurePropertyReplacementWatchpointSet(vm, offset);
+            if (replacementWatchpoint->isStillValid()) {
+                cache.handlerStructure.set(vm, this, &structure);
+                cache.trap.set(vm, this, asObject(trap));
+                cache.replacementWatchpoint = replacementWatchpoint;
+            }
+        }
+    }
+
+    return trap;
+}
+
+EncodedJSValue ProxyObject::performProxyGet(ExecState* exec, EncodedJSValue thisValue, PropertyName propertyName)
 {
     VM& vm = exec->vm();
     JSObject* thisObject = jsCast<JSObject*>(JSValue::decode(thisValue)); // This might be a value where somewhere in __proto__ chain lives a ProxyObject.
@@ -94,7 +131,7 @@ static EncodedJSValue performProxyGet(ExecState* exec, EncodedJSValue thisValue,
     JSObject* handler = jsCast<JSObject*>(handlerValue);
     CallData callData;
     CallType callType;
-    JSValue getHandler = handler->getMethod(exec, callData, callType, vm.propertyNames->get, ASCIILiteral("'get' property of a Proxy's handler object should be callable."));
+    JSValue getHandler = proxyObject->getHandlerTrap(exec, handler, callData, callType, vm.propertyNames->get, "'get' property of a Proxy's handler object should be callable.", proxyObject->m_getTrapCache);
     if (exec->hadException())
         return JSValue::encode(jsUndefined());
 
@@ -142,7 +179,7 @@ bool ProxyObject::performInternalMethodGetOwnProperty(ExecState* exec, PropertyN
     JSObject* handler = jsCast<JSObject*>(handlerValue);
     CallData callData;
     CallType callType;
-    JSValue getOwnPropertyDescriptorMethod = handler->getMethod(exec, callData, callType, makeIdentifier(vm, "getOwnPropertyDescriptor"), ASCIILiteral("'getOwnPropertyDescriptor' property of a Proxy's handler should be callable."));
+    JSValue getOwnPropertyDescriptorMethod = getHandlerTrap(exec, handler, callData, callType, makeIdentifier(vm, "getOwnPropertyDescriptor"), "'getOwnPropertyDescriptor' property of a Proxy's handler should be callable.", m_getOwnPropertyDescriptorTrapCache);
     if (exec->hadException())
         return false;
     JSObject* target = this->target();
@@ -224,7 +261,7 @@ bool ProxyObject::performHasProperty(ExecState* exec, PropertyName propertyName,
     JSObject* handler = jsCast<JSObject*>(handlerValue);
     CallData callData;
     CallType callType;
-    JSValue hasMethod = handler->getMethod(exec, callData, callType, vm.propertyNames->has, ASCIILiteral("'has' property of a Proxy's handler should be callable."));
+    JSValue hasMethod = getHandlerTrap(exec, handler, callData, callType, vm.propertyNames->has, "'has' property of a Proxy's handler should be callable.", m_hasTrapCache);
     if (exec->hadException())
         return false;
     JSObject* target = this->target();
@@ -306,6 +343,12 @@ void ProxyObject::visitChildren(JSCell* cell, SlotVisitor& visitor)
 
     visitor.append(&thisObject->m_target);
     visitor.append(&thisObject->m_handler);
+    visitor.append(&thisObject->m_getTrapCache.handlerStructure);
+    visitor.append(&thisObject->m_getTrapCache.trap);
+    visitor.append(&thisObject->m_getOwnPropertyDescriptorTrapCache.handlerStructure);
+    visitor.append(&thisObject->m_getOwnPropertyDescriptorTrapCache.trap);
+    visitor.append(&thisObject->m_hasTrapCache.handlerStructure);
+    visitor.append(&thisObject->m_hasTrapCache.trap);
 }
 
 } // namespace JSC
@@ -59,16 +59,32 @@ private:
     ProxyObject(VM&, Structure*);
     void finishCreation(VM&, ExecState*, JSValue target, JSValue handler);
 
+    static EncodedJSValue performProxyGet(ExecState*, EncodedJSValue thisValue, PropertyName);
     static bool getOwnPropertySlot(JSObject*, ExecState*, PropertyName, PropertySlot&);
     static bool getOwnPropertySlotByIndex(JSObject*, ExecState*, unsigned propertyName, PropertySlot&);
     static void visitChildren(JSCell*, SlotVisitor&);
 
+    // A hot proxy resolves the same trap on the same handler over and over, so we remember the
+    // resolution as long as the handler keeps the recorded structure and the trap property has
+    // not been replaced in place. The write barriers keep the recorded objects alive, and the
+    // structure in turn owns the watchpoint set, so the raw pointer stays valid while it is set.
+    struct TrapCache {
+        WriteBarrier<Structure> handlerStructure;
+        WriteBarrier<JSObject> trap;
+        WatchpointSet* replacementWatchpoint { nullptr };
+    };
+
+    JSValue getHandlerTrap(ExecState*, JSObject* handler, CallData&, CallType&, const Identifier&, const char* errorMessage, TrapCache&);
+
     bool getOwnPropertySlotCommon(ExecState*, PropertyName, PropertySlot&);
     bool performInternalMethodGetOwnProperty(ExecState*, PropertyName, PropertySlot&);
     bool performHasProperty(ExecState*, PropertyName, PropertySlot&);
 
     WriteBarrier<JSObject> m_target;
     WriteBarrier<Unknown> m_handler;
+    TrapCache m_getTrapCache;
+    TrapCache m_getOwnPropertyDescriptorTrapCache;
+    TrapCache m_hasTrapCache;
 };
 
 } // namespace JSC
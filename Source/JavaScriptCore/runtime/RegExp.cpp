@@ -234,6 +234,9 @@ RegExp::RegExp(VM& vm, const String& patternString, RegExpFlags flags)
     , m_rtMatchCallCount(0)
     , m_rtMatchFoundCount(0)
 #endif
+#if ENABLE(YARR_JIT)
+    , m_tierUpCount(0)
+#endif
 {
 }
 
@@ -297,7 +300,8 @@ void RegExp::compile(VM* vm, Yarr::YarrCharSize charSize)
     }
 
 #if ENABLE(YARR_JIT)
-    if (!pattern.m_containsBackreferences && !pattern.containsUnsignedLengthPattern() && vm->canUseRegExpJIT()) {
+    if (!pattern.m_containsBackreferences && !pattern.containsUnsignedLengthPattern() && vm->canUseRegExpJIT()
+        && (m_state == JITCode || m_tierUpCount >= Options::thresholdForRegExpTierUp())) {
         Yarr::jitCompile(pattern, charSize, vm, m_regExpJITCode);
         if (!m_regExpJITCode.isFallBack()) {
             m_state = JITCode;
@@ -312,16 +316,34 @@ void RegExp::compile(VM* vm, Yarr::YarrCharSize charSize)
     m_regExpBytecode = Yarr::byteCompile(pattern, &vm->m_regExpAllocator);
 }
 
+#if ENABLE(YARR_JIT)
+// Patterns start out in the interpreter and are promoted to the JIT only once
+// they have matched often enough to pay back the compile cost; one-shot regexps
+// never leave the interpreter. Returns true exactly once, when the pattern
+// crosses the threshold - afterwards the pattern has either been promoted or
+// shown to be unJITable (the attempt fell back to bytecode), so we never
+// re-parse it per match.
+bool RegExp::shouldTierUp()
+{
+    if (m_tierUpCount >= Options::thresholdForRegExpTierUp())
+        return false;
+    return ++m_tierUpCount >= Options::thresholdForRegExpTierUp();
+}
+#endif
+
 void RegExp::compileIfNecessary(VM& vm, Yarr::YarrCharSize charSize)
 {
     if (hasCode()) {
 #if ENABLE(YARR_JIT)
-        if (m_state != JITCode)
-            return;
-        if ((charSize == Yarr::Char8) && (m_regExpJITCode.has8BitCode()))
-            return;
-        if ((charSize == Yarr::Char16) && (m_regExpJITCode.has16BitCode()))
-            return;
+        if (m_state != JITCode) {
+            if (!shouldTierUp())
+                return;
+        } else {
+            if ((charSize == Yarr::Char8) && (m_regExpJITCode.has8BitCode()))
+                return;
+            if ((charSize == Yarr::Char16) && (m_regExpJITCode.has16BitCode()))
+                return;
+        }
 #else
         return;
 #endif
@@ -416,7 +438,8 @@ void RegExp::compileMatchOnly(VM* vm, Yarr::YarrCharSize charSize)
     }
 
 #if ENABLE(YARR_JIT)
-    if (!pattern.m_containsBackreferences && !pattern.containsUnsignedLengthPattern() && vm->canUseRegExpJIT()) {
+    if (!pattern.m_containsBackreferences && !pattern.containsUnsignedLengthPattern() && vm->canUseRegExpJIT()
+        && (m_state == JITCode || m_tierUpCount >= Options::thresholdForRegExpTierUp())) {
         Yarr::jitCompile(pattern, charSize, vm, m_regExpJITCode, Yarr::MatchOnly);
         if (!m_regExpJITCode.isFallBack()) {
             m_state = JITCode;
@@ -435,12 +458,15 @@ void RegExp::compileIfNecessaryMatchOnly(VM& vm, Yarr::YarrCharSize charSize)
 {
     if (hasCode()) {
 #if ENABLE(YARR_JIT)
-        if (m_state != JITCode)
-            return;
-        if ((charSize == Yarr::Char8) && (m_regExpJITCode.has8BitCodeMatchOnly()))
-            return;
-        if ((charSize == Yarr::Char16) && (m_regExpJITCode.has16BitCodeMatchOnly()))
-            return;
+        if (m_state != JITCode) {
+            if (!shouldTierUp())
+                return;
+        } else {
+            if ((charSize == Yarr::Char8) && (m_regExpJITCode.has8BitCodeMatchOnly()))
+                return;
+            if ((charSize == Yarr::Char16) && (m_regExpJITCode.has16BitCodeMatchOnly()))
+                return;
+        }
 #else
         return;
 #endif
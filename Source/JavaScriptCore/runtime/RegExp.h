@@ -109,6 +109,10 @@ private:
     void compileMatchOnly(VM*, Yarr::YarrCharSize);
     void compileIfNecessaryMatchOnly(VM&, Yarr::YarrCharSize);
 
+#if ENABLE(YARR_JIT)
+    bool shouldTierUp();
+#endif
+
 #if ENABLE(YARR_JIT_DEBUG)
     void matchCompareWithInterpreter(const String&, int startOffset, int* offsetVector, int jitResult);
 #endif
@@ -127,6 +131,7 @@ private:
 #endif
 
 #if ENABLE(YARR_JIT)
+    unsigned m_tierUpCount;
     Yarr::YarrCodeBlock m_regExpJITCode;
 #endif
     std::unique_ptr<Yarr::BytecodePattern> m_regExpBytecode;
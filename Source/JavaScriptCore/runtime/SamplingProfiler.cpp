@@ -343,6 +343,7 @@ void SamplingProfiler::processUnverifiedStackTraces()
                 int endOffset;
                 codeBlock->expressionRangeForBytecodeOffset(bytecodeIndex, divot, startOffset, endOffset,
                     stackTrace.frames.last().lineNumber, stackTrace.frames.last().columnNumber);
+                stackTrace.frames.last().bytecodeIndex = bytecodeIndex;
             }
         };
 
@@ -760,6 +761,63 @@ String SamplingProfiler::stackTracesAsJSON()
     return json.toString();
 }
 
+String SamplingProfiler::stackTracesAsDetailedJSON()
+{
+    LockHolder locker(m_lock);
+
+    {
+        HeapIterationScope heapIterationScope(m_vm.heap);
+        processUnverifiedStackTraces();
+    }
+
+    StringBuilder json;
+    json.append('[');
+
+    bool loopedOnce = false;
+    auto comma = [&] {
+        if (loopedOnce)
+            json.append(',');
+    };
+    for (StackTrace& stackTrace : m_stackTraces) {
+        comma();
+        json.appendLiteral("{\"timestamp\":");
+        json.appendECMAScriptNumber(stackTrace.timestamp);
+        json.appendLiteral(",\"frames\":[");
+        loopedOnce = false;
+        for (StackFrame& stackFrame : stackTrace.frames) {
+            comma();
+            json.appendLiteral("{\"name\":");
+            json.appendQuotedJSONString(stackFrame.displayName(m_vm));
+            json.appendLiteral(",\"url\":");
+            json.appendQuotedJSONString(stackFrame.url());
+            json.appendLiteral(",\"sourceID\":");
+            json.appendNumber(static_cast<long long>(stackFrame.sourceID()));
+            json.appendLiteral(",\"line\":");
+            if (stackFrame.hasExpressionInfo()) {
+                json.appendNumber(stackFrame.lineNumber);
+                json.appendLiteral(",\"column\":");
+                json.appendNumber(stackFrame.columnNumber);
+            } else
+                json.appendLiteral("-1,\"column\":-1");
+            json.appendLiteral(",\"bytecodeIndex\":");
+            if (stackFrame.bytecodeIndex != std::numeric_limits<unsigned>::max())
+                json.appendNumber(stackFrame.bytecodeIndex);
+            else
+                json.appendLiteral("-1");
+            json.append('}');
+            loopedOnce = true;
+        }
+        json.appendLiteral("]}");
+        loopedOnce = true;
+    }
+
+    json.append(']');
+
+    clearData(locker);
+
+    return json.toString();
+}
+
 } // namespace JSC
 
 namespace WTF {
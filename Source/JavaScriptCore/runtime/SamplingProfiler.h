@@ -83,6 +83,8 @@ public:
         // These attempt to be expression-level line and column number.
         unsigned lineNumber { std::numeric_limits<unsigned>::max() };
         unsigned columnNumber { std::numeric_limits<unsigned>::max() };
+        // This is the baseline CodeBlock's bytecode offset the sample was attributed to.
+        unsigned bytecodeIndex { std::numeric_limits<unsigned>::max() };
 
         bool hasExpressionInfo() const
         {
@@ -133,6 +135,7 @@ public:
     void stop(const LockHolder&);
     Vector<StackTrace> releaseStackTraces(const LockHolder&);
     JS_EXPORT_PRIVATE String stackTracesAsJSON();
+    JS_EXPORT_PRIVATE String stackTracesAsDetailedJSON();
     JS_EXPORT_PRIVATE void noticeCurrentThreadAsJSCExecutionThread();
     void noticeCurrentThreadAsJSCExecutionThread(const LockHolder&);
     void processUnverifiedStackTraces(); // You should call this only after acquiring the lock.
@@ -466,11 +466,24 @@ Structure* Structure::addPropertyTransition(VM& vm, Structure* structure, Proper
     transition->m_cachedPrototypeChain.setMayBeNull(vm, transition, structure->m_cachedPrototypeChain.get());
     transition->m_nameInPrevious = propertyName.uid();
     transition->setAttributesInPrevious(attributes);
-    transition->propertyTable().set(vm, transition, structure->takePropertyTableOrCloneIfPinned(vm));
-    transition->m_offset = structure->m_offset;
     transition->m_inferredTypeTable.setMayBeNull(vm, transition, structure->m_inferredTypeTable.get());
 
-    offset = transition->add(vm, propertyName, attributes);
+    if (!structure->propertyTable() && !structure->isPinnedPropertyTable()) {
+        // The previous structure already lost its table to an earlier transition.
+        // Rebuilding it here just so this transition can steal it would duplicate the
+        // shared ancestor prefix for every sibling shape. Stay table-less instead: the
+        // new offset is derivable arithmetically because cached transition chains never
+        // shrink, and materialization stays lazy for whichever descendant first needs a
+        // table.
+        if (attributes & DontEnum)
+            transition->setHasNonEnumerableProperties(true);
+        offset = offsetForPropertyNumber(numberOfSlotsForLastOffset(structure->m_offset, structure->inlineCapacity()), structure->inlineCapacity());
+        transition->m_offset = offset;
+    } else {
+        transition->propertyTable().set(vm, transition, structure->takePropertyTableOrCloneIfPinned(vm));
+        transition->m_offset = structure->m_offset;
+        offset = transition->add(vm, propertyName, attributes);
+    }
 
     checkOffset(transition->m_offset, transition->inlineCapacity());
     {
@@ -43,6 +43,7 @@
 #include "JSLock.h"
 #include "LLIntData.h"
 #include "MacroAssemblerCodeRef.h"
+#include "MegamorphicGetByIdCache.h"
 #include "Microtask.h"
 #include "NumericStrings.h"
 #include "PrivateName.h"
@@ -340,6 +341,7 @@ public:
     WeakGCMap<std::pair<CustomGetterSetter*, int>, JSBoundSlotBaseFunction> customGetterSetterFunctionMap;
     WeakGCMap<StringImpl*, JSString, PtrHash<StringImpl*>> stringCache;
     Strong<JSString> lastCachedString;
+    MegamorphicGetByIdCache megamorphicGetByIdCache;
 
     AtomicStringTable* atomicStringTable() const { return m_atomicStringTable; }
     WTF::SymbolRegistry& symbolRegistry() { return m_symbolRegistry; }
@@ -446,6 +448,12 @@ public:
         m_failNextNewCodeBlock = false;
         return result;
     }
+
+    // Embedders can signal that they are in a loading phase, where execution is bursty and
+    // compiler threads compete with it for cores, to make tier-up more reluctant until the
+    // workload reaches steady state. See Options::loadingPhaseThresholdMultiplier().
+    void setIsInLoadingPhase(bool isInLoadingPhase) { m_isInLoadingPhase = isInLoadingPhase; }
+    bool isInLoadingPhase() const { return m_isInLoadingPhase; }
     
     void* stackPointerAtVMEntry() const { return m_stackPointerAtVMEntry; }
     void setStackPointerAtVMEntry(void*);
@@ -656,6 +664,7 @@ private:
     Exception* m_exception { nullptr };
     Exception* m_lastException { nullptr };
     bool m_failNextNewCodeBlock { false };
+    bool m_isInLoadingPhase { false };
     bool m_inDefineOwnProperty;
     bool m_shouldRewriteConstAsVar { false };
     bool m_shouldBuildPCToCodeOriginMapping { false };
@@ -27,10 +27,12 @@
 #include "JSDollarVMPrototype.h"
 
 #include "CodeBlock.h"
+#include "ExecutableAllocator.h"
 #include "Heap.h"
 #include "HeapIterationScope.h"
 #include "JSCInlines.h"
 #include "JSFunction.h"
+#include "ObjectConstructor.h"
 #include "StackVisitor.h"
 #include <wtf/DataLog.h>
 
@@ -400,6 +402,24 @@ static EncodedJSValue JSC_HOST_CALL functionPrintValue(ExecState* exec)
     return JSValue::encode(jsUndefined());
 }
 
+#if ENABLE(ASSEMBLER)
+// Returns an object describing the executable memory allocator's occupancy,
+// so fragmentation of the pool can be monitored from tests and long-running
+// processes.
+static EncodedJSValue JSC_HOST_CALL functionJITMemoryStatistics(ExecState* exec)
+{
+    VM& vm = exec->vm();
+    JSObject* result = constructEmptyObject(exec);
+    result->putDirect(vm, Identifier::fromString(&vm, "committedBytes"), jsNumber(static_cast<double>(ExecutableAllocator::committedByteCount())));
+
+    MetaAllocator::FreeSpaceStatistics freeSpace = ExecutableAllocator::currentFreeSpaceStatistics();
+    result->putDirect(vm, Identifier::fromString(&vm, "freeBlockCount"), jsNumber(static_cast<double>(freeSpace.freeBlockCount)));
+    result->putDirect(vm, Identifier::fromString(&vm, "largestFreeBlock"), jsNumber(static_cast<double>(freeSpace.largestFreeBlock)));
+    result->putDirect(vm, Identifier::fromString(&vm, "totalFreeBytes"), jsNumber(static_cast<double>(freeSpace.totalFreeBytes)));
+    return JSValue::encode(result);
+}
+#endif
+
 void JSDollarVMPrototype::finishCreation(VM& vm, JSGlobalObject* globalObject)
 {
     Base::finishCreation(vm);
@@ -423,6 +443,10 @@ void JSDollarVMPrototype::finishCreation(VM& vm, JSGlobalObject* globalObject)
     addFunction(vm, globalObject, "printStack", functionPrintStack, 0);
 
     addFunction(vm, globalObject, "printValue", functionPrintValue, 1);
+
+#if ENABLE(ASSEMBLER)
+    addFunction(vm, globalObject, "jitMemoryStatistics", functionJITMemoryStatistics, 0);
+#endif
 }
 
 } // namespace JSC
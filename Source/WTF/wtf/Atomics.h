@@ -154,6 +154,23 @@ inline void memoryBarrierBeforeUnlock() { compilerFence(); }
 
 #endif
 
+// Hints to the CPU that we are in a spin-wait loop. Much cheaper than yielding to
+// the scheduler, which matters when the expected wait is shorter than a context
+// switch; spin loops should use this for their first iterations and only then fall
+// back to yielding.
+inline void spinLoopHint()
+{
+#if OS(WINDOWS)
+    YieldProcessor();
+#elif CPU(X86) || CPU(X86_64)
+    asm volatile("pause" ::: "memory");
+#elif CPU(ARM64)
+    asm volatile("yield" ::: "memory");
+#else
+    compilerFence();
+#endif
+}
+
 } // namespace WTF
 
 using WTF::Atomic;
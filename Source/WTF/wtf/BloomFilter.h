@@ -61,6 +61,11 @@ public:
     bool mayContain(const AtomicString& string) const { return mayContain(string.impl()->existingHash()); }
     bool mayContain(const String& string) const { return mayContain(string.impl()->hash()); }
 
+    // Raw access to the underlying table, for clients that persist the filter.
+    typedef std::array<unsigned, tableSize / (8 * sizeof(unsigned))> RawTable;
+    const RawTable& rawTable() const { return m_bitArray; }
+    void setRawTable(const RawTable& table) { m_bitArray = table; }
+
 private:
     static const unsigned bitsPerPosition = 8 * sizeof(unsigned);
     static const unsigned keyMask = (1 << keyBits) - 1;
@@ -186,16 +186,37 @@ public:
         unsigned n = arrayLength();
         for (unsigned i = 0; i < n; ++i) {
             uint32_t word = m_array[i];
-            unsigned j = i << 5;
+            unsigned base = i << 5;
+            // Jump straight to each set bit by counting trailing zeros and then
+            // clearing the lowest set bit, instead of shifting through every bit
+            // of the word. Liveness bitvectors are mostly zero, so this is a lot
+            // less work per word.
             while (word) {
-                if (word & 1)
-                    functor(j);
-                word >>= 1;
-                j++;
+                functor(base + countTrailingZeros32(word));
+                word &= word - 1;
             }
         }
     }
 
+    // Returns the index of the first set bit at or after 'index', or numBits() if
+    // there is no such bit.
+    size_t findNextSetBit(size_t index) const
+    {
+        if (index >= m_numBits)
+            return m_numBits;
+        size_t arrayIndex = index >> 5;
+        size_t n = arrayLength();
+        uint32_t word = m_array[arrayIndex] & (~static_cast<uint32_t>(0) << (index & 31));
+        while (!word) {
+            if (++arrayIndex == n)
+                return m_numBits;
+            word = m_array[arrayIndex];
+        }
+        size_t result = (arrayIndex << 5) + countTrailingZeros32(word);
+        // setAll() sets the padding bits in the last word, so clamp to the logical size.
+        return result < m_numBits ? result : m_numBits;
+    }
+
     WTF_EXPORT_PRIVATE void dump(PrintStream&) const;
     
 private:
@@ -83,6 +83,7 @@ public:
 
     unsigned size() const;
     unsigned capacity() const;
+    void reserveInitialCapacity(unsigned keyCount) { m_impl.reserveInitialCapacity(keyCount); }
     bool isEmpty() const;
 
     // iterators iterate over pairs of keys and values
@@ -65,6 +65,7 @@ namespace WTF {
 
         unsigned size() const;
         unsigned capacity() const;
+        void reserveInitialCapacity(unsigned keyCount) { m_impl.reserveInitialCapacity(keyCount); }
         bool isEmpty() const;
 
         iterator begin() const;
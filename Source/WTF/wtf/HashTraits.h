@@ -44,8 +44,10 @@ template<typename T> struct GenericHashTraitsBase<false, T> {
     static const bool hasIsEmptyValueFunction = false;
 
     // The starting table size. Can be overridden when we know beforehand that
-    // a hash table will have at least N entries.
-    static const unsigned minimumTableSize = 8;
+    // a hash table will have at least N entries. The default is deliberately small:
+    // a large share of tables (rare-data maps and the like) never hold more than one
+    // entry, and they are better served by the smallest allocation that fits.
+    static const unsigned minimumTableSize = 4;
 };
 
 // Default integer traits disallow both 0 and -1 as keys (max value instead of -1 for unsigned).
@@ -42,6 +42,11 @@ NEVER_INLINE void LockBase::lockSlow()
 
     // This magic number turns out to be optimal based on past JikesRVM experiments.
     const unsigned spinLimit = 40;
+
+    // Stay on-CPU with a pause instruction for the first spins: most hold times are far
+    // shorter than a context switch, and yield() from many waiters just migrates the
+    // contended line across cores. Only involve the scheduler once that hasn't worked.
+    const unsigned pauseSpinLimit = 16;
     
     for (;;) {
         uint8_t currentByteValue = m_byte.load();
@@ -56,7 +61,10 @@ NEVER_INLINE void LockBase::lockSlow()
         // If there is nobody parked and we haven't spun too much, we can just try to spin around.
         if (!(currentByteValue & hasParkedBit) && spinCount < spinLimit) {
             spinCount++;
-            std::this_thread::yield();
+            if (spinCount <= pauseSpinLimit)
+                spinLoopHint();
+            else
+                std::this_thread::yield();
             continue;
         }
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WTF_MPSCQueue_h
+#define WTF_MPSCQueue_h
+
+#include <wtf/Atomics.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/StdLibExtras.h>
+
+namespace WTF {
+
+// A lock-free multiple-producer single-consumer FIFO. Producers enqueue with a single
+// successful compare-and-swap and never block, so posting from many threads does not
+// contend on a mutex. The consumer moves the whole backlog into a private batch with one
+// atomic operation and pops from that, keeping the per-item cost of draining constant.
+template<typename T>
+class MPSCQueue {
+    WTF_MAKE_NONCOPYABLE(MPSCQueue);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    MPSCQueue()
+    {
+        m_incoming.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~MPSCQueue()
+    {
+        drain();
+        while (Node* node = m_batch) {
+            m_batch = node->next;
+            delete node;
+        }
+    }
+
+    // Safe to call from any thread. Returns true when the queue looked empty to this
+    // producer, meaning the consumer may be idle and need a wakeup; chained producers can
+    // rely on the drain that picks up their predecessor picking them up as well.
+    bool append(T&& data)
+    {
+        Node* node = new Node(WTFMove(data));
+        Node* previousHead;
+        do {
+            previousHead = m_incoming.load(std::memory_order_relaxed);
+            node->next = previousHead;
+        } while (!m_incoming.compareExchangeWeak(previousHead, node, std::memory_order_release));
+        return !previousHead;
+    }
+
+    // The functions below may only be called from the consumer thread.
+
+    // Moves everything produced so far into the consumer-side batch and returns how many
+    // items are now waiting. Bounding a processing loop by this count guarantees that a
+    // consumer which reenters itself eventually returns to the run loop.
+    size_t drain()
+    {
+        Node* head;
+        do {
+            head = m_incoming.load(std::memory_order_relaxed);
+            if (!head)
+                break;
+        } while (!m_incoming.compareExchangeWeak(head, nullptr, std::memory_order_acquire));
+
+        // The incoming chain is in reverse production order; reverse it and put it behind
+        // any items left over from the previous batch.
+        Node* reversed = nullptr;
+        Node* reversedTail = head;
+        while (head) {
+            Node* next = head->next;
+            head->next = reversed;
+            reversed = head;
+            head = next;
+        }
+
+        if (reversed) {
+            if (m_batchTail)
+                m_batchTail->next = reversed;
+            else
+                m_batch = reversed;
+            m_batchTail = reversedTail;
+        }
+
+        size_t count = 0;
+        for (Node* node = m_batch; node; node = node->next)
+            ++count;
+        return count;
+    }
+
+    bool tryTake(T& result)
+    {
+        if (!m_batch)
+            drain();
+
+        Node* node = m_batch;
+        if (!node)
+            return false;
+
+        m_batch = node->next;
+        if (!m_batch)
+            m_batchTail = nullptr;
+
+        result = WTFMove(node->data);
+        delete node;
+        return true;
+    }
+
+    bool isEmpty()
+    {
+        return !m_batch && !m_incoming.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Node {
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        explicit Node(T&& data)
+            : data(WTFMove(data))
+            , next(nullptr)
+        {
+        }
+
+        T data;
+        Node* next;
+    };
+
+    Atomic<Node*> m_incoming;
+    Node* m_batch { nullptr };
+    Node* m_batchTail { nullptr };
+};
+
+} // namespace WTF
+
+using WTF::MPSCQueue;
+
+#endif // WTF_MPSCQueue_h
@@ -30,11 +30,11 @@
 #include "MainThread.h"
 
 #include "CurrentTime.h"
-#include "Deque.h"
 #include "StdLibExtras.h"
 #include "Threading.h"
 #include <mutex>
 #include <wtf/Lock.h>
+#include <wtf/MPSCQueue.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/ThreadSpecific.h>
 
@@ -45,11 +45,9 @@ static bool callbacksPaused; // This global variable is only accessed from main
 static ThreadIdentifier mainThreadIdentifier;
 #endif
 
-static StaticLock mainThreadFunctionQueueMutex;
-
-static Deque<std::function<void ()>>& functionQueue()
+static MPSCQueue<std::function<void ()>>& functionQueue()
 {
-    static NeverDestroyed<Deque<std::function<void ()>>> functionQueue;
+    static NeverDestroyed<MPSCQueue<std::function<void ()>>> functionQueue;
     return functionQueue;
 }
 
@@ -122,15 +120,7 @@ void dispatchFunctionsFromMainThread()
 
     std::function<void ()> function;
 
-    while (true) {
-        {
-            std::lock_guard<StaticLock> lock(mainThreadFunctionQueueMutex);
-            if (!functionQueue().size())
-                break;
-
-            function = functionQueue().takeFirst();
-        }
-
+    while (functionQueue().tryTake(function)) {
         function();
 
         // If we are running accumulated functions for too long so UI may become unresponsive, we need to
@@ -148,15 +138,10 @@ void callOnMainThread(std::function<void ()> function)
 {
     ASSERT(function);
 
-    bool needToSchedule = false;
-
-    {
-        std::lock_guard<StaticLock> lock(mainThreadFunctionQueueMutex);
-        needToSchedule = functionQueue().size() == 0;
-        functionQueue().append(WTFMove(function));
-    }
-
-    if (needToSchedule)
+    // Posting is a single compare-and-swap. The producer that finds the queue empty is the
+    // one responsible for scheduling the dispatch; later producers chaining onto a pending
+    // item are picked up by the drain that collects their predecessor.
+    if (functionQueue().append(WTFMove(function)))
         scheduleDispatchFunctionsOnMainThread();
 }
 
@@ -204,6 +204,23 @@ MetaAllocator::Statistics MetaAllocator::currentStatistics()
     return result;
 }
 
+MetaAllocator::FreeSpaceStatistics MetaAllocator::currentFreeSpaceStatistics()
+{
+    LockHolder locker(&m_lock);
+    FreeSpaceStatistics result;
+    result.freeBlockCount = 0;
+    result.largestFreeBlock = 0;
+    result.totalFreeBytes = 0;
+    for (FreeSpaceNode* node = m_freeSpaceSizeMap.first(); node; node = node->successor()) {
+        result.freeBlockCount++;
+        result.totalFreeBytes += node->m_sizeInBytes;
+    }
+    // The tree is keyed on size, so the largest free block is the last node.
+    if (FreeSpaceNode* largest = m_freeSpaceSizeMap.last())
+        result.largestFreeBlock = largest->m_sizeInBytes;
+    return result;
+}
+
 void* MetaAllocator::findAndRemoveFreeSpace(size_t sizeInBytes)
 {
     FreeSpaceNode* node = m_freeSpaceSizeMap.findLeastGreaterThanOrEqual(sizeInBytes);
@@ -88,6 +88,16 @@ public:
     };
     WTF_EXPORT_PRIVATE Statistics currentStatistics();
 
+    // A snapshot of the free list, for diagnosing fragmentation. Unlike
+    // currentStatistics() this walks all free space nodes, so it should only
+    // be called from diagnostic code, not on allocation paths.
+    struct FreeSpaceStatistics {
+        size_t freeBlockCount;
+        size_t largestFreeBlock;
+        size_t totalFreeBytes;
+    };
+    WTF_EXPORT_PRIVATE FreeSpaceStatistics currentFreeSpaceStatistics();
+
     // Add more free space to the allocator. Call this directly from
     // the constructor if you wish to operate the allocator within a
     // fixed pool.
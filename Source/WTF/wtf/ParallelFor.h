@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ParallelFor_h
+#define ParallelFor_h
+
+#include <algorithm>
+#include <atomic>
+#include <wtf/ParallelHelperPool.h>
+
+namespace WTF {
+
+// The shared pool that parallelFor() runs on. It's sized to the number of processor cores and
+// its threads are started lazily, so merely linking against this costs nothing. Exposed so that
+// callers with their own load balancing can enqueue tasks alongside parallelFor() work.
+WTF_EXPORT_PRIVATE ParallelHelperPool& parallelForHelperPool();
+
+// Runs functor(i) for each i in [begin, end), possibly on many threads. Iterations are claimed
+// in chunks of grainSize with a single atomic increment, which serves the same role as work
+// stealing: a thread that finishes its chunk early just claims another one. Pick a grainSize
+// large enough that the per-chunk atomic doesn't dominate, but small enough that the last
+// chunks don't leave threads idle - for example, one image row or one basic block.
+//
+// The calling thread always participates, so it is safe (just not parallel) to call this before
+// threading is fully up, and iterations may run on the calling thread's stack. The functor must
+// be safe to invoke concurrently from multiple threads; iteration order is not specified. Don't
+// call this while holding locks that the functor also takes.
+template<typename Functor>
+void parallelFor(size_t begin, size_t end, size_t grainSize, const Functor& functor)
+{
+    if (begin >= end)
+        return;
+    if (!grainSize)
+        grainSize = 1;
+
+    // If there's at most one chunk of work, parallelism can't help; skip the task machinery.
+    if (end - begin <= grainSize) {
+        for (size_t i = begin; i < end; ++i)
+            functor(i);
+        return;
+    }
+
+    std::atomic<size_t> cursor(begin);
+
+    // A client may only be used from one thread, so each call gets its own. This is cheap
+    // relative to the cost of waking helper threads.
+    ParallelHelperClient client(&parallelForHelperPool());
+    client.runFunctionInParallel(
+        [&] () {
+            for (;;) {
+                size_t chunkBegin = cursor.fetch_add(grainSize, std::memory_order_relaxed);
+                if (chunkBegin >= end)
+                    return;
+                size_t chunkEnd = std::min(chunkBegin + grainSize, end);
+                for (size_t i = chunkBegin; i < chunkEnd; ++i)
+                    functor(i);
+            }
+        });
+}
+
+} // namespace WTF
+
+using WTF::parallelFor;
+using WTF::parallelForHelperPool;
+
+#endif // ParallelFor_h
@@ -26,8 +26,9 @@
 #ifndef ParallelVectorIterator_h
 #define ParallelVectorIterator_h
 
+#include <algorithm>
+#include <wtf/Atomics.h>
 #include <wtf/FastMalloc.h>
-#include <wtf/Lock.h>
 #include <wtf/Noncopyable.h>
 
 namespace WTF {
@@ -46,22 +47,14 @@ public:
     template<typename Functor>
     ALWAYS_INLINE void iterate(const Functor& functor)
     {
+        // Shards are claimed with a single atomic increment rather than a lock. With many
+        // helper threads pulling small shards, the lock used to be a point of serialization.
         for (;;) {
-            size_t begin;
-            size_t end;
-            {
-                LockHolder locker(m_lock);
-                begin = m_next;
-                if (begin == m_vector.size())
-                    return;
-                if (m_vector.size() - begin < m_shardSize)
-                    end = m_vector.size();
-                else
-                    end = begin + m_shardSize;
-                RELEASE_ASSERT(end <= m_vector.size());
-                RELEASE_ASSERT(begin < end);
-                m_next = end;
-            }
+            size_t begin = m_next.fetch_add(m_shardSize, std::memory_order_relaxed);
+            if (begin >= m_vector.size())
+                return;
+            size_t end = std::min(begin + m_shardSize, m_vector.size());
+            RELEASE_ASSERT(begin < end);
 
             for (size_t i = begin; i < end; ++i)
                 functor(m_vector[i]);
@@ -69,9 +62,8 @@ public:
     }
 private:
     VectorType& m_vector;
-    Lock m_lock;
     size_t m_shardSize;
-    size_t m_next { 0 };
+    std::atomic<size_t> m_next { 0 };
 };
 
 } // namespace WTF
@@ -89,46 +89,24 @@ void RunLoop::performWork()
     // By only handling up to the number of functions that were in the queue when performWork() is called
     // we guarantee to occasionally return from the run loop so other event sources will be allowed to spin.
 
-    size_t functionsToHandle = 0;
-    {
-        std::function<void()> function;
-        {
-            MutexLocker locker(m_functionQueueLock);
-            functionsToHandle = m_functionQueue.size();
+    size_t functionsToHandle = m_functionQueue.drain();
 
-            if (m_functionQueue.isEmpty())
-                return;
+    for (size_t functionsHandled = 0; functionsHandled < functionsToHandle; ++functionsHandled) {
+        std::function<void()> function;
 
-            function = m_functionQueue.takeFirst();
-        }
+        // Even if we start off with N functions to handle and we've only handled less than N functions, the queue
+        // still might be empty because those functions might have been handled in an inner RunLoop::performWork().
+        // In that case we should bail here.
+        if (!m_functionQueue.tryTake(function))
+            break;
 
         function();
     }
-
-    for (size_t functionsHandled = 1; functionsHandled < functionsToHandle; ++functionsHandled) {
-        std::function<void()> function;
-        {
-            MutexLocker locker(m_functionQueueLock);
-
-            // Even if we start off with N functions to handle and we've only handled less than N functions, the queue
-            // still might be empty because those functions might have been handled in an inner RunLoop::performWork().
-            // In that case we should bail here.
-            if (m_functionQueue.isEmpty())
-                break;
-
-            function = m_functionQueue.takeFirst();
-        }
-        
-        function();
-    }
 }
 
 void RunLoop::dispatch(std::function<void ()> function)
 {
-    {
-        MutexLocker locker(m_functionQueueLock);
-        m_functionQueue.append(WTFMove(function));
-    }
+    m_functionQueue.append(WTFMove(function));
 
     wakeUp();
 }
@@ -28,10 +28,10 @@
 #ifndef RunLoop_h
 #define RunLoop_h
 
-#include <wtf/Deque.h>
 #include <wtf/Forward.h>
 #include <wtf/FunctionDispatcher.h>
 #include <wtf/HashMap.h>
+#include <wtf/MPSCQueue.h>
 #include <wtf/RetainPtr.h>
 #include <wtf/Threading.h>
 
@@ -70,6 +70,10 @@ public:
 
 #if USE(GLIB) && !PLATFORM(EFL) && !PLATFORM(QT)
     WTF_EXPORT_PRIVATE GMainContext* mainContext() const { return m_mainContext.get(); }
+
+    // Returns the rate of timer dispatches since the previous call and resets the window;
+    // meant for idle-power instrumentation.
+    WTF_EXPORT_PRIVATE double timerWakeUpsPerSecond();
 #endif
 
     class TimerBase {
@@ -89,6 +93,10 @@ public:
 
 #if USE(GLIB) && !PLATFORM(EFL) && !PLATFORM(QT)
         void setPriority(int);
+        // Allows the fire time to be deferred by up to the given tolerance. Deadlines are
+        // rounded up to a grid of that coarseness, so timers sharing a tolerance get
+        // dispatched on the same poll wakeup instead of each arming its own.
+        WTF_EXPORT_PRIVATE void setFireTimeTolerance(std::chrono::microseconds);
 #endif
 
     private:
@@ -116,6 +124,7 @@ public:
         GRefPtr<GSource> m_source;
         bool m_isRepeating { false };
         std::chrono::microseconds m_fireInterval { 0 };
+        std::chrono::microseconds m_fireTimeTolerance { 0 };
 #endif
     };
 
@@ -145,8 +154,7 @@ private:
 
     void performWork();
 
-    Mutex m_functionQueueLock;
-    Deque<std::function<void ()>> m_functionQueue;
+    MPSCQueue<std::function<void ()>> m_functionQueue;
 
 #if PLATFORM(WIN)
     static bool registerRunLoopMessageWindowClass();
@@ -178,6 +186,8 @@ private:
     GRefPtr<GMainContext> m_mainContext;
     Vector<GRefPtr<GMainLoop>> m_mainLoops;
     GRefPtr<GSource> m_source;
+    int64_t m_timerWakeUpsWindowStart { 0 };
+    unsigned m_timerWakeUpCount { 0 };
 #endif
 };
 
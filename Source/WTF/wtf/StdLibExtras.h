@@ -161,6 +161,26 @@ inline size_t bitCount(uint64_t bits)
     return bitCount(static_cast<unsigned>(bits)) + bitCount(static_cast<unsigned>(bits >> 32));
 }
 
+// Returns the number of consecutive zero bits in 'bits', starting from the least
+// significant bit. Returns 32 when 'bits' is zero.
+inline unsigned countTrailingZeros32(uint32_t bits)
+{
+#if COMPILER(GCC_OR_CLANG)
+    if (!bits)
+        return 32;
+    return __builtin_ctz(bits);
+#else
+    unsigned zeroCount = 0;
+    for (unsigned i = 0; i < 32; i++) {
+        if (bits & 1)
+            break;
+        zeroCount++;
+        bits >>= 1;
+    }
+    return zeroCount;
+#endif
+}
+
 // Macro that returns a compile time constant with the length of an array, but gives an error if passed a non-array.
 template<typename T, size_t Size> char (&ArrayLengthHelperFunction(T (&)[Size]))[Size];
 // GCC needs some help to deduce a 0 length array.
@@ -397,6 +417,7 @@ using WTF::binarySearch;
 using WTF::tryBinarySearch;
 using WTF::approximateBinarySearch;
 using WTF::bitwise_cast;
+using WTF::countTrailingZeros32;
 using WTF::safeCast;
 
 #if COMPILER_SUPPORTS(CXX_USER_LITERALS)
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "SystemTracing.h"
+
+#include <mutex>
+#include <stdio.h>
+#include <wtf/CurrentTime.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/ThreadSpecific.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+
+// Read without synchronization on the record path; a thread racing with
+// setTraceRecordingEnabled() just records or skips a few boundary events.
+static bool s_traceRecordingEnabled;
+
+static StaticLock s_traceBufferRegistryLock;
+
+struct TraceRecordingEvent {
+    uint64_t timestampNanoseconds;
+    uint32_t code;
+    uint32_t reserved;
+};
+
+class ThreadTraceBuffer {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    // 512kB per thread that hits a trace point while recording is enabled.
+    static const size_t capacity = 32768;
+
+    ThreadTraceBuffer();
+    ~ThreadTraceBuffer();
+
+    // Only the owning thread records, so no synchronization is needed here. The
+    // dump path reads m_cursor and the events racily, by design.
+    void record(TracePointCode code)
+    {
+        TraceRecordingEvent& event = m_events[m_cursor++ % capacity];
+        event.timestampNanoseconds = static_cast<uint64_t>(monotonicallyIncreasingTime() * 1e9);
+        event.code = code;
+        event.reserved = 0;
+    }
+
+    void dump(FILE*) const;
+
+private:
+    uint32_t m_threadID;
+    size_t m_cursor { 0 };
+    Vector<TraceRecordingEvent> m_events;
+};
+
+static Vector<ThreadTraceBuffer*>& traceBufferRegistry()
+{
+    static NeverDestroyed<Vector<ThreadTraceBuffer*>> registry;
+    return registry;
+}
+
+ThreadTraceBuffer::ThreadTraceBuffer()
+    : m_threadID(currentThread())
+    , m_events(capacity)
+{
+    std::lock_guard<StaticLock> locker(s_traceBufferRegistryLock);
+    traceBufferRegistry().append(this);
+}
+
+ThreadTraceBuffer::~ThreadTraceBuffer()
+{
+    std::lock_guard<StaticLock> locker(s_traceBufferRegistryLock);
+    traceBufferRegistry().removeFirst(this);
+}
+
+void ThreadTraceBuffer::dump(FILE* file) const
+{
+    uint32_t threadID = m_threadID;
+    uint64_t eventCount = std::min(m_cursor, static_cast<size_t>(capacity));
+    fwrite(&threadID, sizeof(threadID), 1, file);
+    fwrite(&eventCount, sizeof(eventCount), 1, file);
+
+    // Once the ring has wrapped, the oldest event is the one the cursor points at.
+    size_t oldest = m_cursor >= capacity ? m_cursor % capacity : 0;
+    for (size_t i = 0; i < eventCount; ++i)
+        fwrite(&m_events[(oldest + i) % capacity], sizeof(TraceRecordingEvent), 1, file);
+}
+
+static ThreadTraceBuffer& threadTraceBuffer()
+{
+    static ThreadSpecific<ThreadTraceBuffer>* buffer;
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        buffer = new ThreadSpecific<ThreadTraceBuffer>;
+    });
+    return **buffer;
+}
+
+void setTraceRecordingEnabled(bool enabled)
+{
+    s_traceRecordingEnabled = enabled;
+}
+
+void recordTracePoint(TracePointCode code)
+{
+    if (LIKELY(!s_traceRecordingEnabled))
+        return;
+    threadTraceBuffer().record(code);
+}
+
+bool dumpTraceRecording(const char* path)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return false;
+
+    static const char magic[4] = { 'W', 'K', 'T', 'R' };
+    uint32_t version = 1;
+    fwrite(magic, sizeof(magic), 1, file);
+    fwrite(&version, sizeof(version), 1, file);
+
+    {
+        std::lock_guard<StaticLock> locker(s_traceBufferRegistryLock);
+        for (ThreadTraceBuffer* buffer : traceBufferRegistry())
+            buffer->dump(file);
+    }
+
+    bool success = !ferror(file);
+    fclose(file);
+    return success;
+}
+
+} // namespace WTF
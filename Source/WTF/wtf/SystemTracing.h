@@ -42,6 +42,10 @@ enum TracePointCode {
     WTFRange = 0,
 
     JavaScriptRange = 2500,
+    GCEdenCollectionStart,
+    GCEdenCollectionEnd,
+    GCFullCollectionStart,
+    GCFullCollectionEnd,
 
     WebCoreRange = 5000,
     StyleRecalcStart,
@@ -55,38 +59,51 @@ enum TracePointCode {
 
     WebKitRange = 10000,
     WebKit2Range = 12000,
+    IPCMessageDispatchStart,
+    IPCMessageDispatchEnd,
 };
 
 #ifdef __cplusplus
 
+#include <wtf/ExportMacros.h>
+
 namespace WTF {
 
+// In-process recording of the trace points above, for platforms without kdebug and
+// for pulling traces out of live processes. When recording is enabled, every trace
+// point is stamped with a monotonic nanosecond timestamp into a fixed-size
+// per-thread ring buffer; when disabled, hitting a trace point costs one branch.
+WTF_EXPORT_PRIVATE void setTraceRecordingEnabled(bool);
+WTF_EXPORT_PRIVATE void recordTracePoint(TracePointCode);
+
+// Writes every thread's ring buffer to the given file in a compact binary format:
+// a "WKTR" magic and format version, then per-thread blocks of thread identifier,
+// event count, and {nanosecond timestamp, code} event records, oldest event first.
+// Safe to call from a live process; events recorded concurrently with the dump can
+// be missed or torn, which is acceptable for diagnostics.
+WTF_EXPORT_PRIVATE bool dumpTraceRecording(const char* path);
+
 class TraceScope {
 public:
-
-#if HAVE(KDEBUG_H)
     TraceScope(TracePointCode entryCode, TracePointCode exitCode)
         : m_exitCode(exitCode)
     {
+#if HAVE(KDEBUG_H)
         kdebug_trace(ARIADNEDBG_CODE(WEBKIT_COMPONENT, entryCode), 0, 0, 0, 0);
-    }
-#else
-    TraceScope(TracePointCode, TracePointCode)
-    {
-    }
 #endif
-    
+        recordTracePoint(entryCode);
+    }
+
     ~TraceScope()
     {
 #if HAVE(KDEBUG_H)
         kdebug_trace(ARIADNEDBG_CODE(WEBKIT_COMPONENT, m_exitCode), 0, 0, 0, 0);
 #endif
+        recordTracePoint(m_exitCode);
     }
 
 private:
-#if HAVE(KDEBUG_H)
     TracePointCode m_exitCode;
-#endif
 };
 
 } // namespace WTF
@@ -26,6 +26,7 @@
 #ifndef TinyPtrSet_h
 #define TinyPtrSet_h
 
+#include <atomic>
 #include <wtf/Assertions.h>
 #include <wtf/FastMalloc.h>
 
@@ -40,6 +41,12 @@ namespace WTF {
 // non-trivial default constructors, and non-trivial destructors. It may be possible to lift all
 // of these restrictions. If we succeeded then this should be renamed to just TinySet.
 // https://bugs.webkit.org/show_bug.cgi?id=145741
+//
+// The out-of-line storage is copy-on-write: copying a set that has spilled out of line just
+// shares the refcounted list, and the list is only cloned when one of the sharers mutates it.
+// This matters a lot for the DFG's abstract interpreter, which copies AbstractValues (and the
+// StructureSets inside them) far more often than it mutates them. The refcount is maintained
+// atomically because a set copied on one thread may be handed to a concurrent compiler thread.
 
 template<typename T>
 class TinyPtrSet {
@@ -137,9 +144,10 @@ public:
         for (unsigned i = 0; i < list->m_length; ++i) {
             if (list->list()[i] != value)
                 continue;
+            list = unshareIfNecessary();
             list->list()[i] = list->list()[--list->m_length];
             if (!list->m_length) {
-                OutOfLineList::destroy(list);
+                list->deref();
                 setEmpty();
             }
             return true;
@@ -214,6 +222,7 @@ public:
         for (unsigned i = 0; i < list->m_length; ++i) {
             if (functor(list->list()[i]))
                 continue;
+            list = unshareIfNecessary();
             list->list()[i--] = list->list()[--list->m_length];
         }
         if (!list->m_length)
@@ -384,21 +393,37 @@ private:
             if (list->list()[i] == value)
                 return false;
         }
-        
-        if (list->m_length < list->m_capacity) {
+
+        if (list->m_length < list->m_capacity && !list->isShared()) {
             list->list()[list->m_length++] = value;
             return true;
         }
-        
-        OutOfLineList* newList = OutOfLineList::create(list->m_capacity * 2);
+
+        OutOfLineList* newList = OutOfLineList::create(
+            list->m_length < list->m_capacity ? list->m_capacity : list->m_capacity * 2);
         newList->m_length = list->m_length + 1;
         for (unsigned i = list->m_length; i--;)
             newList->list()[i] = list->list()[i];
         newList->list()[list->m_length] = value;
-        OutOfLineList::destroy(list);
+        list->deref();
         set(newList);
         return true;
     }
+
+    OutOfLineList* unshareIfNecessary()
+    {
+        OutOfLineList* list = this->list();
+        if (!list->isShared())
+            return list;
+
+        OutOfLineList* newList = OutOfLineList::create(list->m_capacity);
+        newList->m_length = list->m_length;
+        for (unsigned i = list->m_length; i--;)
+            newList->list()[i] = list->list()[i];
+        list->deref();
+        set(newList);
+        return newList;
+    }
     
     bool containsOutOfLine(T value) const
     {
@@ -425,11 +450,8 @@ private:
     {
         ASSERT(!other.isThin() && other.m_pointer != reservedValue);
         OutOfLineList* otherList = other.list();
-        OutOfLineList* myList = OutOfLineList::create(otherList->m_length);
-        myList->m_length = otherList->m_length;
-        for (unsigned i = otherList->m_length; i--;)
-            myList->list()[i] = otherList->list()[i];
-        set(myList);
+        otherList->ref();
+        set(otherList);
     }
     
     class OutOfLineList {
@@ -438,28 +460,45 @@ private:
         {
             return new (NotNull, fastMalloc(sizeof(OutOfLineList) + capacity * sizeof(T))) OutOfLineList(0, capacity);
         }
-        
-        static void destroy(OutOfLineList* list)
+
+        void ref()
         {
-            fastFree(list);
+            m_refCount.fetch_add(1, std::memory_order_relaxed);
         }
-        
+
+        void deref()
+        {
+            if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                fastFree(this);
+        }
+
+        // A shared list must not be mutated in place; see unshareIfNecessary().
+        // A relaxed load suffices: if the count is 1, only this set references
+        // the list, and nobody can gain a reference behind our back since new
+        // references are only created by copying a set that already holds one.
+        bool isShared() const
+        {
+            return m_refCount.load(std::memory_order_relaxed) > 1;
+        }
+
         T* list() { return bitwise_cast<T*>(this + 1); }
-        
+
         OutOfLineList(unsigned length, unsigned capacity)
             : m_length(length)
             , m_capacity(capacity)
+            , m_refCount(1)
         {
         }
 
         unsigned m_length;
         unsigned m_capacity;
+        std::atomic<unsigned> m_refCount;
     };
-    
+
     ALWAYS_INLINE void deleteListIfNecessary()
     {
         if (!isThin() && m_pointer != reservedValue)
-            OutOfLineList::destroy(list());
+            list()->deref();
     }
     
     bool isThin() const { return m_pointer & thinFlag; }
@@ -732,6 +732,7 @@ public:
 
     template<typename U> void append(const U*, size_t);
     template<typename U, size_t otherCapacity> void appendVector(const Vector<U, otherCapacity>&);
+    template<typename U, size_t otherCapacity> void appendVector(Vector<U, otherCapacity>&&);
     template<typename U> bool tryAppend(const U*, size_t);
 
     template<typename U> void insert(size_t position, const U*, size_t);
@@ -1277,6 +1278,27 @@ inline void Vector<T, inlineCapacity, OverflowHandler, minCapacity>::appendVecto
     append(val.begin(), val.size());
 }
 
+template<typename T, size_t inlineCapacity, typename OverflowHandler, size_t minCapacity> template<typename U, size_t otherCapacity>
+inline void Vector<T, inlineCapacity, OverflowHandler, minCapacity>::appendVector(Vector<U, otherCapacity>&& val)
+{
+    // Bulk-moves the elements out of val instead of copy-constructing them, so move-only
+    // and refcounted payloads don't pay per-element copies. val is left empty.
+    ASSERT(static_cast<const void*>(&val) != static_cast<const void*>(this));
+    size_t newSize = m_size + val.size();
+    if (newSize > capacity())
+        expandCapacity(newSize);
+    ASSERT(!val.size() || begin());
+    asanBufferSizeWillChangeTo(newSize);
+    T* dest = end();
+    for (auto& item : val) {
+        new (NotNull, dest) T(WTFMove(item));
+        ++dest;
+    }
+    m_size = newSize;
+    val.clear();
+}
+
+
 template<typename T, size_t inlineCapacity, typename OverflowHandler, size_t minCapacity> template<typename U>
 void Vector<T, inlineCapacity, OverflowHandler, minCapacity>::insert(size_t position, const U* data, size_t dataSize)
 {
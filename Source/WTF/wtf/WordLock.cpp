@@ -99,9 +99,13 @@ NEVER_INLINE void WordLockBase::lockSlow()
         }
 
         // If there is no queue and we haven't spun too much, we can just try to spin around again.
+        // As in Lock::lockSlow(), pause in place for the first spins and only then yield.
         if (!(currentWordValue & ~queueHeadMask) && spinCount < spinLimit) {
             spinCount++;
-            std::this_thread::yield();
+            if (spinCount <= 16)
+                spinLoopHint();
+            else
+                std::this_thread::yield();
             continue;
         }
 
@@ -46,6 +46,7 @@
 #include <DispatchQueueEfl.h>
 #elif PLATFORM(QT)
 #include <QSocketNotifier>
+#include <mutex>
 #elif OS(WINDOWS)
 #include <wtf/HashMap.h>
 #include <wtf/Vector.h>
@@ -117,7 +118,9 @@ private:
     RefPtr<DispatchQueue> m_dispatchQueue;
 #elif PLATFORM(QT)
     class WorkItemQt;
+    void ensureWorkThreadIsStarted();
     QThread* m_workThread;
+    std::once_flag m_workThreadStartFlag;
     friend class WorkItemQt;
 #elif OS(DARWIN)
     static void executeFunction(void*);
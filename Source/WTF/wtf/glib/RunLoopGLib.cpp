@@ -67,6 +67,8 @@ RunLoop::RunLoop()
         return G_SOURCE_CONTINUE;
     }, this, nullptr);
     g_source_attach(m_source.get(), m_mainContext.get());
+
+    m_timerWakeUpsWindowStart = g_get_monotonic_time();
 }
 
 RunLoop::~RunLoop()
@@ -121,6 +123,16 @@ void RunLoop::wakeUp()
     g_source_set_ready_time(m_source.get(), g_get_monotonic_time());
 }
 
+double RunLoop::timerWakeUpsPerSecond()
+{
+    gint64 now = g_get_monotonic_time();
+    double elapsedSeconds = (now - m_timerWakeUpsWindowStart) / static_cast<double>(G_USEC_PER_SEC);
+    double wakeUpsPerSecond = elapsedSeconds > 0 ? m_timerWakeUpCount / elapsedSeconds : 0;
+    m_timerWakeUpsWindowStart = now;
+    m_timerWakeUpCount = 0;
+    return wakeUpsPerSecond;
+}
+
 RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
     : m_runLoop(runLoop)
     , m_source(adoptGRef(g_source_new(&runLoopSourceFunctions, sizeof(GSource))))
@@ -128,6 +140,7 @@ RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
     g_source_set_name(m_source.get(), "[WebKit] RunLoop::Timer work");
     g_source_set_callback(m_source.get(), [](gpointer userData) -> gboolean {
         RunLoop::TimerBase* timer = static_cast<RunLoop::TimerBase*>(userData);
+        timer->m_runLoop.m_timerWakeUpCount++;
         timer->fired();
         if (timer->m_isRepeating)
             timer->updateReadyTime();
@@ -146,6 +159,11 @@ void RunLoop::TimerBase::setPriority(int priority)
     g_source_set_priority(m_source.get(), priority);
 }
 
+void RunLoop::TimerBase::setFireTimeTolerance(std::chrono::microseconds tolerance)
+{
+    m_fireTimeTolerance = tolerance;
+}
+
 void RunLoop::TimerBase::updateReadyTime()
 {
     if (!m_fireInterval.count()) {
@@ -156,6 +174,14 @@ void RunLoop::TimerBase::updateReadyTime()
     gint64 currentTime = g_get_monotonic_time();
     gint64 targetTime = currentTime + std::min<gint64>(G_MAXINT64 - currentTime, m_fireInterval.count());
     ASSERT(targetTime >= currentTime);
+
+    // Rounding the deadline up to the tolerance grid makes timers that allow the same slack
+    // become ready on the same iteration of the poll loop, so the process wakes once for all
+    // of them. The deadline is never moved earlier than requested.
+    gint64 tolerance = m_fireTimeTolerance.count();
+    if (tolerance > 0 && targetTime < G_MAXINT64 - tolerance)
+        targetTime = ((targetTime + tolerance - 1) / tolerance) * tolerance;
+
     g_source_set_ready_time(m_source.get(), targetTime);
 }
 
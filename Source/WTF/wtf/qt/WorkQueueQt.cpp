@@ -80,9 +80,17 @@ public:
     std::function<void()> m_function;
 };
 
+void WorkQueue::ensureWorkThreadIsStarted()
+{
+    std::call_once(m_workThreadStartFlag, [this] {
+        m_workThread->start();
+    });
+}
+
 QSocketNotifier* WorkQueue::registerSocketEventHandler(int socketDescriptor, QSocketNotifier::Type type, std::function<void()> function)
 {
     ASSERT(m_workThread);
+    ensureWorkThreadIsStarted();
 
     QSocketNotifier* notifier = new QSocketNotifier(socketDescriptor, type, 0);
     notifier->setEnabled(false);
@@ -95,8 +103,11 @@ QSocketNotifier* WorkQueue::registerSocketEventHandler(int socketDescriptor, QSo
 
 void WorkQueue::platformInitialize(const char*, Type, QOS)
 {
+    // Don't start the OS thread yet: WebCore creates a good number of queues
+    // (IndexedDB, async file streams, cache IO) that never see a single dispatch
+    // in a typical process, and each started thread costs a stack and a kernel
+    // object. The thread comes up on first use instead.
     m_workThread = new QThread();
-    m_workThread->start();
 }
 
 void WorkQueue::platformInvalidate()
@@ -108,6 +119,7 @@ void WorkQueue::platformInvalidate()
 
 void WorkQueue::dispatch(std::function<void()> function)
 {
+    ensureWorkThreadIsStarted();
     ref();
     WorkQueue::WorkItemQt* itemQt = new WorkQueue::WorkItemQt(this, function);
     itemQt->moveToThread(m_workThread);
@@ -116,6 +128,7 @@ void WorkQueue::dispatch(std::function<void()> function)
 
 void WorkQueue::dispatchAfter(std::chrono::nanoseconds duration, std::function<void()> function)
 {
+    ensureWorkThreadIsStarted();
     ref();
     WorkQueue::WorkItemQt* itemQt = new WorkQueue::WorkItemQt(this, function);
     itemQt->startTimer(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
@@ -29,6 +29,13 @@
 
 namespace WTF {
 
+AtomicStringTable::AtomicStringTable()
+{
+    // Every thread that touches strings atomizes hundreds of them in its first moments
+    // (tag names, attribute names, identifiers), so skip the early rehash churn.
+    m_table.reserveInitialCapacity(512);
+}
+
 void AtomicStringTable::create(WTFThreadData& data)
 {
 #if USE(WEB_THREAD)
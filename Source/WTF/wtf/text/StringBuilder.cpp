@@ -252,11 +252,25 @@ void StringBuilder::append(const UChar* characters, unsigned length)
             return;
         }
 
+        // A 16 bit character sequence is very often all Latin1 in practice, for example
+        // when it was read out of a 16 bit string holding ASCII. Appending it narrowed
+        // keeps the builder 8 bit, which is much cheaper than permanently upconverting
+        // the whole buffer; once a genuinely 16 bit append happens we stop scanning.
+        UChar ored = 0;
+        for (unsigned i = 0; i < length; ++i)
+            ored |= characters[i];
+        if (!(ored & ~0xff)) {
+            LChar* dest = appendUninitialized<LChar>(length);
+            for (unsigned i = 0; i < length; ++i)
+                dest[i] = static_cast<LChar>(characters[i]);
+            return;
+        }
+
         // Calculate the new size of the builder after appending.
         unsigned requiredLength = length + m_length;
         if (requiredLength < length)
             CRASH();
-        
+
         if (m_buffer) {
             // If the buffer is valid it must be at least as long as the current builder contents!
             ASSERT(m_buffer->length() >= m_length);
@@ -29,6 +29,10 @@
 #include <unicode/uchar.h>
 #include <wtf/ASCIICType.h>
 
+#if CPU(X86_64) && !ASAN_ENABLED
+#include <emmintrin.h>
+#endif
+
 namespace WTF {
 
 template<typename CharacterTypeA, typename CharacterTypeB> bool equalIgnoringASCIICase(const CharacterTypeA*, const CharacterTypeB*, unsigned length);
@@ -58,11 +62,33 @@ inline T loadUnaligned(const char* s)
 #if (CPU(X86_64) || CPU(ARM64)) && !ASAN_ENABLED
 ALWAYS_INLINE bool equal(const LChar* aLChar, const LChar* bLChar, unsigned length)
 {
-    unsigned dwordLength = length >> 3;
-
     const char* a = reinterpret_cast<const char*>(aLChar);
     const char* b = reinterpret_cast<const char*>(bLChar);
 
+#if CPU(X86_64)
+    // SSE2 is baseline on x86_64, so compare 16 bytes per iteration; identifier-sized
+    // strings typically finish in one or two vector compares.
+    unsigned vectorLength = length >> 4;
+    for (unsigned i = 0; i != vectorLength; ++i) {
+        __m128i aChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        __m128i bChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(aChunk, bChunk)) != 0xffff)
+            return false;
+
+        a += 16;
+        b += 16;
+    }
+
+    if (length & 8) {
+        if (loadUnaligned<uint64_t>(a) != loadUnaligned<uint64_t>(b))
+            return false;
+
+        a += sizeof(uint64_t);
+        b += sizeof(uint64_t);
+    }
+#else
+    unsigned dwordLength = length >> 3;
+
     if (dwordLength) {
         for (unsigned i = 0; i != dwordLength; ++i) {
             if (loadUnaligned<uint64_t>(a) != loadUnaligned<uint64_t>(b))
@@ -72,6 +98,7 @@ ALWAYS_INLINE bool equal(const LChar* aLChar, const LChar* bLChar, unsigned leng
             b += sizeof(uint64_t);
         }
     }
+#endif
 
     if (length & 4) {
         if (loadUnaligned<uint32_t>(a) != loadUnaligned<uint32_t>(b))
@@ -97,11 +124,32 @@ ALWAYS_INLINE bool equal(const LChar* aLChar, const LChar* bLChar, unsigned leng
 
 ALWAYS_INLINE bool equal(const UChar* aUChar, const UChar* bUChar, unsigned length)
 {
-    unsigned dwordLength = length >> 2;
-
     const char* a = reinterpret_cast<const char*>(aUChar);
     const char* b = reinterpret_cast<const char*>(bUChar);
 
+#if CPU(X86_64)
+    // Sixteen bytes is eight UChars.
+    unsigned vectorLength = length >> 3;
+    for (unsigned i = 0; i != vectorLength; ++i) {
+        __m128i aChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        __m128i bChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(aChunk, bChunk)) != 0xffff)
+            return false;
+
+        a += 16;
+        b += 16;
+    }
+
+    if (length & 4) {
+        if (loadUnaligned<uint64_t>(a) != loadUnaligned<uint64_t>(b))
+            return false;
+
+        a += sizeof(uint64_t);
+        b += sizeof(uint64_t);
+    }
+#else
+    unsigned dwordLength = length >> 2;
+
     if (dwordLength) {
         for (unsigned i = 0; i != dwordLength; ++i) {
             if (loadUnaligned<uint64_t>(a) != loadUnaligned<uint64_t>(b))
@@ -111,6 +159,7 @@ ALWAYS_INLINE bool equal(const UChar* aUChar, const UChar* bUChar, unsigned leng
             b += sizeof(uint64_t);
         }
     }
+#endif
 
     if (length & 2) {
         if (loadUnaligned<uint32_t>(a) != loadUnaligned<uint32_t>(b))
@@ -312,8 +312,13 @@ void IDBTransaction::operationTimerFired()
         return;
 
     if (!m_transactionOperationQueue.isEmpty()) {
-        auto operation = m_transactionOperationQueue.takeFirst();
-        operation->perform();
+        // Perform every queued operation, not just the first one. Requests issued in a burst
+        // would otherwise trickle out to the server one runloop turn at a time, each waiting
+        // for its predecessor's round-trip to complete.
+        while (!m_transactionOperationQueue.isEmpty()) {
+            auto operation = m_transactionOperationQueue.takeFirst();
+            operation->perform();
+        }
 
         return;
     }
@@ -152,8 +152,12 @@ SQLiteIDBBackingStore::SQLiteIDBBackingStore(const IDBDatabaseIdentifier& identi
 
 SQLiteIDBBackingStore::~SQLiteIDBBackingStore()
 {
-    if (m_sqliteDB)
+    if (m_sqliteDB) {
+        // Cached statements must be finalized before the database is closed.
+        for (auto& statement : m_cachedStatements)
+            statement = nullptr;
         m_sqliteDB->close();
+    }
 
     if (m_vm) {
         JSLockHolder locker(m_vm.get());
@@ -162,6 +166,25 @@ SQLiteIDBBackingStore::~SQLiteIDBBackingStore()
     }
 }
 
+SQLiteStatement* SQLiteIDBBackingStore::cachedStatement(SQL sql, const char* query)
+{
+    auto& statement = m_cachedStatements[static_cast<size_t>(sql)];
+
+    if (statement) {
+        if (statement->reset() == SQLITE_OK)
+            return statement.get();
+        statement = nullptr;
+    }
+
+    if (m_sqliteDB) {
+        statement = std::make_unique<SQLiteStatement>(*m_sqliteDB, query);
+        if (statement->prepare() != SQLITE_OK)
+            statement = nullptr;
+    }
+
+    return statement.get();
+}
+
 
 void SQLiteIDBBackingStore::initializeVM()
 {
@@ -942,16 +965,16 @@ IDBError SQLiteIDBBackingStore::uncheckedHasIndexRecord(const IDBIndexInfo& info
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Unable to serialize IDBKey to check for index record in database") };
     }
 
-    SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("SELECT rowid FROM IndexRecords WHERE indexID = ? AND objectStoreID = ? AND key = CAST(? AS TEXT);"));
-    if (sql.prepare() != SQLITE_OK
-        || sql.bindInt64(1, info.identifier()) != SQLITE_OK
-        || sql.bindInt64(2, info.objectStoreIdentifier()) != SQLITE_OK
-        || sql.bindBlob(3, indexKeyBuffer->data(), indexKeyBuffer->size()) != SQLITE_OK) {
+    auto* sql = cachedStatement(SQL::HasIndexRecord, "SELECT rowid FROM IndexRecords WHERE indexID = ? AND objectStoreID = ? AND key = CAST(? AS TEXT);");
+    if (!sql
+        || sql->bindInt64(1, info.identifier()) != SQLITE_OK
+        || sql->bindInt64(2, info.objectStoreIdentifier()) != SQLITE_OK
+        || sql->bindBlob(3, indexKeyBuffer->data(), indexKeyBuffer->size()) != SQLITE_OK) {
         LOG_ERROR("Error checking for index record in database");
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Error checking for index record in database") };
     }
 
-    int sqlResult = sql.step();
+    int sqlResult = sql->step();
     if (sqlResult == SQLITE_OK || sqlResult == SQLITE_DONE)
         return { };
 
@@ -1015,13 +1038,13 @@ IDBError SQLiteIDBBackingStore::uncheckedPutIndexRecord(int64_t objectStoreID, i
     }
 
     {
-        SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("INSERT INTO IndexRecords VALUES (?, ?, CAST(? AS TEXT), CAST(? AS TEXT));"));
-        if (sql.prepare() != SQLITE_OK
-            || sql.bindInt64(1, indexID) != SQLITE_OK
-            || sql.bindInt64(2, objectStoreID) != SQLITE_OK
-            || sql.bindBlob(3, indexKeyBuffer->data(), indexKeyBuffer->size()) != SQLITE_OK
-            || sql.bindBlob(4, valueBuffer->data(), valueBuffer->size()) != SQLITE_OK
-            || sql.step() != SQLITE_DONE) {
+        auto* sql = cachedStatement(SQL::AddIndexRecord, "INSERT INTO IndexRecords VALUES (?, ?, CAST(? AS TEXT), CAST(? AS TEXT));");
+        if (!sql
+            || sql->bindInt64(1, indexID) != SQLITE_OK
+            || sql->bindInt64(2, objectStoreID) != SQLITE_OK
+            || sql->bindBlob(3, indexKeyBuffer->data(), indexKeyBuffer->size()) != SQLITE_OK
+            || sql->bindBlob(4, valueBuffer->data(), valueBuffer->size()) != SQLITE_OK
+            || sql->step() != SQLITE_DONE) {
             LOG_ERROR("Could not put index record for index %" PRIi64 " in object store %" PRIi64 " in Records table (%i) - %s", indexID, objectStoreID, m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
             return { IDBDatabaseException::UnknownError, ASCIILiteral("Error putting index record into database") };
         }
@@ -1098,15 +1121,15 @@ IDBError SQLiteIDBBackingStore::keyExistsInObjectStore(const IDBResourceIdentifi
         LOG_ERROR("Unable to serialize IDBKey to check for existence in object store");
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Unable to serialize IDBKey to check for existence in object store") };
     }
-    SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("SELECT key FROM Records WHERE objectStoreID = ? AND key = CAST(? AS TEXT) LIMIT 1;"));
-    if (sql.prepare() != SQLITE_OK
-        || sql.bindInt64(1, objectStoreID) != SQLITE_OK
-        || sql.bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK) {
+    auto* sql = cachedStatement(SQL::KeyExistsInObjectStore, "SELECT key FROM Records WHERE objectStoreID = ? AND key = CAST(? AS TEXT) LIMIT 1;");
+    if (!sql
+        || sql->bindInt64(1, objectStoreID) != SQLITE_OK
+        || sql->bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK) {
         LOG_ERROR("Could not get record from object store %" PRIi64 " from Records table (%i) - %s", objectStoreID, m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Unable to check for existence of IDBKey in object store") };
     }
 
-    int sqlResult = sql.step();
+    int sqlResult = sql->step();
     if (sqlResult == SQLITE_OK || sqlResult == SQLITE_DONE)
         return { };
 
@@ -1138,12 +1161,12 @@ IDBError SQLiteIDBBackingStore::deleteRecord(SQLiteIDBTransaction& transaction,
 
     // Delete record from object store
     {
-        SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("DELETE FROM Records WHERE objectStoreID = ? AND key = CAST(? AS TEXT);"));
+        auto* sql = cachedStatement(SQL::DeleteObjectStoreRecord, "DELETE FROM Records WHERE objectStoreID = ? AND key = CAST(? AS TEXT);");
 
-        if (sql.prepare() != SQLITE_OK
-            || sql.bindInt64(1, objectStoreID) != SQLITE_OK
-            || sql.bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
-            || sql.step() != SQLITE_DONE) {
+        if (!sql
+            || sql->bindInt64(1, objectStoreID) != SQLITE_OK
+            || sql->bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
+            || sql->step() != SQLITE_DONE) {
             LOG_ERROR("Could not delete record from object store %" PRIi64 " (%i) - %s", objectStoreID, m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
             return { IDBDatabaseException::UnknownError, ASCIILiteral("Failed to delete record from object store") };
         }
@@ -1151,12 +1174,12 @@ IDBError SQLiteIDBBackingStore::deleteRecord(SQLiteIDBTransaction& transaction,
 
     // Delete record from indexes store
     {
-        SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("DELETE FROM IndexRecords WHERE objectStoreID = ? AND value = CAST(? AS TEXT);"));
+        auto* sql = cachedStatement(SQL::DeleteObjectStoreIndexRecord, "DELETE FROM IndexRecords WHERE objectStoreID = ? AND value = CAST(? AS TEXT);");
 
-        if (sql.prepare() != SQLITE_OK
-            || sql.bindInt64(1, objectStoreID) != SQLITE_OK
-            || sql.bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
-            || sql.step() != SQLITE_DONE) {
+        if (!sql
+            || sql->bindInt64(1, objectStoreID) != SQLITE_OK
+            || sql->bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
+            || sql->step() != SQLITE_DONE) {
             LOG_ERROR("Could not delete record from indexes for object store %" PRIi64 " (%i) - %s", objectStoreID, m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
             return { IDBDatabaseException::UnknownError, ASCIILiteral("Failed to delete index entries for object store record") };
         }
@@ -1268,12 +1291,12 @@ IDBError SQLiteIDBBackingStore::updateAllIndexesForAddRecord(const IDBObjectStor
     if (!error.isNull() && anyRecordsSucceeded) {
         RefPtr<SharedBuffer> keyBuffer = serializeIDBKeyData(key);
 
-        SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("DELETE FROM IndexRecords WHERE objectStoreID = ? AND value = CAST(? AS TEXT);"));
+        auto* sql = cachedStatement(SQL::DeleteObjectStoreIndexRecord, "DELETE FROM IndexRecords WHERE objectStoreID = ? AND value = CAST(? AS TEXT);");
 
-        if (sql.prepare() != SQLITE_OK
-            || sql.bindInt64(1, info.identifier()) != SQLITE_OK
-            || sql.bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
-            || sql.step() != SQLITE_DONE) {
+        if (!sql
+            || sql->bindInt64(1, info.identifier()) != SQLITE_OK
+            || sql->bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
+            || sql->step() != SQLITE_DONE) {
             LOG_ERROR("Adding one Index record failed, but failed to remove all others that previously succeeded");
             return { IDBDatabaseException::UnknownError, ASCIILiteral("Adding one Index record failed, but failed to remove all others that previously succeeded") };
         }
@@ -1306,12 +1329,12 @@ IDBError SQLiteIDBBackingStore::addRecord(const IDBResourceIdentifier& transacti
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Unable to serialize IDBKey to be stored in an object store") };
     }
     {
-        SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("INSERT INTO Records VALUES (?, CAST(? AS TEXT), ?);"));
-        if (sql.prepare() != SQLITE_OK
-            || sql.bindInt64(1, objectStoreInfo.identifier()) != SQLITE_OK
-            || sql.bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
-            || sql.bindBlob(3, value.data()->data(), value.data()->size()) != SQLITE_OK
-            || sql.step() != SQLITE_DONE) {
+        auto* sql = cachedStatement(SQL::AddObjectStoreRecord, "INSERT INTO Records VALUES (?, CAST(? AS TEXT), ?);");
+        if (!sql
+            || sql->bindInt64(1, objectStoreInfo.identifier()) != SQLITE_OK
+            || sql->bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
+            || sql->bindBlob(3, value.data()->data(), value.data()->size()) != SQLITE_OK
+            || sql->step() != SQLITE_DONE) {
             LOG_ERROR("Could not put record for object store %" PRIi64 " in Records table (%i) - %s", objectStoreInfo.identifier(), m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
             return { IDBDatabaseException::UnknownError, ASCIILiteral("Unable to store record in object store") };
         }
@@ -1320,11 +1343,11 @@ IDBError SQLiteIDBBackingStore::addRecord(const IDBResourceIdentifier& transacti
     auto error = updateAllIndexesForAddRecord(objectStoreInfo, keyData, value);
 
     if (!error.isNull()) {
-        SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("DELETE FROM Records WHERE objectStoreID = ? AND key = CAST(? AS TEXT);"));
-        if (sql.prepare() != SQLITE_OK
-            || sql.bindInt64(1, objectStoreInfo.identifier()) != SQLITE_OK
-            || sql.bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
-            || sql.step() != SQLITE_DONE) {
+        auto* sql = cachedStatement(SQL::DeleteObjectStoreRecord, "DELETE FROM Records WHERE objectStoreID = ? AND key = CAST(? AS TEXT);");
+        if (!sql
+            || sql->bindInt64(1, objectStoreInfo.identifier()) != SQLITE_OK
+            || sql->bindBlob(2, keyBuffer->data(), keyBuffer->size()) != SQLITE_OK
+            || sql->step() != SQLITE_DONE) {
             LOG_ERROR("Indexing new object store record failed, but unable to remove the object store record itself");
             return { IDBDatabaseException::UnknownError, ASCIILiteral("Indexing new object store record failed, but unable to remove the object store record itself") };
         }
@@ -1483,19 +1506,19 @@ IDBError SQLiteIDBBackingStore::getCount(const IDBResourceIdentifier& transactio
 
 IDBError SQLiteIDBBackingStore::uncheckedGetKeyGeneratorValue(int64_t objectStoreID, uint64_t& outValue)
 {
-    SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("SELECT currentKey FROM KeyGenerators WHERE objectStoreID = ?;"));
-    if (sql.prepare() != SQLITE_OK
-        || sql.bindInt64(1, objectStoreID) != SQLITE_OK) {
+    auto* sql = cachedStatement(SQL::GetKeyGeneratorValue, "SELECT currentKey FROM KeyGenerators WHERE objectStoreID = ?;");
+    if (!sql
+        || sql->bindInt64(1, objectStoreID) != SQLITE_OK) {
         LOG_ERROR("Could not retrieve currentKey from KeyGenerators table (%i) - %s", m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Error getting current key generator value from database") };
     }
-    int result = sql.step();
+    int result = sql->step();
     if (result != SQLITE_ROW) {
         LOG_ERROR("Could not retreive key generator value for object store, but it should be there.");
         return { IDBDatabaseException::UnknownError, ASCIILiteral("Error finding current key generator value in database") };
     }
 
-    int64_t value = sql.getColumnInt64(0);
+    int64_t value = sql->getColumnInt64(0);
     if (value < 0)
         return { IDBDatabaseException::ConstraintError, "Current key generator value from database is invalid" };
 
@@ -1505,11 +1528,11 @@ IDBError SQLiteIDBBackingStore::uncheckedGetKeyGeneratorValue(int64_t objectStor
 
 IDBError SQLiteIDBBackingStore::uncheckedSetKeyGeneratorValue(int64_t objectStoreID, uint64_t value)
 {
-    SQLiteStatement sql(*m_sqliteDB, ASCIILiteral("INSERT INTO KeyGenerators VALUES (?, ?);"));
-    if (sql.prepare() != SQLITE_OK
-        || sql.bindInt64(1, objectStoreID) != SQLITE_OK
-        || sql.bindInt64(2, value) != SQLITE_OK
-        || sql.step() != SQLITE_DONE) {
+    auto* sql = cachedStatement(SQL::SetKeyGeneratorValue, "INSERT INTO KeyGenerators VALUES (?, ?);");
+    if (!sql
+        || sql->bindInt64(1, objectStoreID) != SQLITE_OK
+        || sql->bindInt64(2, value) != SQLITE_OK
+        || sql->step() != SQLITE_DONE) {
         LOG_ERROR("Could not update key generator value (%i) - %s", m_sqliteDB->lastError(), m_sqliteDB->lastErrorMsg());
         return { IDBDatabaseException::ConstraintError, "Error storing new key generator value in database" };
     }
@@ -1678,6 +1701,8 @@ void SQLiteIDBBackingStore::deleteBackingStore()
     LOG(IndexedDB, "SQLiteIDBBackingStore::deleteBackingStore deleting file '%s' on disk", dbFilename.utf8().data());
 
     if (m_sqliteDB) {
+        for (auto& statement : m_cachedStatements)
+            statement = nullptr;
         m_sqliteDB->close();
         m_sqliteDB = nullptr;
     }
@@ -40,6 +40,7 @@ namespace WebCore {
 
 class IndexKey;
 class SQLiteDatabase;
+class SQLiteStatement;
 
 namespace IDBServer {
 
@@ -105,11 +106,28 @@ private:
     JSC::JSGlobalObject& globalObject();
     void initializeVM();
 
+    // The statements for record-level operations are prepared once and then reused;
+    // re-preparing them for every record dominates the cost of large write batches.
+    enum class SQL : size_t {
+        AddObjectStoreRecord,
+        DeleteObjectStoreRecord,
+        DeleteObjectStoreIndexRecord,
+        AddIndexRecord,
+        HasIndexRecord,
+        KeyExistsInObjectStore,
+        GetKeyGeneratorValue,
+        SetKeyGeneratorValue,
+        Count
+    };
+
+    SQLiteStatement* cachedStatement(SQL, const char*);
+
     IDBDatabaseIdentifier m_identifier;
     std::unique_ptr<IDBDatabaseInfo> m_databaseInfo;
     std::unique_ptr<IDBDatabaseInfo> m_originalDatabaseInfoBeforeVersionChange;
 
     std::unique_ptr<SQLiteDatabase> m_sqliteDB;
+    std::unique_ptr<SQLiteStatement> m_cachedStatements[static_cast<size_t>(SQL::Count)];
 
     HashMap<IDBResourceIdentifier, std::unique_ptr<SQLiteIDBTransaction>> m_transactions;
     HashMap<IDBResourceIdentifier, SQLiteIDBCursor*> m_cursors;
@@ -351,46 +351,71 @@ bool AudioBufferSourceNode::renderFromBuffer(AudioBus* bus, unsigned destination
             }
         }
     } else {
-        while (framesToProcess--) {
-            unsigned readIndex = static_cast<unsigned>(virtualReadIndex);
-            double interpolationFactor = virtualReadIndex - readIndex;
+        // Process the frames in two passes: first walk the read cursor and collect the
+        // sample indices and interpolation weights for a run, then interpolate each
+        // channel over the whole run in a tight loop. This keeps the per-sample
+        // wrap-around and bounds handling out of the per-channel arithmetic, which the
+        // compiler can then unroll and pipeline.
+        unsigned readIndices[AudioNode::ProcessingSizeInFrames];
+        unsigned readIndices2[AudioNode::ProcessingSizeInFrames];
+        float interpolationFactors[AudioNode::ProcessingSizeInFrames];
+        ASSERT(numberOfFrames <= AudioNode::ProcessingSizeInFrames);
+
+        bool finished = false;
+        while (framesToProcess > 0 && !finished) {
+            int framesThisTime = 0;
+            int remainingAfterRun = framesToProcess;
+            while (remainingAfterRun > 0) {
+                unsigned readIndex = static_cast<unsigned>(virtualReadIndex);
+                double interpolationFactor = virtualReadIndex - readIndex;
+
+                // For linear interpolation we need the next sample-frame too.
+                unsigned readIndex2 = readIndex + 1;
+                if (readIndex2 >= bufferLength) {
+                    if (loop()) {
+                        // Make sure to wrap around at the end of the buffer.
+                        readIndex2 = static_cast<unsigned>(virtualReadIndex + 1 - virtualDeltaFrames);
+                    } else
+                        readIndex2 = readIndex;
+                }
 
-            // For linear interpolation we need the next sample-frame too.
-            unsigned readIndex2 = readIndex + 1;
-            if (readIndex2 >= bufferLength) {
-                if (loop()) {
-                    // Make sure to wrap around at the end of the buffer.
-                    readIndex2 = static_cast<unsigned>(virtualReadIndex + 1 - virtualDeltaFrames);
-                } else
-                    readIndex2 = readIndex;
-            }
+                // Final sanity check on buffer access.
+                if (readIndex >= bufferLength || readIndex2 >= bufferLength) {
+                    finished = true;
+                    break;
+                }
 
-            // Final sanity check on buffer access.
-            // FIXME: as an optimization, try to get rid of this inner-loop check and put assertions and guards before the loop.
-            if (readIndex >= bufferLength || readIndex2 >= bufferLength)
-                break;
+                readIndices[framesThisTime] = readIndex;
+                readIndices2[framesThisTime] = readIndex2;
+                interpolationFactors[framesThisTime] = narrowPrecisionToFloat(interpolationFactor);
+                ++framesThisTime;
+                --remainingAfterRun;
+
+                virtualReadIndex += pitchRate;
+
+                // Wrap-around, retaining sub-sample position since virtualReadIndex is floating-point.
+                if (virtualReadIndex >= virtualMaxFrame) {
+                    virtualReadIndex -= virtualDeltaFrames;
+                    if (renderSilenceAndFinishIfNotLooping(bus, writeIndex + framesThisTime, remainingAfterRun))
+                        finished = true;
+                    break;
+                }
+            }
 
             // Linear interpolation.
             for (unsigned i = 0; i < numberOfChannels; ++i) {
-                float* destination = destinationChannels[i];
+                float* destination = destinationChannels[i] + writeIndex;
                 const float* source = sourceChannels[i];
 
-                double sample1 = source[readIndex];
-                double sample2 = source[readIndex2];
-                double sample = (1.0 - interpolationFactor) * sample1 + interpolationFactor * sample2;
-
-                destination[writeIndex] = narrowPrecisionToFloat(sample);
+                for (int frame = 0; frame < framesThisTime; ++frame) {
+                    float sample1 = source[readIndices[frame]];
+                    float sample2 = source[readIndices2[frame]];
+                    destination[frame] = sample1 + interpolationFactors[frame] * (sample2 - sample1);
+                }
             }
-            writeIndex++;
 
-            virtualReadIndex += pitchRate;
-
-            // Wrap-around, retaining sub-sample position since virtualReadIndex is floating-point.
-            if (virtualReadIndex >= virtualMaxFrame) {
-                virtualReadIndex -= virtualDeltaFrames;
-                if (renderSilenceAndFinishIfNotLooping(bus, writeIndex, framesToProcess))
-                    break;
-            }
+            writeIndex += framesThisTime;
+            framesToProcess = remainingAfterRun;
         }
     }
 
@@ -67,6 +67,7 @@ const double TCPMaximumSegmentLifetime = 2 * 60.0;
 WebSocketChannel::WebSocketChannel(Document* document, WebSocketChannelClient* client)
     : m_document(document)
     , m_client(client)
+    , m_bufferOffset(0)
     , m_resumeTimer(*this, &WebSocketChannel::resumeTimerFired)
     , m_suspended(false)
     , m_closing(false)
@@ -215,8 +216,8 @@ void WebSocketChannel::fail(const String& reason)
     // once the WebSocket connection is failed (section 7.1.7).
     Ref<WebSocketChannel> protect(*this); // The client can close the channel, potentially removing the last reference.
     m_shouldDiscardReceivedData = true;
-    if (!m_buffer.isEmpty())
-        skipBuffer(m_buffer.size()); // Save memory.
+    if (bufferSize())
+        skipBuffer(bufferSize()); // Save memory.
     m_deflateFramer.didFail();
     m_hasContinuousFrame = false;
     m_continuousFrameData.clear();
@@ -250,7 +251,7 @@ void WebSocketChannel::suspend()
 void WebSocketChannel::resume()
 {
     m_suspended = false;
-    if ((!m_buffer.isEmpty() || m_closed) && m_client && !m_resumeTimer.isActive())
+    if ((bufferSize() || m_closed) && m_client && !m_resumeTimer.isActive())
         m_resumeTimer.startOneShot(0);
 }
 
@@ -321,7 +322,7 @@ void WebSocketChannel::didReceiveSocketStreamData(SocketStreamHandle* handle, co
         fail("Ran out of memory while receiving WebSocket data.");
         return;
     }
-    while (!m_suspended && m_client && !m_buffer.isEmpty())
+    while (!m_suspended && m_client && bufferSize())
         if (!processBuffer())
             break;
 }
@@ -396,6 +397,15 @@ void WebSocketChannel::didFail(int errorCode)
 
 bool WebSocketChannel::appendToBuffer(const char* data, size_t len)
 {
+    // Drop the bytes the frame loop has consumed before growing the buffer. Compacting here,
+    // once per socket read, rather than in skipBuffer() keeps a read containing many small
+    // frames from paying for one memmove of the buffer tail per frame.
+    if (m_bufferOffset) {
+        memmove(m_buffer.data(), m_buffer.data() + m_bufferOffset, m_buffer.size() - m_bufferOffset);
+        m_buffer.resize(m_buffer.size() - m_bufferOffset);
+        m_bufferOffset = 0;
+    }
+
     size_t newBufferSize = m_buffer.size() + len;
     if (newBufferSize < m_buffer.size()) {
         LOG(Network, "WebSocketChannel %p appendToBuffer() Buffer overflow (%lu bytes already in receive buffer and appending %lu bytes)", this, static_cast<unsigned long>(m_buffer.size()), static_cast<unsigned long>(len));
@@ -407,30 +417,33 @@ bool WebSocketChannel::appendToBuffer(const char* data, size_t len)
 
 void WebSocketChannel::skipBuffer(size_t len)
 {
-    ASSERT_WITH_SECURITY_IMPLICATION(len <= m_buffer.size());
-    memmove(m_buffer.data(), m_buffer.data() + len, m_buffer.size() - len);
-    m_buffer.resize(m_buffer.size() - len);
+    ASSERT_WITH_SECURITY_IMPLICATION(len <= bufferSize());
+    m_bufferOffset += len;
+    if (m_bufferOffset == m_buffer.size()) {
+        m_buffer.resize(0);
+        m_bufferOffset = 0;
+    }
 }
 
 bool WebSocketChannel::processBuffer()
 {
     ASSERT(!m_suspended);
     ASSERT(m_client);
-    ASSERT(!m_buffer.isEmpty());
-    LOG(Network, "WebSocketChannel %p processBuffer() Receive buffer has %lu bytes", this, static_cast<unsigned long>(m_buffer.size()));
+    ASSERT(bufferSize());
+    LOG(Network, "WebSocketChannel %p processBuffer() Receive buffer has %lu bytes", this, static_cast<unsigned long>(bufferSize()));
 
     if (m_shouldDiscardReceivedData)
         return false;
 
     if (m_receivedClosingHandshake) {
-        skipBuffer(m_buffer.size());
+        skipBuffer(bufferSize());
         return false;
     }
 
     Ref<WebSocketChannel> protect(*this); // The client can close the channel, potentially removing the last reference.
 
     if (m_handshake->mode() == WebSocketHandshake::Incomplete) {
-        int headerLength = m_handshake->readServerHandshake(m_buffer.data(), m_buffer.size());
+        int headerLength = m_handshake->readServerHandshake(bufferData(), bufferSize());
         if (headerLength <= 0)
             return false;
         if (m_handshake->mode() == WebSocketHandshake::Connected) {
@@ -446,8 +459,8 @@ bool WebSocketChannel::processBuffer()
             LOG(Network, "WebSocketChannel %p Connected", this);
             skipBuffer(headerLength);
             m_client->didConnect();
-            LOG(Network, "WebSocketChannel %p %lu bytes remaining in m_buffer", this, static_cast<unsigned long>(m_buffer.size()));
-            return !m_buffer.isEmpty();
+            LOG(Network, "WebSocketChannel %p %lu bytes remaining in m_buffer", this, static_cast<unsigned long>(bufferSize()));
+            return bufferSize();
         }
         ASSERT(m_handshake->mode() == WebSocketHandshake::Failed);
         LOG(Network, "WebSocketChannel %p Connection failed", this);
@@ -465,7 +478,7 @@ bool WebSocketChannel::processBuffer()
 void WebSocketChannel::resumeTimerFired()
 {
     Ref<WebSocketChannel> protect(*this); // The client can close the channel, potentially removing the last reference.
-    while (!m_suspended && m_client && !m_buffer.isEmpty())
+    while (!m_suspended && m_client && bufferSize())
         if (!processBuffer())
             break;
     if (!m_suspended && m_client && m_closed && m_handle)
@@ -512,12 +525,12 @@ void WebSocketChannel::closingTimerFired()
 
 bool WebSocketChannel::processFrame()
 {
-    ASSERT(!m_buffer.isEmpty());
+    ASSERT(bufferSize());
 
     WebSocketFrame frame;
     const char* frameEnd;
     String errorString;
-    WebSocketFrame::ParseFrameResult result = WebSocketFrame::parseFrame(m_buffer.data(), m_buffer.size(), frame, frameEnd, errorString);
+    WebSocketFrame::ParseFrameResult result = WebSocketFrame::parseFrame(bufferData(), bufferSize(), frame, frameEnd, errorString);
     if (result == WebSocketFrame::FrameIncomplete)
         return false;
     if (result == WebSocketFrame::FrameError) {
@@ -525,8 +538,8 @@ bool WebSocketChannel::processFrame()
         return false;
     }
 
-    ASSERT(m_buffer.data() < frameEnd);
-    ASSERT(frameEnd <= m_buffer.data() + m_buffer.size());
+    ASSERT(bufferData() < frameEnd);
+    ASSERT(frameEnd <= bufferData() + bufferSize());
 
     auto inflateResult = m_deflateFramer.inflate(frame);
     if (!inflateResult->succeeded()) {
@@ -580,7 +593,7 @@ bool WebSocketChannel::processFrame()
             return false;
         }
         m_continuousFrameData.append(frame.payload, frame.payloadLength);
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         if (frame.final) {
             // onmessage handler may eventually call the other methods of this channel,
             // so we should pretend that we have finished to read this frame and
@@ -610,7 +623,7 @@ bool WebSocketChannel::processFrame()
                 message = String::fromUTF8(frame.payload, frame.payloadLength);
             else
                 message = emptyString();
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
             if (message.isNull())
                 fail("Could not decode a text frame as UTF-8.");
             else
@@ -620,7 +633,7 @@ bool WebSocketChannel::processFrame()
             m_continuousFrameOpCode = WebSocketFrame::OpCodeText;
             ASSERT(m_continuousFrameData.isEmpty());
             m_continuousFrameData.append(frame.payload, frame.payloadLength);
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
         }
         break;
 
@@ -628,14 +641,14 @@ bool WebSocketChannel::processFrame()
         if (frame.final) {
             Vector<uint8_t> binaryData(frame.payloadLength);
             memcpy(binaryData.data(), frame.payload, frame.payloadLength);
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
             m_client->didReceiveBinaryData(WTFMove(binaryData));
         } else {
             m_hasContinuousFrame = true;
             m_continuousFrameOpCode = WebSocketFrame::OpCodeBinary;
             ASSERT(m_continuousFrameData.isEmpty());
             m_continuousFrameData.append(frame.payload, frame.payloadLength);
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
         }
         break;
 
@@ -660,7 +673,7 @@ bool WebSocketChannel::processFrame()
             m_closeEventReason = String::fromUTF8(&frame.payload[2], frame.payloadLength - 2);
         else
             m_closeEventReason = emptyString();
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         m_receivedClosingHandshake = true;
         startClosingHandshake(m_closeEventCode, m_closeEventReason);
         if (m_closing) {
@@ -672,23 +685,23 @@ bool WebSocketChannel::processFrame()
 
     case WebSocketFrame::OpCodePing:
         enqueueRawFrame(WebSocketFrame::OpCodePong, frame.payload, frame.payloadLength);
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         processOutgoingFrameQueue();
         break;
 
     case WebSocketFrame::OpCodePong:
         // A server may send a pong in response to our ping, or an unsolicited pong which is not associated with
         // any specific ping. Either way, there's nothing to do on receipt of pong.
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         break;
 
     default:
         ASSERT_NOT_REACHED();
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         break;
     }
 
-    return !m_buffer.isEmpty();
+    return bufferSize();
 }
 
 void WebSocketChannel::enqueueTextFrame(const CString& string)
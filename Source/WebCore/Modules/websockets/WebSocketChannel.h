@@ -126,6 +126,11 @@ private:
 
     bool appendToBuffer(const char* data, size_t len);
     void skipBuffer(size_t len);
+
+    // The unprocessed portion of m_buffer. Consumed bytes are skipped by advancing
+    // m_bufferOffset; the buffer itself is only compacted once per socket read.
+    char* bufferData() { return m_buffer.data() + m_bufferOffset; }
+    size_t bufferSize() const { return m_buffer.size() - m_bufferOffset; }
     bool processBuffer();
     void resumeTimerFired();
     void startClosingHandshake(int code, const String& reason);
@@ -189,6 +194,7 @@ private:
     std::unique_ptr<WebSocketHandshake> m_handshake;
     RefPtr<SocketStreamHandle> m_handle;
     Vector<char> m_buffer;
+    size_t m_bufferOffset;
 
     Timer m_resumeTimer;
     bool m_suspended;
@@ -145,6 +145,7 @@ AXObjectCache::AXObjectCache(Document& document)
     , m_notificationPostTimer(*this, &AXObjectCache::notificationPostTimerFired)
     , m_passwordNotificationPostTimer(*this, &AXObjectCache::passwordNotificationPostTimerFired)
     , m_liveRegionChangedPostTimer(*this, &AXObjectCache::liveRegionChangedNotificationPostTimerFired)
+    , m_childrenChangedPostTimer(*this, &AXObjectCache::childrenChangedPostTimerFired)
     , m_currentAriaModalNode(nullptr)
 {
     findAriaModalNodes();
@@ -154,6 +155,7 @@ AXObjectCache::~AXObjectCache()
 {
     m_notificationPostTimer.stop();
     m_liveRegionChangedPostTimer.stop();
+    m_childrenChangedPostTimer.stop();
 
     for (const auto& object : m_objects.values()) {
         detachWrapper(object.get(), CacheDestroyed);
@@ -814,9 +816,38 @@ void AXObjectCache::childrenChanged(AccessibilityObject* obj)
     if (!obj)
         return;
 
-    obj->childrenChanged();
+    // Defer the ancestor walk this triggers to the end of the event-loop turn, so a run of
+    // mutations under the same container is dirtied once instead of once per mutation. This
+    // also moves the walk out of render tree layout, where it would otherwise often run.
+    m_deferredChildrenChangedSet.add(obj);
+    if (!m_childrenChangedPostTimer.isActive())
+        m_childrenChangedPostTimer.startOneShot(0);
 }
-    
+
+void AXObjectCache::childrenChangedPostTimerFired()
+{
+    m_childrenChangedPostTimer.stop();
+    processDeferredChildrenChanged();
+}
+
+void AXObjectCache::processDeferredChildrenChanged()
+{
+    if (m_deferredChildrenChangedSet.isEmpty())
+        return;
+
+    Ref<Document> protectorForCacheOwner(m_document);
+
+    // Processing can report further children changes; those get their own deferral, so only
+    // this turn's snapshot is walked here.
+    auto deferredSet = WTFMove(m_deferredChildrenChangedSet);
+    for (const auto& object : deferredSet) {
+        if (!object->axObjectID() || !object->axObjectCache())
+            continue;
+
+        object->childrenChanged();
+    }
+}
+
 void AXObjectCache::notificationPostTimerFired()
 {
     Ref<Document> protectorForCacheOwner(m_document);
@@ -1662,7 +1662,12 @@ void AccessibilityObject::updateBackingStore()
         if (!document->view()->isInRenderTreeLayout())
             document->updateLayoutIgnorePendingStylesheets();
     }
-    
+
+    // Children changes coalesced during this turn must dirty their ancestors before the
+    // wrapper reads children, or an assistive technology query could see stale state.
+    if (AXObjectCache* cache = axObjectCache())
+        cache->processDeferredChildrenChanged();
+
     updateChildrenIfNecessary();
 }
 #endif
@@ -30,6 +30,7 @@
 #include <runtime/VM.h>
 #include <runtime/JSLock.h>
 #include <heap/Heap.h>
+#include <wtf/CurrentTime.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/FastMalloc.h>
 #include <wtf/NeverDestroyed.h>
@@ -99,6 +100,17 @@ void GCController::garbageCollectNowIfNotDoneRecently()
 #endif
 }
 
+void GCController::garbageCollectDuringIdlePeriod(double idleSeconds)
+{
+    if (idleSeconds <= 0)
+        return;
+
+    double deadline = WTF::monotonicallyIncreasingTime() + idleSeconds;
+    JSLockHolder lock(JSDOMWindow::commonVM());
+    if (!JSDOMWindow::commonVM().heap.isBusy())
+        JSDOMWindow::commonVM().heap.collectDuringIdlePeriod(deadline);
+}
+
 void GCController::garbageCollectOnAlternateThreadForDebugging(bool waitUntilDone)
 {
     ThreadIdentifier threadID = createThread(collect, 0, "WebCore: GCController");
@@ -437,20 +437,24 @@ template<typename T> inline JSC::JSValue toJS(JSC::ExecState* exec, JSDOMGlobalO
     return toJS(exec, globalObject, ptr.get());
 }
 
+// We stage the converted elements in a MarkedArgumentBuffer and then build the array in
+// one shot; constructArray() fills freshly-allocated uninitialized storage directly, so
+// we don't pay the per-element putDirectIndex barriers and indexing checks. The staging
+// buffer is also what keeps the wrappers alive, since each toJS() call can GC.
 template<typename T> inline JSC::JSValue toJS(JSC::ExecState* exec, JSDOMGlobalObject* globalObject, const Vector<T>& vector)
 {
-    JSC::JSArray* array = constructEmptyArray(exec, nullptr, vector.size());
-    for (size_t i = 0; i < vector.size(); ++i)
-        array->putDirectIndex(exec, i, toJS(exec, globalObject, vector[i]));
-    return array;
+    JSC::MarkedArgumentBuffer list;
+    for (auto& element : vector)
+        list.append(toJS(exec, globalObject, element));
+    return JSC::constructArray(exec, nullptr, globalObject, list);
 }
 
 template<typename T> inline JSC::JSValue toJS(JSC::ExecState* exec, JSDOMGlobalObject* globalObject, const Vector<RefPtr<T>>& vector)
 {
-    JSC::JSArray* array = constructEmptyArray(exec, nullptr, vector.size());
-    for (size_t i = 0; i < vector.size(); ++i)
-        array->putDirectIndex(exec, i, toJS(exec, globalObject, vector[i].get()));
-    return array;
+    JSC::MarkedArgumentBuffer list;
+    for (auto& element : vector)
+        list.append(toJS(exec, globalObject, element.get()));
+    return JSC::constructArray(exec, nullptr, globalObject, list);
 }
 
 inline JSC::JSValue toJS(JSC::ExecState* exec, JSDOMGlobalObject*, const String& value)
@@ -1506,9 +1506,19 @@ private:
         }
         const String& string() { return m_string; }
 
+        // Property names recur for every element of an array of like-shaped objects, so
+        // resolve the atomic string table entry once per distinct name rather than per use.
+        const Identifier& identifier(ExecState* exec)
+        {
+            if (m_identifier.isNull())
+                m_identifier = Identifier::fromString(exec, m_string);
+            return m_identifier;
+        }
+
     private:
         String m_string;
         JSValue m_jsString;
+        Identifier m_identifier;
     };
 
     struct CachedStringRef {
@@ -2486,11 +2496,11 @@ DeserializationResult CloneDeserializer::deserialize()
             }
 
             if (JSValue terminal = readTerminal()) {
-                putProperty(outputObjectStack.last(), Identifier::fromString(m_exec, cachedString->string()), terminal);
+                putProperty(outputObjectStack.last(), cachedString->identifier(m_exec), terminal);
                 goto objectStartVisitMember;
             }
             stateStack.append(ObjectEndVisitMember);
-            propertyNameStack.append(Identifier::fromString(m_exec, cachedString->string()));
+            propertyNameStack.append(cachedString->identifier(m_exec));
             goto stateUnknown;
         }
         case ObjectEndVisitMember: {
@@ -40,8 +40,13 @@
 #include "NFA.h"
 #include "NFAToDFA.h"
 #include "URLFilterParser.h"
+#include <wtf/Condition.h>
 #include <wtf/CurrentTime.h>
 #include <wtf/DataLog.h>
+#include <wtf/Deque.h>
+#include <wtf/Lock.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/Threading.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/StringBuilder.h>
 
@@ -205,6 +210,93 @@ static void addUniversalActionsToDFA(DFA& dfa, const UniversalActionSet& univers
     root.setActions(actionsStart, static_cast<uint16_t>(actionsLength));
 }
 
+// Converting the independent NFAs to DFAs dominates compile time, so spread the conversions over
+// a pool of worker threads. DFAs at least as large as minimumDFASizeToMinimize are also minimized
+// on the workers. The handler is invoked by one thread at a time, in the order the NFAs were
+// produced, so the generated bytecode stays deterministic.
+static void convertNFAsToDFAs(CombinedURLFilters& filters, size_t maxNFASize, unsigned minimumDFASizeToMinimize, std::function<void(DFA&&)> handler)
+{
+    struct ConversionState {
+        Lock lock;
+        Condition condition;
+        Deque<std::pair<size_t, NFA>> pendingNFAs;
+        size_t producedNFACount { 0 };
+        size_t nextSequenceNumberToDeliver { 0 };
+        bool doneProducing { false };
+    };
+    ConversionState state;
+
+    unsigned threadCount = std::max(1, WTF::numberOfProcessorCores());
+    const size_t maxPendingNFAs = 2 * threadCount;
+
+    auto workerFunction = [&state, minimumDFASizeToMinimize, &handler] {
+        while (true) {
+            size_t sequenceNumber;
+            std::unique_ptr<NFA> nfa;
+            {
+                LockHolder locker(state.lock);
+                while (state.pendingNFAs.isEmpty() && !state.doneProducing)
+                    state.condition.wait(state.lock);
+                if (state.pendingNFAs.isEmpty())
+                    return;
+                auto pending = state.pendingNFAs.takeFirst();
+                sequenceNumber = pending.first;
+                nfa = std::make_unique<NFA>(WTFMove(pending.second));
+                // The producer may be waiting for room in the queue.
+                state.condition.notifyAll();
+            }
+
+#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
+            nfa->debugPrintDot();
+#endif
+            DFA dfa = NFAToDFA::convert(*nfa);
+            nfa = nullptr;
+#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
+            dfa.debugPrintDot();
+#endif
+            if (dfa.graphSize() >= minimumDFASizeToMinimize)
+                dfa.minimize();
+
+            // Only the worker holding the next sequence number may deliver, which keeps the
+            // handler serialized without holding the lock while it runs.
+            {
+                LockHolder locker(state.lock);
+                while (state.nextSequenceNumberToDeliver != sequenceNumber)
+                    state.condition.wait(state.lock);
+            }
+            handler(WTFMove(dfa));
+            {
+                LockHolder locker(state.lock);
+                ++state.nextSequenceNumberToDeliver;
+                state.condition.notifyAll();
+            }
+        }
+    };
+
+    Vector<ThreadIdentifier> threads;
+    threads.reserveInitialCapacity(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i)
+        threads.uncheckedAppend(createThread("WebCore: ContentExtensionCompiler", workerFunction));
+
+    filters.processNFAs(maxNFASize, [&state, maxPendingNFAs](NFA&& nfa) {
+        LOG_LARGE_STRUCTURES(nfa, nfa.memoryUsed());
+        LockHolder locker(state.lock);
+        // Bound the number of NFAs in flight; they are the largest structures during compilation.
+        while (state.pendingNFAs.size() >= maxPendingNFAs)
+            state.condition.wait(state.lock);
+        state.pendingNFAs.append(std::make_pair(state.producedNFACount++, WTFMove(nfa)));
+        state.condition.notifyAll();
+    });
+
+    {
+        LockHolder locker(state.lock);
+        state.doneProducing = true;
+        state.condition.notifyAll();
+    }
+    for (auto& thread : threads)
+        waitForThreadCompletion(thread);
+}
+
 std::error_code compileRuleList(ContentExtensionCompilationClient& client, String&& ruleList)
 {
     Vector<ContentExtensionRule> parsedRuleList;
@@ -332,22 +424,13 @@ std::error_code compileRuleList(ContentExtensionCompilationClient& client, Strin
 
     const unsigned smallDFASize = 100;
     DFACombiner smallFiltersWithoutDomainsDFACombiner;
-    filtersWithoutDomains.processNFAs(maxNFASize, [&](NFA&& nfa) {
-#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
-        dataLogF("filtersWithoutDomains NFA\n");
-        nfa.debugPrintDot();
-#endif
-
-        LOG_LARGE_STRUCTURES(nfa, nfa.memoryUsed());
-        DFA dfa = NFAToDFA::convert(nfa);
+    convertNFAsToDFAs(filtersWithoutDomains, maxNFASize, smallDFASize, [&](DFA&& dfa) {
         LOG_LARGE_STRUCTURES(dfa, dfa.memoryUsed());
 
         if (dfa.graphSize() < smallDFASize)
             smallFiltersWithoutDomainsDFACombiner.addDFA(WTFMove(dfa));
-        else {
-            dfa.minimize();
+        else
             lowerFiltersWithoutDomainsDFAToBytecode(WTFMove(dfa));
-        }
     });
 
 
@@ -396,27 +479,15 @@ std::error_code compileRuleList(ContentExtensionCompilationClient& client, Strin
     };
 
     DFACombiner smallFiltersWithDomainsDFACombiner;
-    filtersWithDomains.processNFAs(maxNFASize, [&](NFA&& nfa) {
-#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
-        dataLogF("filtersWithDomains NFA\n");
-        nfa.debugPrintDot();
-#endif
-        LOG_LARGE_STRUCTURES(nfa, nfa.memoryUsed());
-        DFA dfa = NFAToDFA::convert(nfa);
-#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
-        dataLogF("filtersWithDomains PRE MINIMIZING DFA\n");
-        dfa.debugPrintDot();
-#endif
+    convertNFAsToDFAs(filtersWithDomains, maxNFASize, smallDFASize, [&](DFA&& dfa) {
         LOG_LARGE_STRUCTURES(dfa, dfa.memoryUsed());
 
         ASSERT_WITH_MESSAGE(!dfa.nodes[dfa.root].hasActions(), "Filters with domains that match everything are not allowed right now.");
 
         if (dfa.graphSize() < smallDFASize)
             smallFiltersWithDomainsDFACombiner.addDFA(WTFMove(dfa));
-        else {
-            dfa.minimize();
+        else
             lowerFiltersWithDomainsDFAToBytecode(WTFMove(dfa));
-        }
     });
     smallFiltersWithDomainsDFACombiner.combineDFAs(smallDFASize, [&](DFA&& dfa) {
         LOG_LARGE_STRUCTURES(dfa, dfa.memoryUsed());
@@ -440,20 +511,10 @@ std::error_code compileRuleList(ContentExtensionCompilationClient& client, Strin
     LOG_LARGE_STRUCTURES(universalActionsWithDomains, universalActionsWithDomains.capacity() * sizeof(unsigned));
     universalActionsWithDomains.clear();
 
-    domainFilters.processNFAs(maxNFASize, [&](NFA&& nfa) {
-#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
-        dataLogF("domainFilters NFA\n");
-        nfa.debugPrintDot();
-#endif
-        LOG_LARGE_STRUCTURES(nfa, nfa.memoryUsed());
-        DFA dfa = NFAToDFA::convert(nfa);
-#if CONTENT_EXTENSIONS_STATE_MACHINE_DEBUGGING
-        dataLogF("domainFilters DFA\n");
-        dfa.debugPrintDot();
-#endif
+    // Minimizing these DFAs would not be effective because all actions are unique
+    // and because of the tree-like structure of these DFAs.
+    convertNFAsToDFAs(domainFilters, maxNFASize, std::numeric_limits<unsigned>::max(), [&](DFA&& dfa) {
         LOG_LARGE_STRUCTURES(dfa, dfa.memoryUsed());
-        // Minimizing this DFA would not be effective because all actions are unique
-        // and because of the tree-like structure of this DFA.
         ASSERT_WITH_MESSAGE(!dfa.nodes[dfa.root].hasActions(), "There should not be any domains that match everything.");
 
         Vector<DFABytecode> bytecode;
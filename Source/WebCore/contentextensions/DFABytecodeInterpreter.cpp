@@ -126,12 +126,11 @@ void DFABytecodeInterpreter::interpretTestFlagsAndAppendAction(uint32_t& program
     ASSERT(instructionSizeWithArguments(DFABytecodeInstruction::TestFlagsAndAppendAction) == instructionSizeWithArguments(DFABytecodeInstruction::TestFlagsAndAppendActionWithIfDomain));
 }
 
-template<bool caseSensitive>
 inline void DFABytecodeInterpreter::interpetJumpTable(const char* url, uint32_t& urlIndex, uint32_t& programCounter, bool& urlIndexIsAfterEndOfString)
 {
     DFABytecodeJumpSize jumpSize = getJumpSize(m_bytecode, m_bytecodeLength, programCounter);
 
-    char character = caseSensitive ? url[urlIndex] : toASCIILower(url[urlIndex]);
+    char character = url[urlIndex];
     uint8_t firstCharacter = getBits<uint8_t>(m_bytecode, m_bytecodeLength, programCounter + sizeof(DFABytecodeInstruction));
     uint8_t lastCharacter = getBits<uint8_t>(m_bytecode, m_bytecodeLength, programCounter + sizeof(DFABytecodeInstruction) + sizeof(uint8_t));
     if (character >= firstCharacter && character <= lastCharacter) {
@@ -182,9 +181,17 @@ DFABytecodeInterpreter::Actions DFABytecodeInterpreter::interpret(const CString&
 {
     const char* url = urlCString.data();
     ASSERT(url);
-    
+
+    // Lowercase the URL once up front so the case-insensitive instructions, which dominate
+    // compiled rule lists, don't convert the same characters over and over for every DFA.
+    unsigned urlLength = urlCString.length();
+    Vector<char, 512> lowercasedURLBuffer(urlLength + 1);
+    for (unsigned i = 0; i <= urlLength; ++i)
+        lowercasedURLBuffer[i] = toASCIILower(url[i]);
+    const char* lowercasedURL = lowercasedURLBuffer.data();
+
     Actions actions;
-    
+
     uint32_t programCounter = 0;
     while (programCounter < m_bytecodeLength) {
 
@@ -252,7 +259,7 @@ DFABytecodeInterpreter::Actions DFABytecodeInterpreter::interpret(const CString&
                     goto nextDFA;
 
                 // Check to see if the next character in the url is the value stored with the bytecode.
-                char character = toASCIILower(url[urlIndex]);
+                char character = lowercasedURL[urlIndex];
                 DFABytecodeJumpSize jumpSize = getJumpSize(m_bytecode, m_bytecodeLength, programCounter);
                 if (character == getBits<uint8_t>(m_bytecode, m_bytecodeLength, programCounter + sizeof(DFABytecodeInstruction))) {
                     uint32_t jumpLocation = programCounter + sizeof(DFABytecodeInstruction) + sizeof(uint8_t);
@@ -269,13 +276,13 @@ DFABytecodeInterpreter::Actions DFABytecodeInterpreter::interpret(const CString&
                 if (urlIndexIsAfterEndOfString)
                     goto nextDFA;
 
-                interpetJumpTable<false>(url, urlIndex, programCounter, urlIndexIsAfterEndOfString);
+                interpetJumpTable(lowercasedURL, urlIndex, programCounter, urlIndexIsAfterEndOfString);
                 break;
             case DFABytecodeInstruction::JumpTableCaseSensitive:
                 if (urlIndexIsAfterEndOfString)
                     goto nextDFA;
 
-                interpetJumpTable<true>(url, urlIndex, programCounter, urlIndexIsAfterEndOfString);
+                interpetJumpTable(url, urlIndex, programCounter, urlIndexIsAfterEndOfString);
                 break;
                     
             case DFABytecodeInstruction::CheckValueRangeCaseSensitive: {
@@ -300,7 +307,7 @@ DFABytecodeInterpreter::Actions DFABytecodeInterpreter::interpret(const CString&
                 if (urlIndexIsAfterEndOfString)
                     goto nextDFA;
                 
-                char character = toASCIILower(url[urlIndex]);
+                char character = lowercasedURL[urlIndex];
                 DFABytecodeJumpSize jumpSize = getJumpSize(m_bytecode, m_bytecodeLength, programCounter);
                 if (character >= getBits<uint8_t>(m_bytecode, m_bytecodeLength, programCounter + sizeof(DFABytecodeInstruction))
                     && character <= getBits<uint8_t>(m_bytecode, m_bytecodeLength, programCounter + sizeof(DFABytecodeInstruction) + sizeof(uint8_t))) {
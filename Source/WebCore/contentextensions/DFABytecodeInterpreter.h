@@ -57,7 +57,6 @@ private:
     void interpretAppendAction(unsigned& programCounter, Actions&, bool ifDomain);
     void interpretTestFlagsAndAppendAction(unsigned& programCounter, uint16_t flags, Actions&, bool ifDomain);
 
-    template<bool caseSensitive>
     void interpetJumpTable(const char* url, uint32_t& urlIndex, uint32_t& programCounter, bool& urlIndexIsAfterEndOfString);
 
     const DFABytecode* m_bytecode;
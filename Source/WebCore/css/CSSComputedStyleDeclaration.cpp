@@ -53,6 +53,7 @@
 #include "Document.h"
 #include "ExceptionCode.h"
 #include "FontFeatureSettings.h"
+#include "FrameView.h"
 #include "HTMLFrameOwnerElement.h"
 #include "Pair.h"
 #include "PseudoElement.h"
@@ -2278,6 +2279,21 @@ static inline bool updateStyleIfNeededForNode(const Node& node)
     return true;
 }
 
+static bool hasPendingStyleOrLayoutWork(const Document& document)
+{
+    for (const Document* currentDocument = &document; currentDocument; currentDocument = currentDocument->ownerElement() ? &currentDocument->ownerElement()->document() : nullptr) {
+        if (!currentDocument->haveStylesheetsLoaded())
+            return true;
+        if (currentDocument->needsStyleRecalc())
+            return true;
+        if (FrameView* view = currentDocument->view()) {
+            if (view->needsLayout())
+                return true;
+        }
+    }
+    return false;
+}
+
 static inline RefPtr<RenderStyle> computeRenderStyleForProperty(Node* styledNode, PseudoId pseudoElementSpecifier, CSSPropertyID propertyID)
 {
     RenderObject* renderer = styledNode->renderer();
@@ -2407,7 +2423,12 @@ RefPtr<CSSValue> ComputedStyleExtractor::propertyValue(CSSPropertyID propertyID,
             || (document.styleResolverIfExists() && document.styleResolverIfExists()->hasViewportDependentMediaQueries() && document.ownerElement());
 
         if (forceFullLayout) {
-            document.updateLayoutIgnorePendingStylesheets();
+            // Layout-dependent properties tend to be queried repeatedly between mutations,
+            // particularly by animation and measurement code. When neither this document nor
+            // any ancestor frame has pending style or layout work the forced update is a
+            // no-op, so checking the dirty bits up front skips its fixed per-call overhead.
+            if (hasPendingStyleOrLayoutWork(document))
+                document.updateLayoutIgnorePendingStylesheets();
             styledNode = this->styledNode();
         }
     }
@@ -282,7 +282,7 @@ void CSSFontFace::fontLoaded(CSSFontFaceSource&)
     if (m_sourcesPopulated)
         pump();
 
-    m_fontSelector->fontLoaded();
+    m_fontSelector->fontLoaded(*this);
 
     for (auto& client : m_clients)
         client->fontLoaded(*this);
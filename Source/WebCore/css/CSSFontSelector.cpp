@@ -68,6 +68,7 @@ CSSFontSelector::CSSFontSelector(Document& document)
     , m_beginLoadingTimer(*this, &CSSFontSelector::beginLoadTimerFired)
     , m_uniqueId(++fontSelectorId)
     , m_version(0)
+    , m_familyVersionsTotal(0)
 {
     // FIXME: An old comment used to say there was no need to hold a reference to m_document
     // because "we are guaranteed to be destroyed before the document". But there does not
@@ -243,8 +244,8 @@ void CSSFontSelector::addFontFaceRule(const StyleRuleFontFace& fontFaceRule, boo
         }
 
         familyFontFaces.append(fontFace.copyRef());
-        
-        ++m_version;
+
+        bumpVersionForFamily(familyName);
     }
 }
 
@@ -258,23 +259,54 @@ void CSSFontSelector::unregisterForInvalidationCallbacks(FontSelectorClient& cli
     m_clients.remove(&client);
 }
 
-void CSSFontSelector::dispatchInvalidationCallbacks()
+void CSSFontSelector::bumpVersionForFamily(const String& familyName)
 {
-    ++m_version;
+    ++m_familyVersions.add(familyName, 0).iterator->value;
+    ++m_familyVersionsTotal;
+}
+
+unsigned CSSFontSelector::versionForFamily(const AtomicString& familyName) const
+{
+    // Generic families resolve to concrete families from Settings during lookup, so faces
+    // registered under any name can affect them.
+    if (familyName == standardFamily || familyName == serifFamily || familyName == sansSerifFamily
+        || familyName == cursiveFamily || familyName == fantasyFamily || familyName == monospaceFamily
+        || familyName == pictographFamily)
+        return m_familyVersionsTotal;
+    return m_familyVersions.get(familyName);
+}
 
+void CSSFontSelector::dispatchInvalidationCallbacks()
+{
     Vector<FontSelectorClient*> clients;
     copyToVector(m_clients, clients);
     for (size_t i = 0; i < clients.size(); ++i)
         clients[i]->fontsNeedUpdate(*this);
 }
 
-void CSSFontSelector::fontLoaded()
+void CSSFontSelector::fontLoaded(const CSSFontFace& face)
 {
+    // A face becoming available only changes lookups for the families it is registered
+    // under; bump those versions rather than the global one so unrelated cached
+    // FontCascadeFonts stay valid.
+    bool bumpedFamilyVersion = false;
+    if (const CSSValueList* families = face.families()) {
+        for (auto& item : *families) {
+            String familyName = familyNameFromPrimitive(downcast<CSSPrimitiveValue>(item.get()));
+            if (familyName.isEmpty())
+                continue;
+            bumpVersionForFamily(familyName);
+            bumpedFamilyVersion = true;
+        }
+    }
+    if (!bumpedFamilyVersion)
+        ++m_version;
     dispatchInvalidationCallbacks();
 }
 
 void CSSFontSelector::fontCacheInvalidated()
 {
+    ++m_version;
     dispatchInvalidationCallbacks();
 }
 
@@ -57,6 +57,7 @@ public:
     virtual ~CSSFontSelector();
     
     virtual unsigned version() const override { return m_version; }
+    virtual unsigned versionForFamily(const AtomicString&) const override;
     virtual unsigned uniqueId() const override { return m_uniqueId; }
 
     virtual FontRanges fontRangesForFamily(const FontDescription&, const AtomicString&) override;
@@ -69,7 +70,7 @@ public:
     static void appendSources(CSSFontFace&, CSSValueList&, Document*, bool isInitiatingElementInUserAgentShadowTree);
     void addFontFaceRule(const StyleRuleFontFace&, bool isInitiatingElementInUserAgentShadowTree);
 
-    void fontLoaded();
+    void fontLoaded(const CSSFontFace&);
     virtual void fontCacheInvalidated() override;
 
     bool isEmpty() const;
@@ -87,6 +88,7 @@ private:
     explicit CSSFontSelector(Document&);
 
     void dispatchInvalidationCallbacks();
+    void bumpVersionForFamily(const String&);
 
     void beginLoadTimerFired();
 
@@ -96,6 +98,7 @@ private:
     HashMap<String, Vector<Ref<CSSFontFace>>, ASCIICaseInsensitiveHash> m_fontFaces;
     HashMap<String, Vector<Ref<CSSFontFace>>, ASCIICaseInsensitiveHash> m_locallyInstalledFontFaces;
     HashMap<String, HashMap<unsigned, std::unique_ptr<CSSSegmentedFontFace>>, ASCIICaseInsensitiveHash> m_fonts;
+    HashMap<String, unsigned, ASCIICaseInsensitiveHash> m_familyVersions;
     HashSet<FontSelectorClient*> m_clients;
 
     Vector<CachedResourceHandle<CachedFont>> m_fontsToBeginLoading;
@@ -103,6 +106,7 @@ private:
 
     unsigned m_uniqueId;
     unsigned m_version;
+    unsigned m_familyVersionsTotal;
 };
 
 } // namespace WebCore
@@ -92,6 +92,11 @@ Ref<CSSStyleSheet> CSSStyleSheet::createInline(Node& ownerNode, const URL& baseU
     return adoptRef(*new CSSStyleSheet(StyleSheetContents::create(baseURL.string(), parserContext), &ownerNode, startPosition, true));
 }
 
+Ref<CSSStyleSheet> CSSStyleSheet::createInline(Ref<StyleSheetContents>&& sheet, Node& ownerNode, const TextPosition& startPosition)
+{
+    return adoptRef(*new CSSStyleSheet(WTFMove(sheet), &ownerNode, startPosition, true));
+}
+
 CSSStyleSheet::CSSStyleSheet(Ref<StyleSheetContents>&& contents, CSSImportRule* ownerRule)
     : m_contents(WTFMove(contents))
     , m_isInlineStylesheet(false)
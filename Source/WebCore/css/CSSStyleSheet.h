@@ -53,6 +53,7 @@ public:
     static Ref<CSSStyleSheet> create(Ref<StyleSheetContents>&&, CSSImportRule* ownerRule = 0);
     static Ref<CSSStyleSheet> create(Ref<StyleSheetContents>&&, Node* ownerNode);
     static Ref<CSSStyleSheet> createInline(Node&, const URL&, const TextPosition& startPosition = TextPosition::minimumPosition(), const String& encoding = String());
+    static Ref<CSSStyleSheet> createInline(Ref<StyleSheetContents>&&, Node& ownerNode, const TextPosition& startPosition);
 
     virtual ~CSSStyleSheet();
 
@@ -116,6 +116,10 @@ void DocumentRuleSets::collectFeatures() const
     m_uncommonAttributeRuleSet = makeRuleSet(m_features.uncommonAttributeRules);
 }
 
+// Lazily built per-class descendant invalidation rule sets. RuleFeatureSet collects the
+// rules whose non-rightmost compounds mention a class; ClassChangeInvalidation runs a
+// StyleInvalidationAnalysis over this set so toggling a class only restyles the
+// descendants those rules could actually affect.
 RuleSet* DocumentRuleSets::ancestorClassRules(AtomicStringImpl* className) const
 {
     auto addResult = m_ancestorClassRuleSets.add(className, nullptr);
@@ -38,6 +38,12 @@ namespace WebCore {
 
 class CSSSelector;
 
+// A counting Bloom filter over the identifiers (tag, id, classes, attribute names)
+// of the current ancestor chain. Style::TreeResolver pushes and pops frames as it
+// descends, and ElementRuleCollector consults it before running either the
+// interpreted SelectorChecker or a compiled selector, so rules whose descendant or
+// child combinators mention an identifier absent from the chain are rejected
+// without walking ancestors.
 class SelectorFilter {
 public:
     void pushParentStackFrame(Element* parent);
@@ -1168,6 +1168,19 @@ void StyleResolver::addToMatchedPropertiesCache(const RenderStyle* style, const
         m_matchedPropertiesCacheSweepTimer.startOneShot(matchedDeclarationCacheSweepTimeInSeconds);
     }
 
+    // The number of distinct declaration sets worth caching scales with the document;
+    // a large component tree has many more than a small page. Bound the cache size
+    // relative to the document's node count so small documents don't pin memory while
+    // waiting for the timer and large ones don't evict entries they will hit again.
+    static const unsigned minimumMatchedPropertiesCacheSize = 128;
+    static const unsigned maximumMatchedPropertiesCacheSize = 8192;
+    unsigned cacheSizeLimit = std::min(maximumMatchedPropertiesCacheSize, std::max(minimumMatchedPropertiesCacheSize, m_document.referencingNodeCount() / 8));
+    if (m_matchedPropertiesCache.size() >= cacheSizeLimit) {
+        sweepMatchedPropertiesCache();
+        if (m_matchedPropertiesCache.size() >= cacheSizeLimit)
+            return;
+    }
+
     ASSERT(hash);
     MatchedPropertiesCacheItem cacheItem;
     cacheItem.matchedProperties.appendVector(matchResult.matchedProperties());
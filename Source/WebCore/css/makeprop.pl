@@ -141,9 +141,22 @@ static_assert(numCSSProperties + 1 <= 65535, "CSSPropertyID should fit into uint
 
 EOF
 
-print GPERF "const char* const propertyNameStrings[numCSSProperties] = {\n";
+# Emit the name strings as one pooled literal plus offsets rather than an array of
+# pointers, so the table needs no load-time relocations and lives in read-only memory.
+print GPERF "static const char propertyNameStringsPool[] =\n";
+my $propertyStringOffset = 0;
+my @propertyStringOffsets = ();
 foreach my $name (@names) {
-  print GPERF "    \"$name\",\n";
+  print GPERF "    \"$name\\0\"\n";
+  push @propertyStringOffsets, $propertyStringOffset;
+  $propertyStringOffset += length($name) + 1;
+}
+die "CSSPropertyNames string pool does not fit in unsigned short offsets\n" if $propertyStringOffset > 65535;
+print GPERF ";\n\n";
+
+print GPERF "static const unsigned short propertyNameStringsOffsets[numCSSProperties] = {\n";
+foreach my $offset (@propertyStringOffsets) {
+  print GPERF "    $offset,\n";
 }
 print GPERF "};\n\n";
 
@@ -160,6 +173,8 @@ struct Property;
 %define lookup-function-name findPropertyImpl
 %define hash-function-name propery_hash_function
 %define word-array-name property_wordlist
+%pic
+%define string-pool-name propertyStringPool
 %enum
 %%
 EOF
@@ -188,7 +203,7 @@ const char* getPropertyName(CSSPropertyID id)
     int index = id - firstCSSProperty;
     if (index >= numCSSProperties)
         return 0;
-    return propertyNameStrings[index];
+    return propertyNameStringsPool + propertyNameStringsOffsets[index];
 }
 
 const AtomicString& getPropertyNameAtomicString(CSSPropertyID id)
@@ -202,7 +217,7 @@ const AtomicString& getPropertyNameAtomicString(CSSPropertyID id)
     static AtomicString* propertyStrings = new AtomicString[numCSSProperties]; // Intentionally never destroyed.
     AtomicString& propertyString = propertyStrings[index];
     if (propertyString.isNull()) {
-        const char* propertyName = propertyNameStrings[index];
+        const char* propertyName = propertyNameStringsPool + propertyNameStringsOffsets[index];
         propertyString = AtomicString(propertyName, strlen(propertyName), AtomicString::ConstructFromLiteral);
     }
     return propertyString;
@@ -85,6 +85,8 @@ struct Value;
 %define lookup-function-name findValueImpl
 %define hash-function-name value_hash_function
 %define word-array-name value_word_list
+%pic
+%define string-pool-name valueStringPool
 %enum
 %%
 EOF
@@ -95,19 +97,30 @@ foreach my $name (@names) {
   print GPERF $name . ", CSSValue" . $id . "\n";
 }
 
+# Emit the keyword strings as one pooled literal plus offsets rather than an array of
+# pointers, so the table needs no load-time relocations and lives in read-only memory.
 print GPERF << "EOF";
 %%
-static const char* const valueList[] = {
-    "",
+static const char valueListStringPool[] =
+    "\\0"
 EOF
 
+my $valueStringOffset = 1;
+my @valueStringOffsets = (0);
 foreach my $name (@names) {
-  print GPERF "    \"" . $name . "\",\n";
+  print GPERF "    \"" . $name . "\\0\"\n";
+  push @valueStringOffsets, $valueStringOffset;
+  $valueStringOffset += length($name) + 1;
 }
+die "CSSValueKeywords string pool does not fit in unsigned short offsets\n" if $valueStringOffset > 65535;
+
+print GPERF ";\n\nstatic const unsigned short valueListStringOffsets[numCSSValueKeywords] = {\n";
+foreach my $offset (@valueStringOffsets) {
+  print GPERF "    $offset,\n";
+}
+print GPERF "};\n";
 
 print GPERF << "EOF";
-    0
-};
 
 const Value* findValue(const char* str, unsigned int len)
 {
@@ -118,7 +131,7 @@ const char* getValueName(unsigned short id)
 {
     if (id >= numCSSValueKeywords || id <= 0)
         return 0;
-    return valueList[id];
+    return valueListStringPool + valueListStringOffsets[id];
 }
 
 } // namespace WebCore
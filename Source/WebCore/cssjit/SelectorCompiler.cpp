@@ -615,6 +615,8 @@ static inline FunctionType addPseudoClassType(const CSSSelector& selector, Selec
         return FunctionType::CannotMatchAnything;
 
     // FIXME: Compile these pseudoclasses, too!
+    // The of-type family needs a per-tag sibling count, so unlike :nth-child it cannot
+    // reuse the childIndex cache in ElementRareData and has to walk siblings anyway.
     case CSSSelector::PseudoClassFirstOfType:
     case CSSSelector::PseudoClassLastOfType:
     case CSSSelector::PseudoClassOnlyOfType:
@@ -237,8 +237,31 @@ AuthorStyleSheets::StyleResolverUpdateType AuthorStyleSheets::analyzeStyleSheetC
 
     // Find out which stylesheets are new.
     unsigned oldStylesheetCount = m_activeStyleSheets.size();
-    if (newStylesheetCount < oldStylesheetCount)
+    if (newStylesheetCount < oldStylesheetCount) {
+        // Sheets were removed. The style resolver has to be rebuilt since rule positions bake in
+        // the cascade order, but if the remaining sheets are an ordered subsequence of the old ones
+        // we can still scope the restyle to the elements the removed rules could have matched.
+        Vector<StyleSheetContents*> removedSheets;
+        unsigned newIndex = 0;
+        for (unsigned oldIndex = 0; oldIndex < oldStylesheetCount; ++oldIndex) {
+            if (newIndex < newStylesheetCount && m_activeStyleSheets[oldIndex] == newStylesheets[newIndex]) {
+                ++newIndex;
+                continue;
+            }
+            removedSheets.append(&m_activeStyleSheets[oldIndex]->contents());
+        }
+        if (newIndex != newStylesheetCount)
+            return Reconstruct;
+        if (!m_document.bodyOrFrameset() || m_document.hasNodesWithPlaceholderStyle())
+            return Reconstruct;
+
+        StyleInvalidationAnalysis invalidationAnalysis(removedSheets, styleResolver.mediaQueryEvaluator());
+        if (invalidationAnalysis.dirtiesAllStyle())
+            return Reconstruct;
+        invalidationAnalysis.invalidateStyle(m_document);
+        requiresFullStyleRecalc = false;
         return Reconstruct;
+    }
 
     Vector<StyleSheetContents*> addedSheets;
     unsigned newIndex = 0;
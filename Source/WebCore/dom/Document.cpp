@@ -187,6 +187,7 @@
 #include <wtf/SystemTracing.h>
 #include <wtf/TemporaryChange.h>
 #include <wtf/text/StringBuffer.h>
+#include <wtf/text/StringBuilder.h>
 #include <yarr/RegularExpression.h>
 
 #if ENABLE(DEVICE_ORIENTATION)
@@ -1885,9 +1886,16 @@ void Document::recalcStyle(Style::Change change)
                 renderView()->setStyle(WTFMove(documentStyle));
         }
 
+        double styleRecalcStartTime = 0;
+        if (UNLIKELY(m_styleRecalcTracingEnabled))
+            styleRecalcStartTime = monotonicallyIncreasingTime();
+
         Style::TreeResolver resolver(*this);
         resolver.resolve(change);
 
+        if (UNLIKELY(m_styleRecalcTracingEnabled))
+            recordStyleRecalcTraceEntry(resolver.resolvedElementCount(), monotonicallyIncreasingTime() - styleRecalcStartTime);
+
         updatedCompositingLayers = frameView.updateCompositingLayersAfterStyleChange();
 
         clearNeedsStyleRecalc();
@@ -2037,7 +2045,7 @@ bool Document::updateLayoutIfDimensionsOutOfDate(Element& element, DimensionsChe
     // layout.
     bool requireFullLayout = false;
     if (HTMLFrameOwnerElement* owner = ownerElement()) {
-        if (owner->document().updateLayoutIfDimensionsOutOfDate(*owner))
+        if (owner->document().updateLayoutIfDimensionsOutOfDate(*owner, dimensionsCheck))
             requireFullLayout = true;
     }
     
@@ -2079,6 +2087,15 @@ bool Document::updateLayoutIfDimensionsOutOfDate(Element& element, DimensionsChe
                 requireFullLayout = true;
                 break;
             }
+
+            // Dirty descendants of a box on the chain can't change this element's size, but laying
+            // them out can move it (later siblings get pushed, content gets re-centered, floats get
+            // replaced). Callers asking about position have to treat any dirt on the chain as
+            // affecting the answer.
+            if ((dimensionsCheck & PositionDimensionsCheck) && currentBox->needsLayout()) {
+                requireFullLayout = true;
+                break;
+            }
             
             // If a block contains floats and the child's height isn't specified, then
             // give up also, since our height could end up being influenced by the floats.
@@ -2106,10 +2123,14 @@ bool Document::updateLayoutIfDimensionsOutOfDate(Element& element, DimensionsChe
     
     StackStats::LayoutCheckPoint layoutCheckPoint;
 
-    // Only do a layout if changes have occurred that make it necessary.      
-    if (requireFullLayout && frameView && renderView() && (frameView->layoutPending() || renderView()->needsLayout()))
+    bool layoutIsNeeded = frameView && renderView() && (frameView->layoutPending() || renderView()->needsLayout());
+
+    // Only do a layout if changes have occurred that make it necessary.
+    if (requireFullLayout && layoutIsNeeded)
         frameView->layout();
-    
+    else if (layoutIsNeeded)
+        ++m_dimensionsCheckAvoidedLayoutCount;
+
     return requireFullLayout;
 }
 
@@ -6401,6 +6422,89 @@ unsigned Document::styleRecalcCount() const
     return m_styleRecalcCount;
 }
 
+void Document::setStyleRecalcTracingEnabled(bool enabled)
+{
+    m_styleRecalcTracingEnabled = enabled;
+    m_pendingStyleInvalidationCount = 0;
+    m_pendingStyleInvalidationTriggers.clear();
+    m_styleRecalcTrace.clear();
+}
+
+void Document::traceStyleInvalidation(const Node& node, StyleChangeType changeType)
+{
+    ASSERT(m_styleRecalcTracingEnabled);
+
+    ++m_pendingStyleInvalidationCount;
+
+    // Keep a bounded sample of trigger descriptions; in a storm the count is the
+    // interesting part and the first few triggers identify the call site well enough.
+    static const unsigned maxRecordedTriggersPerRecalc = 16;
+    if (m_pendingStyleInvalidationTriggers.size() >= maxRecordedTriggersPerRecalc)
+        return;
+
+    StringBuilder description;
+    description.append(node.nodeName());
+    if (is<Element>(node) && downcast<Element>(node).hasID()) {
+        description.append('#');
+        description.append(downcast<Element>(node).idForStyleResolution());
+    }
+    switch (changeType) {
+    case InlineStyleChange:
+        description.appendLiteral(" (inline)");
+        break;
+    case FullStyleChange:
+        description.appendLiteral(" (full)");
+        break;
+    case SyntheticStyleChange:
+        description.appendLiteral(" (synthetic)");
+        break;
+    case ReconstructRenderTree:
+        description.appendLiteral(" (reconstruct)");
+        break;
+    case NoStyleChange:
+        ASSERT_NOT_REACHED();
+        break;
+    }
+    m_pendingStyleInvalidationTriggers.append(description.toString());
+}
+
+void Document::recordStyleRecalcTraceEntry(unsigned elementsResolved, double durationInSeconds)
+{
+    static const unsigned styleRecalcTraceCapacity = 64;
+    if (m_styleRecalcTrace.size() >= styleRecalcTraceCapacity)
+        m_styleRecalcTrace.remove(0);
+
+    m_styleRecalcTrace.append({ WTFMove(m_pendingStyleInvalidationTriggers), m_pendingStyleInvalidationCount, elementsResolved, durationInSeconds });
+    m_pendingStyleInvalidationTriggers = Vector<String>();
+    m_pendingStyleInvalidationCount = 0;
+}
+
+String Document::styleRecalcTraceAsText() const
+{
+    StringBuilder result;
+    for (auto& entry : m_styleRecalcTrace) {
+        result.appendLiteral("recalc: ");
+        result.appendNumber(entry.invalidationCount);
+        result.appendLiteral(" invalidations, ");
+        result.appendNumber(entry.elementsResolved);
+        result.appendLiteral(" elements resolved, ");
+        result.append(String::number(entry.durationInSeconds * 1000));
+        result.appendLiteral(" ms");
+        if (!entry.triggers.isEmpty()) {
+            result.appendLiteral("; triggers: ");
+            for (size_t i = 0; i < entry.triggers.size(); ++i) {
+                if (i)
+                    result.appendLiteral(", ");
+                result.append(entry.triggers[i]);
+            }
+            if (entry.invalidationCount > entry.triggers.size())
+                result.appendLiteral(", ...");
+        }
+        result.append('\n');
+    }
+    return result.toString();
+}
+
 DocumentLoader* Document::loader() const
 {
     if (!m_frame)
@@ -274,7 +274,7 @@ enum class DocumentCompatibilityMode : unsigned char {
     LimitedQuirksMode = 1 << 2
 };
 
-enum DimensionsCheck { WidthDimensionsCheck = 1 << 0, HeightDimensionsCheck = 1 << 1, AllDimensionsCheck = 1 << 2 };
+enum DimensionsCheck { WidthDimensionsCheck = 1 << 0, HeightDimensionsCheck = 1 << 1, PositionDimensionsCheck = 1 << 2, AllDimensionsCheck = WidthDimensionsCheck | HeightDimensionsCheck | PositionDimensionsCheck };
 
 enum class SelectionRestorationMode {
     Restore,
@@ -1192,6 +1192,18 @@ public:
     WEBCORE_EXPORT void startTrackingStyleRecalcs();
     WEBCORE_EXPORT unsigned styleRecalcCount() const;
 
+    // Counts the geometry queries that updateLayoutIfDimensionsOutOfDate() answered
+    // from clean geometry while a layout was pending elsewhere in the document.
+    unsigned dimensionsCheckAvoidedLayoutCount() const { return m_dimensionsCheckAvoidedLayoutCount; }
+
+    // Opt-in restyle tracing: while enabled, each style recalc records which nodes
+    // scheduled it, how many invalidations arrived, how many elements the tree resolver
+    // visited and how long it took, into a small ring buffer for diagnosing restyle storms.
+    bool styleRecalcTracingEnabled() const { return m_styleRecalcTracingEnabled; }
+    WEBCORE_EXPORT void setStyleRecalcTracingEnabled(bool);
+    void traceStyleInvalidation(const Node&, StyleChangeType);
+    WEBCORE_EXPORT String styleRecalcTraceAsText() const;
+
     void didAddTouchEventHandler(Node&);
     void didRemoveTouchEventHandler(Node&, EventHandlerRemoval = EventHandlerRemoval::One);
 
@@ -1520,6 +1532,19 @@ private:
     unsigned m_ignoreOpensDuringUnloadCount { 0 };
 
     unsigned m_styleRecalcCount { 0 };
+    unsigned m_dimensionsCheckAvoidedLayoutCount { 0 };
+
+    struct StyleRecalcTraceEntry {
+        Vector<String> triggers;
+        unsigned invalidationCount;
+        unsigned elementsResolved;
+        double durationInSeconds;
+    };
+    void recordStyleRecalcTraceEntry(unsigned elementsResolved, double durationInSeconds);
+    bool m_styleRecalcTracingEnabled { false };
+    unsigned m_pendingStyleInvalidationCount { 0 };
+    Vector<String> m_pendingStyleInvalidationTriggers;
+    Vector<StyleRecalcTraceEntry> m_styleRecalcTrace;
 
     StringWithDirection m_title;
     StringWithDirection m_rawTitle;
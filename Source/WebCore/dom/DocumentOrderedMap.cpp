@@ -90,7 +90,15 @@ void DocumentOrderedMap::remove(const AtomicStringImpl& key, Element& element)
         if (entry.element == &element)
             entry.element = nullptr;
         entry.count--;
-        entry.orderedList.clear(); // FIXME: Remove the element instead if there are only few items left.
+        // Removing an element does not change the relative order of the remaining ones, so a
+        // previously built list stays valid and the next lookup stays O(count) instead of
+        // falling back to a tree walk.
+        if (!entry.orderedList.isEmpty()) {
+            entry.orderedList.removeFirst(&element);
+            ASSERT_WITH_SECURITY_IMPLICATION(entry.orderedList.size() == entry.count);
+            if (!entry.element && !entry.orderedList.isEmpty())
+                entry.element = entry.orderedList.first();
+        }
     }
 }
 
@@ -105,6 +113,11 @@ inline Element* DocumentOrderedMap::get(const AtomicStringImpl& key, const TreeS
 
     MapEntry& entry = it->value;
     ASSERT(entry.count);
+    if (!entry.element && !entry.orderedList.isEmpty()) {
+        // A complete ordered list survived the mutations that cleared the cached element;
+        // its first entry is the first match in document order.
+        entry.element = entry.orderedList.first();
+    }
     if (entry.element) {
         ASSERT_WITH_SECURITY_IMPLICATION(entry.element->isInTreeScope());
         ASSERT_WITH_SECURITY_IMPLICATION(&entry.element->treeScope() == &scope);
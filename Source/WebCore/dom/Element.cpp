@@ -1065,7 +1065,7 @@ LayoutRect Element::absoluteEventHandlerBounds(bool& includesFixedPositionElemen
 
 Ref<ClientRectList> Element::getClientRects()
 {
-    document().updateLayoutIgnorePendingStylesheets();
+    document().updateLayoutIfDimensionsOutOfDate(*this, AllDimensionsCheck);
 
     RenderBoxModelObject* renderBoxModelObject = this->renderBoxModelObject();
     if (!renderBoxModelObject)
@@ -1082,7 +1082,10 @@ Ref<ClientRectList> Element::getClientRects()
 
 Ref<ClientRect> Element::getBoundingClientRect()
 {
-    document().updateLayoutIgnorePendingStylesheets();
+    // Rect queries need the position to be up to date as well as the dimensions; the
+    // PositionDimensionsCheck bit makes any dirt on the containing block chain force a layout,
+    // so only queries whose dependency chain is clean skip it.
+    document().updateLayoutIfDimensionsOutOfDate(*this, AllDimensionsCheck);
 
     Vector<FloatQuad> quads;
     if (isSVGElement() && renderer() && !renderer()->isSVGRoot()) {
@@ -34,97 +34,60 @@
 
 namespace WebCore {
 
-EventContext::EventContext(PassRefPtr<Node> node, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target)
+EventContext::EventContext(Type type, PassRefPtr<Node> node, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target)
     : m_node(node)
     , m_currentTarget(currentTarget)
     , m_target(target)
+    , m_type(type)
 {
     ASSERT(m_node);
     ASSERT(!isUnreachableNode(m_target.get()));
-}
-
-EventContext::~EventContext()
-{
-}
-
-void EventContext::handleLocalEvents(Event& event) const
-{
-    event.setTarget(m_target.get());
-    event.setCurrentTarget(m_currentTarget.get());
-    m_node->handleLocalEvents(event);
-}
-
-bool EventContext::isMouseOrFocusEventContext() const
-{
-    return false;
-}
-
-bool EventContext::isTouchEventContext() const
-{
-    return false;
-}
-
-MouseOrFocusEventContext::MouseOrFocusEventContext(PassRefPtr<Node> node, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target)
-    : EventContext(node, currentTarget, target)
-{
-}
-
-MouseOrFocusEventContext::~MouseOrFocusEventContext()
-{
-}
-
-void MouseOrFocusEventContext::handleLocalEvents(Event& event) const
-{
-    ASSERT(is<MouseEvent>(event) || is<FocusEvent>(event));
-    if (m_relatedTarget) {
-        if (is<MouseEvent>(event))
-            downcast<MouseEvent>(event).setRelatedTarget(m_relatedTarget.get());
-        else if (is<FocusEvent>(event))
-            downcast<FocusEvent>(event).setRelatedTarget(m_relatedTarget.get());
+#if ENABLE(TOUCH_EVENTS)
+    if (m_type == Type::Touch) {
+        m_touches = TouchList::create();
+        m_targetTouches = TouchList::create();
+        m_changedTouches = TouchList::create();
     }
-    EventContext::handleLocalEvents(event);
+#endif
 }
 
-bool MouseOrFocusEventContext::isMouseOrFocusEventContext() const
+void EventContext::handleLocalEvents(Event& event) const
 {
-    return true;
-}
-
+    switch (m_type) {
+    case Type::Normal:
+        break;
+    case Type::MouseOrFocus:
+        ASSERT(is<MouseEvent>(event) || is<FocusEvent>(event));
+        if (m_relatedTarget) {
+            if (is<MouseEvent>(event))
+                downcast<MouseEvent>(event).setRelatedTarget(m_relatedTarget.get());
+            else if (is<FocusEvent>(event))
+                downcast<FocusEvent>(event).setRelatedTarget(m_relatedTarget.get());
+        }
+        break;
+    case Type::Touch:
 #if ENABLE(TOUCH_EVENTS)
-TouchEventContext::TouchEventContext(PassRefPtr<Node> node, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target)
-    : EventContext(node, currentTarget, target)
-    , m_touches(TouchList::create())
-    , m_targetTouches(TouchList::create())
-    , m_changedTouches(TouchList::create())
-{
-}
-
-TouchEventContext::~TouchEventContext()
-{
-}
-
-void TouchEventContext::handleLocalEvents(Event& event) const
-{
 #if !ASSERT_DISABLED
-    checkReachability(m_touches.get());
-    checkReachability(m_targetTouches.get());
-    checkReachability(m_changedTouches.get());
+        checkReachability(m_touches.get());
+        checkReachability(m_targetTouches.get());
+        checkReachability(m_changedTouches.get());
 #endif
-    ASSERT(is<TouchEvent>(event));
-    TouchEvent& touchEvent = downcast<TouchEvent>(event);
-    touchEvent.setTouches(m_touches.get());
-    touchEvent.setTargetTouches(m_targetTouches.get());
-    touchEvent.setChangedTouches(m_changedTouches.get());
-    EventContext::handleLocalEvents(event);
-}
-
-bool TouchEventContext::isTouchEventContext() const
-{
-    return true;
+        ASSERT(is<TouchEvent>(event));
+        downcast<TouchEvent>(event).setTouches(m_touches.get());
+        downcast<TouchEvent>(event).setTargetTouches(m_targetTouches.get());
+        downcast<TouchEvent>(event).setChangedTouches(m_changedTouches.get());
+#else
+        ASSERT_NOT_REACHED();
+#endif
+        break;
+    }
+    event.setTarget(m_target.get());
+    event.setCurrentTarget(m_currentTarget.get());
+    m_node->handleLocalEvents(event);
 }
 
-#if !ASSERT_DISABLED
-void TouchEventContext::checkReachability(TouchList* touchList) const
+#if ENABLE(TOUCH_EVENTS) && !ASSERT_DISABLED
+void EventContext::checkReachability(TouchList* touchList) const
 {
     size_t length = touchList->length();
     for (size_t i = 0; i < length; ++i)
@@ -132,6 +95,4 @@ void TouchEventContext::checkReachability(TouchList* touchList) const
 }
 #endif
 
-#endif // ENABLE(TOUCH_EVENTS) && !PLATFORM(IOS)
-
 }
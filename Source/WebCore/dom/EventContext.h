@@ -39,56 +39,31 @@ class Event;
 class TouchList;
 #endif
 
+// A single non-virtual class held by value in the event path so that building the path does not
+// heap-allocate a context per node. The type tag selects the extra per-event state to apply.
 class EventContext {
     WTF_MAKE_FAST_ALLOCATED;
 public:
+    enum class Type : uint8_t { Normal, MouseOrFocus, Touch };
+
     // FIXME: Use ContainerNode instead of Node.
-    EventContext(PassRefPtr<Node>, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target);
-    virtual ~EventContext();
+    EventContext(Type, PassRefPtr<Node>, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target);
 
     Node* node() const { return m_node.get(); }
     EventTarget* target() const { return m_target.get(); }
     bool currentTargetSameAsTarget() const { return m_currentTarget.get() == m_target.get(); }
-    virtual void handleLocalEvents(Event&) const;
-    virtual bool isMouseOrFocusEventContext() const;
-    virtual bool isTouchEventContext() const;
+    void handleLocalEvents(Event&) const;
+    bool isMouseOrFocusEventContext() const { return m_type == Type::MouseOrFocus; }
+    bool isTouchEventContext() const { return m_type == Type::Touch; }
 
-protected:
-#if !ASSERT_DISABLED
-    bool isUnreachableNode(EventTarget*);
-    bool isReachable(Node*) const;
-#endif
-    RefPtr<Node> m_node;
-    RefPtr<EventTarget> m_currentTarget;
-    RefPtr<EventTarget> m_target;
-};
-
-class MouseOrFocusEventContext final : public EventContext {
-public:
-    MouseOrFocusEventContext(PassRefPtr<Node>, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target);
-    virtual ~MouseOrFocusEventContext();
     EventTarget* relatedTarget() const { return m_relatedTarget.get(); }
     void setRelatedTarget(PassRefPtr<EventTarget>);
-    virtual void handleLocalEvents(Event&) const override;
-    virtual bool isMouseOrFocusEventContext() const override;
-
-private:
-    RefPtr<EventTarget> m_relatedTarget;
-};
-
 
 #if ENABLE(TOUCH_EVENTS)
-class TouchEventContext final : public EventContext {
-public:
-    TouchEventContext(PassRefPtr<Node>, PassRefPtr<EventTarget> currentTarget, PassRefPtr<EventTarget> target);
-    virtual ~TouchEventContext();
-
-    virtual void handleLocalEvents(Event&) const override;
-    virtual bool isTouchEventContext() const override;
-
     enum TouchListType { Touches, TargetTouches, ChangedTouches, NotTouchList };
     TouchList* touchList(TouchListType type)
     {
+        ASSERT(isTouchEventContext());
         switch (type) {
         case Touches:
             return m_touches.get();
@@ -106,29 +81,29 @@ public:
     TouchList* touches() { return m_touches.get(); }
     TouchList* targetTouches() { return m_targetTouches.get(); }
     TouchList* changedTouches() { return m_changedTouches.get(); }
+#endif
 
 private:
+#if !ASSERT_DISABLED
+    bool isUnreachableNode(EventTarget*);
+    bool isReachable(Node*) const;
+#endif
+#if ENABLE(TOUCH_EVENTS) && !ASSERT_DISABLED
+    void checkReachability(TouchList*) const;
+#endif
+
+    RefPtr<Node> m_node;
+    RefPtr<EventTarget> m_currentTarget;
+    RefPtr<EventTarget> m_target;
+    RefPtr<EventTarget> m_relatedTarget;
+#if ENABLE(TOUCH_EVENTS)
     RefPtr<TouchList> m_touches;
     RefPtr<TouchList> m_targetTouches;
     RefPtr<TouchList> m_changedTouches;
-#if !ASSERT_DISABLED
-    void checkReachability(TouchList*) const;
 #endif
+    Type m_type;
 };
 
-inline TouchEventContext& toTouchEventContext(EventContext& eventContext)
-{
-    ASSERT_WITH_SECURITY_IMPLICATION(eventContext.isTouchEventContext());
-    return static_cast<TouchEventContext&>(eventContext);
-}
-
-inline TouchEventContext* toTouchEventContext(EventContext* eventContext)
-{
-    ASSERT_WITH_SECURITY_IMPLICATION(!eventContext || eventContext->isTouchEventContext());
-    return static_cast<TouchEventContext*>(eventContext);
-}
-#endif // ENABLE(TOUCH_EVENTS) && !PLATFORM(IOS)
-
 #if !ASSERT_DISABLED
 inline bool EventContext::isUnreachableNode(EventTarget* target)
 {
@@ -148,22 +123,13 @@ inline bool EventContext::isReachable(Node* target) const
 }
 #endif
 
-inline void MouseOrFocusEventContext::setRelatedTarget(PassRefPtr<EventTarget> relatedTarget)
+inline void EventContext::setRelatedTarget(PassRefPtr<EventTarget> relatedTarget)
 {
+    ASSERT(isMouseOrFocusEventContext());
     ASSERT(!isUnreachableNode(relatedTarget.get()));
     m_relatedTarget = relatedTarget;
 }
 
 }
 
-SPECIALIZE_TYPE_TRAITS_BEGIN(WebCore::MouseOrFocusEventContext)
-static bool isType(const WebCore::EventContext& context) { return context.isMouseOrFocusEventContext(); }
-SPECIALIZE_TYPE_TRAITS_END()
-
-#if ENABLE(TOUCH_EVENTS)
-SPECIALIZE_TYPE_TRAITS_BEGIN(WebCore::TouchEventContext)
-static bool isType(const WebCore::EventContext& context) { return context.isTouchEventContext(); }
-SPECIALIZE_TYPE_TRAITS_END()
-#endif
-
 #endif // EventContext_h
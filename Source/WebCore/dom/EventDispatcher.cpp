@@ -83,8 +83,8 @@ public:
 
     bool isEmpty() const { return m_path.isEmpty(); }
     size_t size() const { return m_path.size(); }
-    const EventContext& contextAt(size_t i) const { return *m_path[i]; }
-    EventContext& contextAt(size_t i) { return *m_path[i]; }
+    const EventContext& contextAt(size_t i) const { return m_path[i]; }
+    EventContext& contextAt(size_t i) { return m_path[i]; }
 
 #if ENABLE(TOUCH_EVENTS)
     void retargetTouchLists(const TouchEvent&);
@@ -93,15 +93,15 @@ public:
 
     bool hasEventListeners(const AtomicString& eventType) const;
 
-    EventContext* lastContextIfExists() { return m_path.isEmpty() ? nullptr : m_path.last().get(); }
+    EventContext* lastContextIfExists() { return m_path.isEmpty() ? nullptr : &m_path.last(); }
 
 private:
 #if ENABLE(TOUCH_EVENTS)
-    void retargetTouch(TouchEventContext::TouchListType, const Touch&);
+    void retargetTouch(EventContext::TouchListType, const Touch&);
 #endif
 
     Event& m_event;
-    Vector<std::unique_ptr<EventContext>, 32> m_path;
+    Vector<EventContext, 32> m_path;
 };
 
 inline EventTarget* eventTargetRespectingTargetRules(Node& referenceNode)
@@ -305,13 +305,13 @@ EventPath::EventPath(Node& originalTarget, Event& event)
         for (; node; node = parent) {
             EventTarget* currentTarget = eventTargetRespectingTargetRules(*node);
             if (isMouseOrFocusEvent)
-                m_path.append(std::make_unique<MouseOrFocusEventContext>(node, currentTarget, target));
+                m_path.append(EventContext(EventContext::Type::MouseOrFocus, node, currentTarget, target));
 #if ENABLE(TOUCH_EVENTS)
             else if (isTouchEvent)
-                m_path.append(std::make_unique<TouchEventContext>(node, currentTarget, target));
+                m_path.append(EventContext(EventContext::Type::Touch, node, currentTarget, target));
 #endif
             else
-                m_path.append(std::make_unique<EventContext>(node, currentTarget, target));
+                m_path.append(EventContext(EventContext::Type::Normal, node, currentTarget, target));
             if (is<ShadowRoot>(*node))
                 break;
             parent = node->parentNode();
@@ -479,7 +479,7 @@ void EventPath::setRelatedTarget(Node& origin, EventTarget& relatedTarget)
     if (!relatedNode || m_path.isEmpty())
         return;
 
-    RelatedNodeRetargeter retargeter(*relatedNode, downcast<MouseOrFocusEventContext>(*m_path[0]).node()->treeScope());
+    RelatedNodeRetargeter retargeter(*relatedNode, m_path[0].node()->treeScope());
 
     bool originIsRelatedTarget = &origin == relatedNode;
     // FIXME: We should add a new flag on Event instead.
@@ -490,7 +490,8 @@ void EventPath::setRelatedTarget(Node& origin, EventTarget& relatedTarget)
     TreeScope* previousTreeScope = nullptr;
     size_t originalEventPathSize = m_path.size();
     for (unsigned contextIndex = 0; contextIndex < originalEventPathSize; contextIndex++) {
-        auto& context = downcast<MouseOrFocusEventContext>(*m_path[contextIndex]);
+        auto& context = m_path[contextIndex];
+        ASSERT(context.isMouseOrFocusEventContext());
 
         TreeScope& currentTreeScope = context.node()->treeScope();
         if (UNLIKELY(previousTreeScope && &currentTreeScope != previousTreeScope))
@@ -514,7 +515,7 @@ void EventPath::setRelatedTarget(Node& origin, EventTarget& relatedTarget)
 }
 
 #if ENABLE(TOUCH_EVENTS)
-void EventPath::retargetTouch(TouchEventContext::TouchListType touchListType, const Touch& touch)
+void EventPath::retargetTouch(EventContext::TouchListType touchListType, const Touch& touch)
 {
     EventTarget* eventTarget = touch.target();
     if (!eventTarget)
@@ -524,15 +525,16 @@ void EventPath::retargetTouch(TouchEventContext::TouchListType touchListType, co
     if (!targetNode)
         return;
 
-    RelatedNodeRetargeter retargeter(*targetNode, m_path[0]->node()->treeScope());
+    RelatedNodeRetargeter retargeter(*targetNode, m_path[0].node()->treeScope());
     TreeScope* previousTreeScope = nullptr;
     for (auto& context : m_path) {
-        TreeScope& currentTreeScope = context->node()->treeScope();
+        TreeScope& currentTreeScope = context.node()->treeScope();
         if (UNLIKELY(previousTreeScope && &currentTreeScope != previousTreeScope))
             retargeter.moveToNewTreeScope(previousTreeScope, currentTreeScope);
 
         Node* currentRelatedNode = retargeter.currentNode(currentTreeScope);
-        downcast<TouchEventContext>(*context).touchList(touchListType)->append(touch.cloneWithNewTarget(currentRelatedNode));
+        ASSERT(context.isTouchEventContext());
+        context.touchList(touchListType)->append(touch.cloneWithNewTarget(currentRelatedNode));
 
         previousTreeScope = &currentTreeScope;
     }
@@ -542,17 +544,17 @@ void EventPath::retargetTouchLists(const TouchEvent& touchEvent)
 {
     if (touchEvent.touches()) {
         for (size_t i = 0; i < touchEvent.touches()->length(); ++i)
-            retargetTouch(TouchEventContext::Touches, *touchEvent.touches()->item(i));
+            retargetTouch(EventContext::Touches, *touchEvent.touches()->item(i));
     }
 
     if (touchEvent.targetTouches()) {
         for (size_t i = 0; i < touchEvent.targetTouches()->length(); ++i)
-            retargetTouch(TouchEventContext::TargetTouches, *touchEvent.targetTouches()->item(i));
+            retargetTouch(EventContext::TargetTouches, *touchEvent.targetTouches()->item(i));
     }
 
     if (touchEvent.changedTouches()) {
         for (size_t i = 0; i < touchEvent.changedTouches()->length(); ++i)
-            retargetTouch(TouchEventContext::ChangedTouches, *touchEvent.changedTouches()->item(i));
+            retargetTouch(EventContext::ChangedTouches, *touchEvent.changedTouches()->item(i));
     }
 }
 #endif
@@ -560,7 +562,7 @@ void EventPath::retargetTouchLists(const TouchEvent& touchEvent)
 bool EventPath::hasEventListeners(const AtomicString& eventType) const
 {
     for (auto& eventPath : m_path) {
-        if (eventPath->node()->hasEventListeners(eventType))
+        if (eventPath.node()->hasEventListeners(eventType))
             return true;
     }
 
@@ -30,11 +30,24 @@
 #include "ShadowRoot.h"
 #include "StyleSheetContents.h"
 #include "TextNodeTraversal.h"
+#include <wtf/HashMap.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/text/StringBuilder.h>
 
 namespace WebCore {
 
+// Many pages repeat the exact same <style> text, frames of a multi-frame app especially.
+// Cache the parsed, immutable StyleSheetContents keyed by the text and reuse it when the
+// parser context matches; CSSOM mutation already copies shared contents in
+// CSSStyleSheet::willMutateRules, which treats the in-cache bit as "shared".
+static const unsigned maximumInlineStyleSheetCacheSize = 50;
+
+static HashMap<String, RefPtr<StyleSheetContents>>& inlineStyleSheetCache()
+{
+    static NeverDestroyed<HashMap<String, RefPtr<StyleSheetContents>>> cache;
+    return cache;
+}
+
 InlineStyleSheetOwner::InlineStyleSheetOwner(Document& document, bool createdByParser)
     : m_isParsingChildren(createdByParser)
     , m_loading(false)
@@ -151,6 +164,20 @@ void InlineStyleSheetOwner::createSheet(Element& element, const String& text)
 
     authorStyleSheetsForElement(element).addPendingSheet();
 
+    CSSParserContext parserContext(document, URL(), document.encoding());
+
+    if (RefPtr<StyleSheetContents> cachedContents = inlineStyleSheetCache().get(text)) {
+        if (cachedContents->parserContext() == parserContext) {
+            ASSERT(cachedContents->isCacheable());
+            m_sheet = CSSStyleSheet::createInline(cachedContents.releaseNonNull(), element, m_startTextPosition);
+            m_sheet->setMediaQueries(mediaQueries.release());
+            m_sheet->setTitle(element.title());
+            sheetLoaded(element);
+            element.notifyLoadedSheetAndAllCriticalSubresources(false);
+            return;
+        }
+    }
+
     m_loading = true;
 
     m_sheet = CSSStyleSheet::createInline(element, URL(), m_startTextPosition, document.encoding());
@@ -162,6 +189,20 @@ void InlineStyleSheetOwner::createSheet(Element& element, const String& text)
 
     if (m_sheet)
         m_sheet->contents().checkLoaded();
+
+    if (m_sheet && m_sheet->contents().isCacheable()) {
+        auto addResult = inlineStyleSheetCache().add(text, &m_sheet->contents());
+        if (addResult.isNewEntry) {
+            m_sheet->contents().addedToMemoryCache();
+
+            // Prevent unbounded growth.
+            if (inlineStyleSheetCache().size() > maximumInlineStyleSheetCacheSize) {
+                auto toRemove = inlineStyleSheetCache().begin();
+                toRemove->value->removedFromMemoryCache();
+                inlineStyleSheetCache().remove(toRemove);
+            }
+        }
+    }
 }
 
 bool InlineStyleSheetOwner::isLoading() const
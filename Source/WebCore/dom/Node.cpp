@@ -763,6 +763,9 @@ void Node::setNeedsStyleRecalc(StyleChangeType changeType)
     if (!inRenderedDocument())
         return;
 
+    if (UNLIKELY(document().styleRecalcTracingEnabled()))
+        document().traceStyleInvalidation(*this, changeType);
+
     StyleChangeType existingChangeType = styleChangeType();
     if (changeType > existingChangeType)
         setStyleChange(changeType);
@@ -823,6 +826,10 @@ void Document::invalidateNodeListAndCollectionCaches(const QualifiedName* attrNa
 #endif
 }
 
+// This runs for every node inserted or removed, but repeated calls during a burst of mutations
+// amortize to almost nothing: the document-level sets are emptied by the first call and only
+// repopulate when a list revalidates, and invalidating an already-invalid cached list or
+// collection is an early return.
 void Node::invalidateNodeListAndCollectionCachesInAncestors(const QualifiedName* attrName, Element* attributeOwnerElement)
 {
     if (hasRareData() && (!attrName || isAttributeNode())) {
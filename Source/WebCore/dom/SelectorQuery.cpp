@@ -203,6 +203,18 @@ static const CSSSelector* selectorForIdLookup(const ContainerNode& rootNode, con
     return nullptr;
 }
 
+static const CSSSelector* selectorForClassFilter(const CSSSelector& firstSelector)
+{
+    for (const CSSSelector* selector = &firstSelector; selector; selector = selector->tagHistory()) {
+        if (selector->match() == CSSSelector::Class)
+            return selector;
+        if (selector->relation() != CSSSelector::SubSelector)
+            break;
+    }
+
+    return nullptr;
+}
+
 static inline bool isTreeScopeRoot(const ContainerNode& node)
 {
     return node.isDocumentNode() || node.isShadowRoot();
@@ -369,6 +381,24 @@ ALWAYS_INLINE void SelectorDataList::executeSingleSelectorData(const ContainerNo
 {
     ASSERT(m_selectors.size() == 1);
 
+    // If the rightmost compound contains a class selector, any matching element must carry that
+    // class, so use it to reject non-candidates before setting up the full selector checker.
+    // Class matching is case-insensitive in quirks mode; only the checker handles that correctly.
+    const CSSSelector* classSelector = rootNode.document().inQuirksMode() ? nullptr : selectorForClassFilter(*selectorData.selector);
+    if (classSelector) {
+        const AtomicString& className = classSelector->value();
+        for (auto& element : elementDescendants(const_cast<ContainerNode&>(searchRootNode))) {
+            if (!element.hasClass() || !element.classNames().contains(className))
+                continue;
+            if (selectorMatches(selectorData, element, rootNode)) {
+                SelectorQueryTrait::appendOutputForElement(output, &element);
+                if (SelectorQueryTrait::shouldOnlyMatchFirstElement)
+                    return;
+            }
+        }
+        return;
+    }
+
     for (auto& element : elementDescendants(const_cast<ContainerNode&>(searchRootNode))) {
         if (selectorMatches(selectorData, element, rootNode)) {
             SelectorQueryTrait::appendOutputForElement(output, &element);
@@ -112,6 +112,8 @@ public:
 
     unsigned size() const { return m_data ? m_data->size() : 0; }
     bool isEmpty() const { return !m_data; }
+    // Token lists are deduplicated, so equal class attributes share one data object.
+    SpaceSplitStringData* data() const { return m_data.get(); }
     const AtomicString& operator[](unsigned i) const
     {
         ASSERT_WITH_SECURITY_IMPLICATION(m_data);
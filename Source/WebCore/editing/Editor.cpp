@@ -1017,24 +1017,67 @@ static void dispatchEditableContentChangedEvents(PassRefPtr<Element> prpStartRoo
         endRoot->dispatchEvent(Event::create(eventNames().webkitEditableContentChangedEvent, false, false));
 }
 
-void Editor::appliedEditing(PassRefPtr<CompositeEditCommand> cmd)
+Editor::BatchedEditingScope::BatchedEditingScope(Editor& editor)
+    : m_editor(editor)
+{
+    ++m_editor.m_batchedEditingDepth;
+}
+
+Editor::BatchedEditingScope::~BatchedEditingScope()
+{
+    ASSERT(m_editor.m_batchedEditingDepth);
+    if (!--m_editor.m_batchedEditingDepth)
+        m_editor.flushBatchedEditingNotifications();
+}
+
+void Editor::flushBatchedEditingNotifications()
 {
+    if (!m_hasDeferredEditingNotifications)
+        return;
+    m_hasDeferredEditingNotifications = false;
+
+    RefPtr<Element> startRoot = WTFMove(m_deferredNotificationStartingRootEditableElement);
+    RefPtr<Element> endRoot = WTFMove(m_deferredNotificationEndingRootEditableElement);
+
     document().updateLayout();
+    notifyTextFromControls(startRoot.get(), endRoot.get());
+    dispatchEditableContentChangedEvents(startRoot, endRoot);
+    updateEditorUINowIfScheduled();
+    respondToChangedContents(m_frame.selection().selection());
+}
+
+void Editor::appliedEditing(PassRefPtr<CompositeEditCommand> cmd)
+{
+    bool batching = isBatchingEditingCommands();
+    if (!batching)
+        document().updateLayout();
 
     EditCommandComposition* composition = cmd->composition();
     ASSERT(composition);
     VisibleSelection newSelection(cmd->endingSelection());
 
-    notifyTextFromControls(composition->startingRootEditableElement(), composition->endingRootEditableElement());
+    if (batching) {
+        // Inside a BatchedEditingScope, layout and the notifications below happen once when the
+        // outermost scope ends; only the edited roots need to be remembered here.
+        if (!m_hasDeferredEditingNotifications) {
+            m_hasDeferredEditingNotifications = true;
+            m_deferredNotificationStartingRootEditableElement = composition->startingRootEditableElement();
+        }
+        m_deferredNotificationEndingRootEditableElement = composition->endingRootEditableElement();
+    } else
+        notifyTextFromControls(composition->startingRootEditableElement(), composition->endingRootEditableElement());
 
     // Don't clear the typing style with this selection change.  We do those things elsewhere if necessary.
     FrameSelection::SetSelectionOptions options = cmd->isDictationCommand() ? FrameSelection::DictationTriggered : 0;
-    
+
     changeSelectionAfterCommand(newSelection, options, cmd->applyEditType());
-    dispatchEditableContentChangedEvents(composition->startingRootEditableElement(), composition->endingRootEditableElement());
 
-    updateEditorUINowIfScheduled();
-    
+    if (!batching) {
+        dispatchEditableContentChangedEvents(composition->startingRootEditableElement(), composition->endingRootEditableElement());
+
+        updateEditorUINowIfScheduled();
+    }
+
     m_alternativeTextController->respondToAppliedEditing(cmd.get());
 
     if (!cmd->preservesTypingStyle())
@@ -1051,7 +1094,8 @@ void Editor::appliedEditing(PassRefPtr<CompositeEditCommand> cmd)
             client()->registerUndoStep(m_lastEditCommand->ensureComposition());
     }
 
-    respondToChangedContents(newSelection);
+    if (!batching)
+        respondToChangedContents(newSelection);
 }
 
 void Editor::unappliedEditing(PassRefPtr<EditCommandComposition> cmd)
@@ -1175,6 +1219,10 @@ bool Editor::insertTextWithoutSendingTextEvent(const String& text, bool selectIn
         if (Node* selectionStart = selection.start().deprecatedNode()) {
             Ref<Document> document(selectionStart->document());
 
+            // Multi-line text inserts one command per line; batch them so layout and editor
+            // notifications happen once for the whole insertion.
+            BatchedEditingScope batchedEditingScope(*this);
+
             // Insert the text
             if (triggeringEvent && triggeringEvent->isDictation())
                 DictationCommand::insertText(document, text, triggeringEvent->dictationAlternatives(), selection);
@@ -1703,6 +1751,10 @@ void Editor::setComposition(const String& text, SetCompositionMode mode)
     ASSERT(mode == ConfirmComposition || mode == CancelComposition);
     UserTypingGestureIndicator typingGestureIndicator(m_frame);
 
+    // Confirming a composition can delete the old composition and insert the new text as
+    // separate command runs; batch them so layout and editor notifications happen once.
+    BatchedEditingScope batchedEditingScope(*this);
+
     setIgnoreCompositionSelectionChange(true);
 
     if (mode == CancelComposition)
@@ -1745,6 +1797,11 @@ void Editor::setComposition(const String& text, const Vector<CompositionUnderlin
 {
     UserTypingGestureIndicator typingGestureIndicator(m_frame);
 
+    // A composition update deletes the old composition text and inserts the new text through
+    // the full editing machinery; batching keeps that to one layout and one round of editor
+    // notifications per update so fast typing through an IME doesn't fall behind.
+    BatchedEditingScope batchedEditingScope(*this);
+
     setIgnoreCompositionSelectionChange(true);
 
     // Updates styles before setting selection for composition to prevent
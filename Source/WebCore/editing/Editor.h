@@ -59,6 +59,7 @@ class EditCommand;
 class EditCommandComposition;
 class EditorClient;
 class EditorInternalCommand;
+class Element;
 class Frame;
 class HTMLElement;
 class HitTestResult;
@@ -194,6 +195,20 @@ public:
     void appliedEditing(PassRefPtr<CompositeEditCommand>);
     void unappliedEditing(PassRefPtr<EditCommandComposition>);
     void reappliedEditing(PassRefPtr<EditCommandComposition>);
+
+    // Defers the per-command layout, content-changed notifications and editor UI update that
+    // appliedEditing performs until the outermost scope ends, so an editing operation that
+    // applies a run of commands in one event-loop turn (an IME composition update, multi-line
+    // text insertion) pays for that machinery once. Undo is unaffected: an open typing run
+    // already coalesces into a single EditCommandComposition.
+    class BatchedEditingScope {
+    public:
+        WEBCORE_EXPORT explicit BatchedEditingScope(Editor&);
+        WEBCORE_EXPORT ~BatchedEditingScope();
+    private:
+        Editor& m_editor;
+    };
+    bool isBatchingEditingCommands() const { return m_batchedEditingDepth; }
     void unappliedSpellCorrection(const VisibleSelection& selectionOfCorrected, const String& corrected, const String& correction);
 
     void setShouldStyleWithCSS(bool flag) { m_shouldStyleWithCSS = flag; }
@@ -464,6 +479,8 @@ private:
 
     Document& document() const;
 
+    void flushBatchedEditingNotifications();
+
     bool canDeleteRange(Range*) const;
     bool canSmartReplaceWithPasteboard(Pasteboard&);
     void pasteAsPlainTextWithPasteboard(Pasteboard&);
@@ -516,6 +533,11 @@ private:
     EditorParagraphSeparator m_defaultParagraphSeparator;
     bool m_overwriteModeEnabled;
 
+    unsigned m_batchedEditingDepth { 0 };
+    bool m_hasDeferredEditingNotifications { false };
+    RefPtr<Element> m_deferredNotificationStartingRootEditableElement;
+    RefPtr<Element> m_deferredNotificationEndingRootEditableElement;
+
     VisibleSelection m_oldSelectionForEditorUIUpdate;
     Timer m_editorUIUpdateTimer;
     bool m_editorUIUpdateTimerShouldCheckSpellingAndGrammar;
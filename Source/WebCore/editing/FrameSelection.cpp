@@ -51,6 +51,7 @@
 #include "HitTestRequest.h"
 #include "HitTestResult.h"
 #include "InlineTextBox.h"
+#include "MainFrame.h"
 #include "Page.h"
 #include "RenderText.h"
 #include "RenderTextControl.h"
@@ -58,6 +59,7 @@
 #include "RenderView.h"
 #include "RenderWidget.h"
 #include "RenderedPosition.h"
+#include "SelectionOverlayController.h"
 #include "Settings.h"
 #include "SpatialNavigation.h"
 #include "StyleProperties.h"
@@ -2064,30 +2066,43 @@ void FrameSelection::updateAppearance()
     VisibleSelection selection(oldSelection.visibleStart(), oldSelection.visibleEnd());
 #endif
 
+    // When the highlight is composited into an overlay, selection changes must not repaint the
+    // content underneath; the render tree selection state is still maintained for selection-only
+    // painting (drag images) and bounds queries.
+    bool highlightIsComposited = m_frame->settings().compositedSelectionHighlightEnabled();
+
     if (!selection.isRange()) {
-        view->clearSelection();
-        return;
+        if (highlightIsComposited)
+            view->setSelection(nullptr, -1, nullptr, -1, RenderView::RepaintNothing);
+        else
+            view->clearSelection();
+    } else {
+        // Use the rightmost candidate for the start of the selection, and the leftmost candidate for the end of the selection.
+        // Example: foo <a>bar</a>.  Imagine that a line wrap occurs after 'foo', and that 'bar' is selected.   If we pass [foo, 3]
+        // as the start of the selection, the selection painting code will think that content on the line containing 'foo' is selected
+        // and will fill the gap before 'bar'.
+        Position startPos = selection.start();
+        Position candidate = startPos.downstream();
+        if (candidate.isCandidate())
+            startPos = candidate;
+        Position endPos = selection.end();
+        candidate = endPos.upstream();
+        if (candidate.isCandidate())
+            endPos = candidate;
+
+        // We can get into a state where the selection endpoints map to the same VisiblePosition when a selection is deleted
+        // because we don't yet notify the FrameSelection of text removal.
+        if (startPos.isNotNull() && endPos.isNotNull() && selection.visibleStart() != selection.visibleEnd()) {
+            RenderObject* startRenderer = startPos.deprecatedNode()->renderer();
+            RenderObject* endRenderer = endPos.deprecatedNode()->renderer();
+            view->setSelection(startRenderer, startPos.deprecatedEditingOffset(), endRenderer, endPos.deprecatedEditingOffset(),
+                highlightIsComposited ? RenderView::RepaintNothing : RenderView::RepaintNewXOROld);
+        }
     }
 
-    // Use the rightmost candidate for the start of the selection, and the leftmost candidate for the end of the selection.
-    // Example: foo <a>bar</a>.  Imagine that a line wrap occurs after 'foo', and that 'bar' is selected.   If we pass [foo, 3]
-    // as the start of the selection, the selection painting code will think that content on the line containing 'foo' is selected
-    // and will fill the gap before 'bar'.
-    Position startPos = selection.start();
-    Position candidate = startPos.downstream();
-    if (candidate.isCandidate())
-        startPos = candidate;
-    Position endPos = selection.end();
-    candidate = endPos.upstream();
-    if (candidate.isCandidate())
-        endPos = candidate;
-
-    // We can get into a state where the selection endpoints map to the same VisiblePosition when a selection is deleted
-    // because we don't yet notify the FrameSelection of text removal.
-    if (startPos.isNotNull() && endPos.isNotNull() && selection.visibleStart() != selection.visibleEnd()) {
-        RenderObject* startRenderer = startPos.deprecatedNode()->renderer();
-        RenderObject* endRenderer = endPos.deprecatedNode()->renderer();
-        view->setSelection(startRenderer, startPos.deprecatedEditingOffset(), endRenderer, endPos.deprecatedEditingOffset());
+    if (highlightIsComposited) {
+        if (Page* page = m_frame->page())
+            page->mainFrame().selectionOverlayController().selectionDidChange(*m_frame);
     }
 }
 
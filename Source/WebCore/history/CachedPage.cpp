@@ -74,7 +74,11 @@ void CachedPage::restore(Page& page)
     ASSERT(m_cachedMainFrame->view()->frame().isMainFrame());
     ASSERT(!page.subframeCount());
 
-    page.setNeedsRecalcStyleInAllFrames();
+    // A full style recalc is only needed if something that feeds style resolution changed while
+    // the page sat in the cache; whatever changed is responsible for marking the cached pages it
+    // affects. The common restore, where nothing changed, keeps the cached render tree as is.
+    if (m_needsFullStyleRecalc)
+        page.setNeedsRecalcStyleInAllFrames();
 
     m_cachedMainFrame->open();
     
@@ -128,6 +132,7 @@ void CachedPage::clear()
 #endif
     m_needsDeviceOrPageScaleChanged = false;
     m_needsUpdateContentsSize = false;
+    m_needsFullStyleRecalc = false;
 }
 
 bool CachedPage::hasExpired() const
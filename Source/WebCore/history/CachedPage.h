@@ -56,6 +56,8 @@ public:
 
     void markForDeviceOrPageScaleChanged() { m_needsDeviceOrPageScaleChanged = true; }
 
+    void markForFullStyleRecalc() { m_needsFullStyleRecalc = true; }
+
     void markForContentsSizeChanged() { m_needsUpdateContentsSize = true; }
 
 private:
@@ -66,6 +68,7 @@ private:
 #endif
     bool m_needsDeviceOrPageScaleChanged { false };
     bool m_needsUpdateContentsSize { false };
+    bool m_needsFullStyleRecalc { false };
 };
 
 } // namespace WebCore
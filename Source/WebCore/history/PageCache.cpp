@@ -330,6 +330,15 @@ void PageCache::markPagesForContentsSizeChanged(Page& page)
     }
 }
 
+void PageCache::markPagesForFullStyleRecalc(Page& page)
+{
+    for (auto& item : m_items) {
+        CachedPage& cachedPage = *item->m_cachedPage;
+        if (&page.mainFrame() == &cachedPage.cachedMainFrame()->view()->frame())
+            cachedPage.markForFullStyleRecalc();
+    }
+}
+
 #if ENABLE(VIDEO_TRACK)
 void PageCache::markPagesForCaptionPreferencesChanged()
 {
@@ -54,6 +54,8 @@ LinkRelAttribute::LinkRelAttribute(const String& rel)
 #endif
     else if (equalLettersIgnoringASCIICase(rel, "dns-prefetch"))
         isDNSPrefetch = true;
+    else if (equalLettersIgnoringASCIICase(rel, "preconnect"))
+        isPreconnect = true;
     else if (equalLettersIgnoringASCIICase(rel, "alternate stylesheet") || equalLettersIgnoringASCIICase(rel, "stylesheet alternate")) {
         isStyleSheet = true;
         isAlternate = true;
@@ -70,6 +72,8 @@ LinkRelAttribute::LinkRelAttribute(const String& rel)
                 isAlternate = true;
             else if (equalLettersIgnoringASCIICase(word, "icon"))
                 iconType = Favicon;
+            else if (equalLettersIgnoringASCIICase(word, "preconnect"))
+                isPreconnect = true;
 #if ENABLE(TOUCH_ICON_LOADING)
             else if (equalLettersIgnoringASCIICase(word, "apple-touch-icon"))
                 iconType = TouchIcon;
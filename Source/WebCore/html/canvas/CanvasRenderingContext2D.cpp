@@ -2085,6 +2085,11 @@ RefPtr<ImageData> CanvasRenderingContext2D::getImageData(ImageBuffer::Coordinate
         return nullptr;
 
     IntRect imageDataRect = enclosingIntRect(logicalRect);
+
+    // When drawing is being recorded into a display list, the buffer only reflects what has
+    // been replayed so far; rasterize the pending operations before reading pixels back.
+    canvas()->makeRenderingResultsAvailable();
+
     ImageBuffer* buffer = canvas()->buffer();
     if (!buffer)
         return createEmptyImageData(imageDataRect.size());
@@ -2158,6 +2163,10 @@ void CanvasRenderingContext2D::putImageData(ImageData* data, ImageBuffer::Coordi
         return;
     }
 
+    // Pixels are written straight into the buffer, so any recorded but not yet replayed
+    // operations have to be rasterized first or they would replay on top of these pixels.
+    canvas()->makeRenderingResultsAvailable();
+
     ImageBuffer* buffer = canvas()->buffer();
     if (!buffer)
         return;
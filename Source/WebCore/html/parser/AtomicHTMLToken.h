@@ -27,6 +27,7 @@
 #ifndef AtomicHTMLToken_h
 #define AtomicHTMLToken_h
 
+#include "HTMLNames.h"
 #include "HTMLToken.h"
 
 namespace WebCore {
@@ -170,6 +171,148 @@ inline String AtomicHTMLToken::systemIdentifier() const
     return StringImpl::create8BitIfPossible(m_doctypeData->systemIdentifier);
 }
 
+template<unsigned charactersCount>
+ALWAYS_INLINE bool tagNameMatches(const HTMLToken::DataVector& name, const char (&characters)[charactersCount])
+{
+    for (unsigned i = 0; i < charactersCount - 1; ++i) {
+        if (name[i] != characters[i])
+            return false;
+    }
+    return true;
+}
+
+// The tokenizer hands us the same small set of tag names over and over. Matching
+// the name against the static atoms in HTMLNames by direct character comparison
+// returns the existing AtomicString without computing a hash or probing the atom
+// table. The tokenizer has already lowercased tag names, so a plain comparison is
+// enough. Anything we don't recognize falls back to ordinary atomization.
+inline const AtomicString* findKnownTagName(const HTMLToken::DataVector& name)
+{
+    using namespace HTMLNames;
+
+    switch (name.size()) {
+    case 1:
+        if (tagNameMatches(name, "a"))
+            return &aTag.localName();
+        if (tagNameMatches(name, "p"))
+            return &pTag.localName();
+        if (tagNameMatches(name, "b"))
+            return &bTag.localName();
+        if (tagNameMatches(name, "i"))
+            return &iTag.localName();
+        break;
+    case 2:
+        if (tagNameMatches(name, "li"))
+            return &liTag.localName();
+        if (tagNameMatches(name, "td"))
+            return &tdTag.localName();
+        if (tagNameMatches(name, "tr"))
+            return &trTag.localName();
+        if (tagNameMatches(name, "br"))
+            return &brTag.localName();
+        if (tagNameMatches(name, "ul"))
+            return &ulTag.localName();
+        if (tagNameMatches(name, "ol"))
+            return &olTag.localName();
+        if (tagNameMatches(name, "th"))
+            return &thTag.localName();
+        if (tagNameMatches(name, "em"))
+            return &emTag.localName();
+        if (tagNameMatches(name, "h1"))
+            return &h1Tag.localName();
+        if (tagNameMatches(name, "h2"))
+            return &h2Tag.localName();
+        if (tagNameMatches(name, "h3"))
+            return &h3Tag.localName();
+        if (tagNameMatches(name, "h4"))
+            return &h4Tag.localName();
+        if (tagNameMatches(name, "h5"))
+            return &h5Tag.localName();
+        if (tagNameMatches(name, "h6"))
+            return &h6Tag.localName();
+        if (tagNameMatches(name, "hr"))
+            return &hrTag.localName();
+        if (tagNameMatches(name, "dd"))
+            return &ddTag.localName();
+        if (tagNameMatches(name, "dt"))
+            return &dtTag.localName();
+        if (tagNameMatches(name, "dl"))
+            return &dlTag.localName();
+        break;
+    case 3:
+        if (tagNameMatches(name, "div"))
+            return &divTag.localName();
+        if (tagNameMatches(name, "img"))
+            return &imgTag.localName();
+        if (tagNameMatches(name, "nav"))
+            return &navTag.localName();
+        if (tagNameMatches(name, "pre"))
+            return &preTag.localName();
+        break;
+    case 4:
+        if (tagNameMatches(name, "span"))
+            return &spanTag.localName();
+        if (tagNameMatches(name, "body"))
+            return &bodyTag.localName();
+        if (tagNameMatches(name, "form"))
+            return &formTag.localName();
+        if (tagNameMatches(name, "head"))
+            return &headTag.localName();
+        if (tagNameMatches(name, "html"))
+            return &htmlTag.localName();
+        if (tagNameMatches(name, "link"))
+            return &linkTag.localName();
+        if (tagNameMatches(name, "main"))
+            return &mainTag.localName();
+        if (tagNameMatches(name, "meta"))
+            return &metaTag.localName();
+        break;
+    case 5:
+        if (tagNameMatches(name, "input"))
+            return &inputTag.localName();
+        if (tagNameMatches(name, "table"))
+            return &tableTag.localName();
+        if (tagNameMatches(name, "tbody"))
+            return &tbodyTag.localName();
+        if (tagNameMatches(name, "thead"))
+            return &theadTag.localName();
+        if (tagNameMatches(name, "style"))
+            return &styleTag.localName();
+        if (tagNameMatches(name, "label"))
+            return &labelTag.localName();
+        break;
+    case 6:
+        if (tagNameMatches(name, "script"))
+            return &scriptTag.localName();
+        if (tagNameMatches(name, "strong"))
+            return &strongTag.localName();
+        if (tagNameMatches(name, "button"))
+            return &buttonTag.localName();
+        if (tagNameMatches(name, "select"))
+            return &selectTag.localName();
+        if (tagNameMatches(name, "option"))
+            return &optionTag.localName();
+        if (tagNameMatches(name, "iframe"))
+            return &iframeTag.localName();
+        if (tagNameMatches(name, "header"))
+            return &headerTag.localName();
+        if (tagNameMatches(name, "footer"))
+            return &footerTag.localName();
+        if (tagNameMatches(name, "source"))
+            return &sourceTag.localName();
+        break;
+    case 8:
+        if (tagNameMatches(name, "noscript"))
+            return &noscriptTag.localName();
+        if (tagNameMatches(name, "textarea"))
+            return &textareaTag.localName();
+        break;
+    default:
+        break;
+    }
+    return nullptr;
+}
+
 inline Attribute* findAttribute(Vector<Attribute>& attributes, const QualifiedName& name)
 {
     for (auto& attribute : attributes) {
@@ -185,6 +328,8 @@ inline void AtomicHTMLToken::initializeAttributes(const HTMLToken::AttributeList
     if (!size)
         return;
 
+    // Attribute names and values are atomized directly from the tokenizer's inline buffers;
+    // no intermediate String is created for them.
     m_attributes.reserveInitialCapacity(size);
     for (auto& attribute : attributes) {
         if (attribute.name.isEmpty())
@@ -214,7 +359,10 @@ inline AtomicHTMLToken::AtomicHTMLToken(HTMLToken& token)
     case HTMLToken::StartTag:
     case HTMLToken::EndTag:
         m_selfClosing = token.selfClosing();
-        m_name = AtomicString(token.name());
+        if (const AtomicString* knownName = findKnownTagName(token.name()))
+            m_name = *knownName;
+        else
+            m_name = AtomicString(token.name());
         initializeAttributes(token.attributes());
         return;
     case HTMLToken::Comment:
@@ -279,6 +279,11 @@ void HTMLDocumentParser::pumpTokenizer(SynchronousMode mode)
     if (session.needsYield)
         m_parserScheduler->scheduleForResume();
 
+    // While a script blocks the parser, the preload scanner is our only form of lookahead.
+    // It re-tokenizes the pending input once the script completes, but unlike real speculative
+    // tokenization it needs no rollback: the executing script can change tokenizer state via
+    // document.write() (e.g. by opening a <plaintext> or <script> section), so any tokens
+    // produced ahead of the tree builder could be invalid and would have to be thrown away.
     if (isWaitingForScripts()) {
         ASSERT(m_tokenizer.isInDataState());
         if (!m_preloadScanner) {
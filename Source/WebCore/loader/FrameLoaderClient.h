@@ -354,6 +354,10 @@ namespace WebCore {
 
         virtual void prefetchDNS(const String&) = 0;
 
+        // rel=preconnect wants a warm connection to the origin. Ports with a connection
+        // pool can override this; LinkLoader warms the DNS cache in any case.
+        virtual void preconnectTo(const URL&) { }
+
         virtual void didRestoreScrollPosition() { }
     };
 
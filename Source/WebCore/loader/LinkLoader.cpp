@@ -101,6 +101,19 @@ bool LinkLoader::loadLink(const LinkRelAttribute& relAttribute, const URL& href,
             document.frame()->loader().client().prefetchDNS(href.host());
     }
 
+    if (relAttribute.isPreconnect && href.isValid() && href.protocolIsInHTTPFamily() && document.frame()) {
+        Settings* settings = document.settings();
+        // Speculative connections reveal the same information as speculative DNS
+        // lookups, so they share the dns-prefetch privacy switch.
+        if (settings && settings->dnsPrefetchingEnabled()) {
+            Frame* frame = document.frame();
+            frame->loader().client().preconnectTo(href);
+            // Ports without a connection pool ignore the hook above; resolving the
+            // host early is still most of the win, so always warm the DNS cache.
+            frame->loader().client().prefetchDNS(href.host());
+        }
+    }
+
 #if ENABLE(LINK_PREFETCH)
     if ((relAttribute.isLinkPrefetch || relAttribute.isLinkSubresource) && href.isValid() && document.frame()) {
         if (!m_client.shouldLoadLink())
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ResourcePrefetcher.h"
+
+#include "CachedResourceLoader.h"
+#include "CachedResourceRequest.h"
+#include "Document.h"
+#include "MainFrame.h"
+#include "Page.h"
+
+namespace WebCore {
+
+ResourcePrefetcher::ResourcePrefetcher(Page& page)
+    : m_page(page)
+{
+}
+
+ResourcePrefetcher::~ResourcePrefetcher()
+{
+    stop();
+}
+
+void ResourcePrefetcher::prefetch(Vector<URL>&& urls, uint64_t byteBudget)
+{
+    // A new list supersedes whatever is still pending: the application's latest guess
+    // about the next navigation is the best one.
+    stop();
+
+    for (auto& url : urls) {
+        if (url.isValid() && url.protocolIsInHTTPFamily())
+            m_queue.append(WTFMove(url));
+    }
+    m_byteBudget = byteBudget;
+    m_bytesFetched = 0;
+    requestNextResource();
+}
+
+void ResourcePrefetcher::stop()
+{
+    m_queue.clear();
+    if (m_currentResource) {
+        m_currentResource->removeClient(this);
+        m_currentResource = nullptr;
+    }
+}
+
+void ResourcePrefetcher::notifyFinished(CachedResource* resource)
+{
+    ASSERT_UNUSED(resource, m_currentResource.get() == resource);
+
+    m_bytesFetched += m_currentResource->encodedSize();
+    m_currentResource->removeClient(this);
+    m_currentResource = nullptr;
+    requestNextResource();
+}
+
+void ResourcePrefetcher::requestNextResource()
+{
+#if ENABLE(LINK_PREFETCH)
+    Document* document = m_page.mainFrame().document();
+    if (!document) {
+        m_queue.clear();
+        return;
+    }
+
+    while (!m_queue.isEmpty()) {
+        if (m_byteBudget && m_bytesFetched >= m_byteBudget) {
+            m_queue.clear();
+            return;
+        }
+
+        // The list arrived in priority order, so fetching strictly one at a time both
+        // honors the ordering and keeps prefetch traffic out of the way: VeryLow
+        // requests queue behind every load the page itself issues.
+        CachedResourceRequest request(ResourceRequest(m_queue.takeFirst()), ResourceLoadPriority::VeryLow);
+        m_currentResource = document->cachedResourceLoader().requestLinkResource(CachedResource::LinkPrefetch, request);
+        if (!m_currentResource)
+            continue;
+        m_currentResource->addClient(this);
+        return;
+    }
+#else
+    m_queue.clear();
+#endif
+}
+
+} // namespace WebCore
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ResourcePrefetcher_h
+#define ResourcePrefetcher_h
+
+#include "CachedResourceClient.h"
+#include "CachedResourceHandle.h"
+#include "URL.h"
+#include <wtf/Deque.h>
+
+namespace WebCore {
+
+class Page;
+
+// Application-driven prefetching: the embedder hands us the URLs it expects the next
+// navigation to need, in priority order, and we pull them into the memory and network
+// caches one at a time at the lowest network priority.
+class ResourcePrefetcher final : private CachedResourceClient {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    explicit ResourcePrefetcher(Page&);
+    virtual ~ResourcePrefetcher();
+
+    // A byte budget of 0 means unlimited. A new call replaces any pending prefetches.
+    void prefetch(Vector<URL>&&, uint64_t byteBudget);
+    void stop();
+
+private:
+    virtual void notifyFinished(CachedResource*) override;
+    void requestNextResource();
+
+    Page& m_page;
+    Deque<URL> m_queue;
+    CachedResourceHandle<CachedResource> m_currentResource;
+    uint64_t m_byteBudget { 0 };
+    uint64_t m_bytesFetched { 0 };
+};
+
+} // namespace WebCore
+
+#endif // ResourcePrefetcher_h
@@ -62,6 +62,7 @@ CachedImage::CachedImage(const ResourceRequest& resourceRequest, SessionID sessi
     , m_image(nullptr)
     , m_isManuallyCached(false)
     , m_shouldPaintBrokenImage(true)
+    , m_incrementalNotificationTimer(*this, &CachedImage::incrementalNotificationTimerFired)
 {
     setStatus(Unknown);
 }
@@ -71,6 +72,7 @@ CachedImage::CachedImage(Image* image, SessionID sessionID)
     , m_image(image)
     , m_isManuallyCached(false)
     , m_shouldPaintBrokenImage(true)
+    , m_incrementalNotificationTimer(*this, &CachedImage::incrementalNotificationTimerFired)
 {
     setStatus(Cached);
     setLoading(false);
@@ -81,6 +83,7 @@ CachedImage::CachedImage(const URL& url, Image* image, SessionID sessionID)
     , m_image(image)
     , m_isManuallyCached(false)
     , m_shouldPaintBrokenImage(true)
+    , m_incrementalNotificationTimer(*this, &CachedImage::incrementalNotificationTimerFired)
 {
     setStatus(Cached);
     setLoading(false);
@@ -91,6 +94,7 @@ CachedImage::CachedImage(const URL& url, Image* image, CachedImage::CacheBehavio
     , m_image(image)
     , m_isManuallyCached(type == CachedImage::ManuallyCached)
     , m_shouldPaintBrokenImage(true)
+    , m_incrementalNotificationTimer(*this, &CachedImage::incrementalNotificationTimerFired)
 {
     setStatus(Cached);
     setLoading(false);
@@ -394,11 +398,35 @@ void CachedImage::addIncrementalDataBuffer(SharedBuffer& data)
     // Each chunk from the network causes observers to repaint, which will force that chunk to decode.
     // It would be nice to only redraw the decoded band of the image, but with the current design
     // (decoding delayed until painting) that seems hard.
-    notifyObservers();
+    notifyObserversForIncrementalUpdate();
 
     setEncodedSize(m_image->data() ? m_image->data()->size() : 0);
 }
 
+void CachedImage::notifyObserversForIncrementalUpdate()
+{
+    // Every repaint of a partially loaded progressive image decodes all the passes
+    // received so far, so notifying on each network chunk multiplies the decode cost.
+    // Rate-limit the notifications; finishLoading() still notifies immediately.
+    static const double incrementalNotificationIntervalSeconds = 0.1;
+
+    double timeSinceLastNotification = monotonicallyIncreasingTime() - m_lastIncrementalNotificationTime;
+    if (timeSinceLastNotification >= incrementalNotificationIntervalSeconds) {
+        m_incrementalNotificationTimer.stop();
+        m_lastIncrementalNotificationTime = monotonicallyIncreasingTime();
+        notifyObservers();
+        return;
+    }
+    if (!m_incrementalNotificationTimer.isActive())
+        m_incrementalNotificationTimer.startOneShot(incrementalNotificationIntervalSeconds - timeSinceLastNotification);
+}
+
+void CachedImage::incrementalNotificationTimerFired()
+{
+    m_lastIncrementalNotificationTime = monotonicallyIncreasingTime();
+    notifyObservers();
+}
+
 void CachedImage::addDataBuffer(SharedBuffer& data)
 {
     ASSERT(dataBufferingPolicy() == BufferData);
@@ -415,6 +443,7 @@ void CachedImage::addData(const char* data, unsigned length)
 
 void CachedImage::finishLoading(SharedBuffer* data)
 {
+    m_incrementalNotificationTimer.stop();
     m_data = data;
     if (!m_image && data)
         createImage();
@@ -448,6 +477,7 @@ void CachedImage::didReplaceSharedBufferContents()
 
 void CachedImage::error(CachedResource::Status status)
 {
+    m_incrementalNotificationTimer.stop();
     checkShouldPaintBrokenImage();
     clear();
     CachedResource::error(status);
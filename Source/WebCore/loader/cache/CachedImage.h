@@ -30,6 +30,7 @@
 #include "IntSizeHash.h"
 #include "LayoutSize.h"
 #include "SVGImageCache.h"
+#include "Timer.h"
 #include <wtf/HashMap.h>
 #include <wtf/Vector.h>
 
@@ -125,6 +126,9 @@ private:
 
     void addIncrementalDataBuffer(SharedBuffer&);
 
+    void notifyObserversForIncrementalUpdate();
+    void incrementalNotificationTimerFired();
+
     void didReplaceSharedBufferContents() override;
 
     typedef std::pair<LayoutSize, float> SizeAndZoom;
@@ -133,6 +137,8 @@ private:
 
     RefPtr<Image> m_image;
     std::unique_ptr<SVGImageCache> m_svgImageCache;
+    Timer m_incrementalNotificationTimer;
+    double m_lastIncrementalNotificationTime { 0 };
     unsigned m_isManuallyCached : 1;
     unsigned m_shouldPaintBrokenImage : 1;
 };
@@ -37,6 +37,7 @@
 #include "SharedBuffer.h"
 #include "TextResourceDecoder.h"
 #include <wtf/Vector.h>
+#include <wtf/text/StringBuilder.h>
 
 namespace WebCore {
 
@@ -69,6 +70,20 @@ String CachedScript::mimeType() const
     return extractMIMETypeFromMediaType(m_response.httpHeaderField(HTTPHeaderName::ContentType)).convertToASCIILowercase();
 }
 
+// Checks segment by segment so that a buffer that turns out to be non-ASCII doesn't
+// get flattened just for the probe.
+static bool dataIsAllASCII(const SharedBuffer& data)
+{
+    const char* segment;
+    unsigned position = 0;
+    while (unsigned length = data.getSomeData(segment, position)) {
+        if (!charactersAreAllASCII(reinterpret_cast<const LChar*>(segment), length))
+            return false;
+        position += length;
+    }
+    return true;
+}
+
 StringView CachedScript::script()
 {
     if (!m_data)
@@ -77,7 +92,7 @@ StringView CachedScript::script()
     if (m_decodingState == NeverDecoded
         && TextEncoding(encoding()).isByteBasedEncoding()
         && m_data->size()
-        && charactersAreAllASCII(reinterpret_cast<const LChar*>(m_data->data()), m_data->size())) {
+        && dataIsAllASCII(*m_data)) {
 
         m_decodingState = DataAndDecodedStringHaveSameBytes;
 
@@ -92,7 +107,17 @@ StringView CachedScript::script()
         return { reinterpret_cast<const LChar*>(m_data->data()), m_data->size() };
 
     if (!m_script) {
-        m_script = m_decoder->decodeAndFlush(m_data->data(), encodedSize());
+        // Feed the decoder segment by segment rather than flattening the buffer; for a
+        // contiguous (e.g. file-mapped) buffer this is a single decode call anyway.
+        StringBuilder decodedScript;
+        const char* segment;
+        unsigned position = 0;
+        while (unsigned length = m_data->getSomeData(segment, position)) {
+            decodedScript.append(m_decoder->decode(segment, length));
+            position += length;
+        }
+        decodedScript.append(m_decoder->flush());
+        m_script = decodedScript.toString();
         m_scriptHash = m_script.impl()->hash();
         m_decodingState = DataAndDecodedStringHaveDifferentBytes;
         setDecodedSize(m_script.sizeInBytes());
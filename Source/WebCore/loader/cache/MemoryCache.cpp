@@ -34,11 +34,13 @@
 #include "FrameView.h"
 #include "Image.h"
 #include "Logging.h"
+#include "MemoryPressureHandler.h"
 #include "PublicSuffix.h"
 #include "SharedBuffer.h"
 #include "WorkerGlobalScope.h"
 #include "WorkerLoaderProxy.h"
 #include "WorkerThread.h"
+#include <algorithm>
 #include <stdio.h>
 #include <wtf/CurrentTime.h>
 #include <wtf/MathExtras.h>
@@ -69,6 +71,9 @@ MemoryCache::MemoryCache()
     , m_deadDecodedDataDeletionInterval(defaultDecodedDataDeletionInterval)
     , m_liveSize(0)
     , m_deadSize(0)
+    , m_pruneCount(0)
+    , m_prunedDecodedBytes(0)
+    , m_prunedResourceCount(0)
     , m_pruneTimer(*this, &MemoryCache::prune)
 {
 }
@@ -189,12 +194,17 @@ CachedResource* MemoryCache::resourceForRequestImpl(const ResourceRequest& reque
     return resources.get(key);
 }
 
-unsigned MemoryCache::deadCapacity() const 
+unsigned MemoryCache::deadCapacity() const
 {
+    // While the platform is reporting memory pressure, don't let dead resources regrow
+    // past the minimum. The pressure handler already flushed them once; anything we
+    // readmit beyond that would just have to be pruned again.
+    unsigned maxDeadCapacity = MemoryPressureHandler::singleton().isUnderMemoryPressure() ? m_minDeadCapacity : m_maxDeadCapacity;
+
     // Dead resource capacity is whatever space is not occupied by live resources, bounded by an independent minimum and maximum.
     unsigned capacity = m_capacity - std::min(m_liveSize, m_capacity); // Start with available capacity.
     capacity = std::max(capacity, m_minDeadCapacity); // Make sure it's above the minimum.
-    capacity = std::min(capacity, m_maxDeadCapacity); // Make sure it's below the maximum.
+    capacity = std::min(capacity, maxDeadCapacity); // Make sure it's below the maximum.
     return capacity;
 }
 
@@ -282,6 +292,7 @@ void MemoryCache::pruneLiveResourcesToSize(unsigned targetSize, bool shouldDestr
     if (m_inPruneResources)
         return;
     TemporaryChange<bool> reentrancyProtector(m_inPruneResources, true);
+    m_pruneCount++;
 
     double currentTime = FrameView::currentPaintTimeStamp();
     if (!currentTime) // In case prune is called directly, outside of a Frame paint.
@@ -316,6 +327,7 @@ void MemoryCache::pruneLiveResourcesToSize(unsigned targetSize, bool shouldDestr
 
             // Destroy our decoded data. This will remove us from m_liveDecodedResources, and possibly move us
             // to a different LRU list in m_allResources.
+            m_prunedDecodedBytes += current->decodedSize();
             current->destroyDecodedData();
 
             if (targetSize && m_liveSize <= targetSize)
@@ -339,7 +351,8 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
     if (m_inPruneResources)
         return;
     TemporaryChange<bool> reentrancyProtector(m_inPruneResources, true);
- 
+    m_pruneCount++;
+
     if (targetSize && m_deadSize <= targetSize)
         return;
 
@@ -350,16 +363,23 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
         Vector<CachedResourceHandle<CachedResource>> lruList;
         copyToVector(*m_allResources[i], lruList);
 
-        // First flush all the decoded data in this queue.
-        // Remove from the head, since this is the least frequently accessed of the objects.
-        for (auto& resource : lruList) {
+        // First flush all the decoded data in this queue. Decoded bytes are the cheapest
+        // to give back - they can be rebuilt from the still-cached encoded data - so free
+        // the largest decoded payloads first to reclaim the most memory while touching
+        // (and later re-decoding) the fewest resources. Ties keep LRU order.
+        Vector<CachedResourceHandle<CachedResource>> decodedFlushOrder = lruList;
+        std::stable_sort(decodedFlushOrder.begin(), decodedFlushOrder.end(), [](const CachedResourceHandle<CachedResource>& a, const CachedResourceHandle<CachedResource>& b) {
+            return a->decodedSize() > b->decodedSize();
+        });
+        for (auto& resource : decodedFlushOrder) {
             if (!resource->inCache())
                 continue;
 
             if (!resource->hasClients() && !resource->isPreloaded() && resource->isLoaded()) {
-                // Destroy our decoded data. This will remove us from 
-                // m_liveDecodedResources, and possibly move us to a different 
+                // Destroy our decoded data. This will remove us from
+                // m_liveDecodedResources, and possibly move us to a different
                 // LRU list in m_allResources.
+                m_prunedDecodedBytes += resource->decodedSize();
                 resource->destroyDecodedData();
 
                 if (targetSize && m_deadSize <= targetSize)
@@ -374,6 +394,7 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
                 continue;
 
             if (!resource->hasClients() && !resource->isPreloaded() && !resource->isCacheValidator()) {
+                m_prunedResourceCount++;
                 remove(*resource);
                 if (targetSize && m_deadSize <= targetSize)
                     return;
@@ -685,6 +706,9 @@ MemoryCache::Statistics MemoryCache::getStatistics()
             }
         }
     }
+    stats.pruneCount = m_pruneCount;
+    stats.prunedDecodedBytes = m_prunedDecodedBytes;
+    stats.prunedResourceCount = m_prunedResourceCount;
     return stats;
 }
 
@@ -88,6 +88,18 @@ public:
         TypeStatistic scripts;
         TypeStatistic xslStyleSheets;
         TypeStatistic fonts;
+
+        // Cumulative pruning counters since startup, for monitoring cache behavior over time.
+        unsigned pruneCount;
+        uint64_t prunedDecodedBytes;
+        unsigned prunedResourceCount;
+
+        Statistics()
+            : pruneCount(0)
+            , prunedDecodedBytes(0)
+            , prunedResourceCount(0)
+        {
+        }
     };
 
     WEBCORE_EXPORT static MemoryCache& singleton();
@@ -204,6 +216,11 @@ private:
     unsigned m_liveSize; // The number of bytes currently consumed by "live" resources in the cache.
     unsigned m_deadSize; // The number of bytes currently consumed by "dead" resources in the cache.
 
+    // Cumulative pruning counters, reported by getStatistics().
+    unsigned m_pruneCount;
+    uint64_t m_prunedDecodedBytes;
+    unsigned m_prunedResourceCount;
+
     // Size-adjusted and popularity-aware LRU list collection for cache objects.  This collection can hold
     // more resources than the cached resource map, since it can also hold "stale" multiple versions of objects that are
     // waiting to die when the clients referencing them go away.
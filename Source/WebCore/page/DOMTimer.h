@@ -48,6 +48,7 @@ namespace WebCore {
 
         static double defaultMinimumInterval() { return 0.004; } // 4 milliseconds.
         static double defaultAlignmentInterval() { return 0; }
+        static double visiblePageAlignmentInterval() { return 1.0 / 60; } // Nominal display refresh interval.
         static double hiddenPageAlignmentInterval() { return 1.0; } // 1 second.
 
         // Creates a new timer owned by specified ScriptExecutionContext, starts it
@@ -943,9 +943,8 @@ void DragController::doImageDrag(Element& element, const IntPoint& dragOrigin, c
 
     Image* image = getImage(element);
     if (image && image->size().height() * image->size().width() <= MaxOriginalImageArea
-        && (dragImage = createDragImageFromImage(image, element.renderer() ? orientationDescription : ImageOrientationDescription()))) {
+        && (dragImage = createScaledDragImageFromImage(*image, element.renderer() ? orientationDescription : ImageOrientationDescription(), layoutRect.size(), maxDragImageSize()))) {
 
-        dragImage = fitDragImageToMaxSize(dragImage, layoutRect.size(), maxDragImageSize());
         IntSize fittedSize = dragImageSize(dragImage);
 
         dragImage = scaleDragImage(dragImage, FloatSize(m_page.deviceScaleFactor(), m_page.deviceScaleFactor()));
@@ -2631,6 +2631,18 @@ void FrameView::scheduleRelayout()
     m_layoutTimer.startOneShot(delay);
 }
 
+// Mutations scoped to a subtree that lies entirely outside the visible area can't change what
+// is on screen, so their relayout doesn't have to compete with the next frame for time. Any
+// forced layout (script, painting) still runs the pending work synchronously.
+static const std::chrono::milliseconds offscreenSubtreeLayoutDelay { 50 };
+
+bool FrameView::subtreeLayoutCanAffectViewport(const RenderElement& layoutRoot) const
+{
+    // The rect is stale since layout is pending, but that is good enough for scheduling: a
+    // subtree growing into view is caught by the repaint that follows the delayed layout.
+    return layoutRoot.absoluteClippedOverflowRect().intersects(LayoutRect(visibleContentRect()));
+}
+
 static bool isObjectAncestorContainerOf(RenderObject* ancestor, RenderObject* descendant)
 {
     for (RenderObject* r = descendant; r; r = r->container()) {
@@ -2655,11 +2667,21 @@ void FrameView::scheduleRelayoutOfSubtree(RenderElement& newRelayoutRoot)
         return;
     }
 
+    // A pending relayout delayed because it only covered offscreen subtrees must not keep
+    // deferring work once a subtree that can affect the viewport needs layout too; bring the
+    // timer forward the same way scheduleRelayout() does for full layouts.
+    if (m_layoutTimer.isActive() && m_delayedLayout && !renderView.document().minimumLayoutDelay().count() && subtreeLayoutCanAffectViewport(newRelayoutRoot)) {
+        m_delayedLayout = false;
+        m_layoutTimer.startOneShot(0);
+    }
+
     if (!layoutPending() && m_layoutSchedulingEnabled) {
         std::chrono::milliseconds delay = renderView.document().minimumLayoutDelay();
         ASSERT(!newRelayoutRoot.container() || !newRelayoutRoot.container()->needsLayout());
         m_layoutRoot = &newRelayoutRoot;
         InspectorInstrumentation::didInvalidateLayout(frame());
+        if (!subtreeLayoutCanAffectViewport(newRelayoutRoot))
+            delay = std::max(delay, offscreenSubtreeLayoutDelay);
         m_delayedLayout = delay.count();
         m_layoutTimer.startOneShot(delay);
         return;
@@ -683,6 +683,7 @@ private:
     void notifyWidgets(WidgetNotification);
 
     void convertSubtreeLayoutToFullLayout();
+    bool subtreeLayoutCanAffectViewport(const RenderElement& layoutRoot) const;
 
     RenderElement* viewportRenderer() const;
 
@@ -32,6 +32,7 @@
 #include "PageConfiguration.h"
 #include "PageOverlayController.h"
 #include "ScrollLatchingState.h"
+#include "SelectionOverlayController.h"
 #include "Settings.h"
 #include "WheelEventDeltaFilter.h"
 #include <wtf/NeverDestroyed.h>
@@ -99,6 +100,13 @@ void MainFrame::selfOnlyDeref()
     deref();
 }
 
+SelectionOverlayController& MainFrame::selectionOverlayController()
+{
+    if (!m_selectionOverlayController)
+        m_selectionOverlayController = std::make_unique<SelectionOverlayController>(*this);
+    return *m_selectionOverlayController;
+}
+
 DiagnosticLoggingClient& MainFrame::diagnosticLoggingClient() const
 {
     static NeverDestroyed<EmptyDiagnosticLoggingClient> dummyClient;
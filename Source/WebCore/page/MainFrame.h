@@ -39,6 +39,7 @@ class DiagnosticLoggingClient;
 class PageConfiguration;
 class PageOverlayController;
 class ScrollLatchingState;
+class SelectionOverlayController;
 class ServicesOverlayController;
 class WheelEventDeltaFilter;
 
@@ -53,6 +54,7 @@ public:
 
     WheelEventDeltaFilter* wheelEventDeltaFilter() { return m_recentWheelEventDeltaFilter.get(); }
     PageOverlayController& pageOverlayController() { return *m_pageOverlayController; }
+    WEBCORE_EXPORT SelectionOverlayController& selectionOverlayController();
 
 #if PLATFORM(MAC)
 #if ENABLE(SERVICE_CONTROLS) || ENABLE(TELEPHONE_NUMBER_DETECTION)
@@ -88,6 +90,7 @@ private:
 
     std::unique_ptr<WheelEventDeltaFilter> m_recentWheelEventDeltaFilter;
     std::unique_ptr<PageOverlayController> m_pageOverlayController;
+    std::unique_ptr<SelectionOverlayController> m_selectionOverlayController;
     DiagnosticLoggingClient* m_diagnosticLoggingClient;
 };
 
@@ -25,6 +25,8 @@
 #include "ApplicationCacheStorage.h"
 #include "BackForwardClient.h"
 #include "BackForwardController.h"
+#include "CachedResource.h"
+#include "CachedResourceLoader.h"
 #include "Chrome.h"
 #include "ChromeClient.h"
 #include "ClientRectList.h"
@@ -74,6 +76,7 @@
 #include "RenderTheme.h"
 #include "RenderView.h"
 #include "RenderWidget.h"
+#include "ResourcePrefetcher.h"
 #include "ResourceUsageOverlay.h"
 #include "RuntimeEnabledFeatures.h"
 #include "SchemeRegistry.h"
@@ -210,6 +213,8 @@ Page::Page(PageConfiguration& pageConfiguration)
 #endif // ENABLE(VIEW_MODE_CSS_MEDIA)
     , m_timerThrottlingEnabled(false)
     , m_timerAlignmentInterval(DOMTimer::defaultAlignmentInterval())
+    , m_hiddenPageTimerAlignmentInterval(DOMTimer::hiddenPageAlignmentInterval())
+    , m_timerAlignmentIntervalTimer(*this, &Page::timerAlignmentIntervalTimerFired)
     , m_isEditable(false)
     , m_isPrerender(false)
     , m_viewState(PageInitialViewState)
@@ -331,6 +336,27 @@ uint64_t Page::renderTreeSize() const
     return total;
 }
 
+auto Page::memoryUsage() const -> MemoryUsage
+{
+    MemoryUsage usage;
+    for (const Frame* frame = &mainFrame(); frame; frame = frame->tree().traverseNext()) {
+        Document* document = frame->document();
+        if (!document)
+            continue;
+
+        usage.documentCount++;
+        if (RenderView* renderView = document->renderView())
+            usage.rendererCount += renderView->rendererCount();
+
+        for (auto& resource : document->cachedResourceLoader().allCachedResources().values()) {
+            usage.cachedResourceCount++;
+            usage.cachedResourceEncodedBytes += resource->encodedSize();
+            usage.cachedResourceDecodedBytes += resource->decodedSize();
+        }
+    }
+    return usage;
+}
+
 ViewportArguments Page::viewportArguments() const
 {
     return mainFrame().document() ? mainFrame().document()->viewportArguments() : ViewportArguments();
@@ -347,6 +373,13 @@ ScrollingCoordinator* Page::scrollingCoordinator()
     return m_scrollingCoordinator.get();
 }
 
+ResourcePrefetcher& Page::resourcePrefetcher()
+{
+    if (!m_resourcePrefetcher)
+        m_resourcePrefetcher = std::make_unique<ResourcePrefetcher>(*this);
+    return *m_resourcePrefetcher;
+}
+
 String Page::scrollingStateTreeAsText()
 {
     if (Document* document = m_mainFrame->document())
@@ -498,6 +531,10 @@ void Page::updateStyleForAllPagesAfterGlobalChangeInEnvironment()
 
 void Page::setNeedsRecalcStyleInAllFrames()
 {
+    // Documents sitting in the page cache are not in the frame tree, so dirty them through the
+    // cache; they pick the recalc up when they are restored.
+    PageCache::singleton().markPagesForFullStyleRecalc(*this);
+
     for (Frame* frame = &mainFrame(); frame; frame = frame->tree().traverseNext()) {
         if (Document* document = frame->document())
             document->styleResolverChanged(DeferRecalcStyle);
@@ -1114,6 +1151,8 @@ const String& Page::userStyleSheet() const
 
 void Page::invalidateStylesForAllLinks()
 {
+    PageCache::singleton().markPagesForFullStyleRecalc(*this);
+
     for (Frame* frame = m_mainFrame.get(); frame; frame = frame->tree().traverseNext()) {
         if (!frame->document())
             continue;
@@ -1123,6 +1162,8 @@ void Page::invalidateStylesForAllLinks()
 
 void Page::invalidateStylesForLink(LinkHash linkHash)
 {
+    PageCache::singleton().markPagesForFullStyleRecalc(*this);
+
     for (Frame* frame = m_mainFrame.get(); frame; frame = frame->tree().traverseNext()) {
         if (!frame->document())
             continue;
@@ -1183,6 +1224,10 @@ void Page::hiddenPageDOMTimerThrottlingStateChanged()
     setTimerThrottlingEnabled(m_viewState & ViewState::IsVisuallyIdle);
 }
 
+// While a page stays hidden, its timer alignment interval is repeatedly doubled up to this
+// limit, so long-hidden tabs converge on a couple of timer wakeups per minute.
+static const double hiddenPageTimerAlignmentIntervalLimit = 30;
+
 void Page::setTimerThrottlingEnabled(bool enabled)
 {
 #if ENABLE(HIDDEN_PAGE_DOM_TIMER_THROTTLING)
@@ -1190,11 +1235,46 @@ void Page::setTimerThrottlingEnabled(bool enabled)
         enabled = false;
 #endif
 
+    // Pages audibly playing media stay exempt; their timers commonly drive playback UI and buffering.
+    if (m_mediaState & MediaProducer::IsPlayingAudio)
+        enabled = false;
+
     if (enabled == m_timerThrottlingEnabled)
         return;
 
     m_timerThrottlingEnabled = enabled;
-    setDOMTimerAlignmentInterval(enabled ? DOMTimer::hiddenPageAlignmentInterval() : DOMTimer::defaultAlignmentInterval());
+    m_hiddenPageTimerAlignmentInterval = DOMTimer::hiddenPageAlignmentInterval();
+    if (enabled)
+        m_timerAlignmentIntervalTimer.startOneShot(m_hiddenPageTimerAlignmentInterval);
+    else
+        m_timerAlignmentIntervalTimer.stop();
+    updateDOMTimerAlignmentInterval();
+}
+
+void Page::timerAlignmentIntervalTimerFired()
+{
+    if (!m_timerThrottlingEnabled || m_hiddenPageTimerAlignmentInterval >= hiddenPageTimerAlignmentIntervalLimit)
+        return;
+
+    m_hiddenPageTimerAlignmentInterval = std::min(m_hiddenPageTimerAlignmentInterval * 2, hiddenPageTimerAlignmentIntervalLimit);
+    m_timerAlignmentIntervalTimer.startOneShot(m_hiddenPageTimerAlignmentInterval);
+    updateDOMTimerAlignmentInterval();
+}
+
+void Page::updateDOMTimerAlignmentInterval()
+{
+    double alignmentInterval;
+    if (m_timerThrottlingEnabled)
+        alignmentInterval = m_hiddenPageTimerAlignmentInterval;
+    else if (m_settings->visiblePageDOMTimerAlignmentEnabled()) {
+        // Quantizing timer fire times to the display refresh period coalesces the wakeups for
+        // pages that drive many animations from short setTimeouts; the work still lands on the
+        // frame boundary it would have been painted at.
+        alignmentInterval = DOMTimer::visiblePageAlignmentInterval();
+    } else
+        alignmentInterval = DOMTimer::defaultAlignmentInterval();
+
+    setDOMTimerAlignmentInterval(alignmentInterval);
 }
 
 void Page::setDOMTimerAlignmentInterval(double alignmentInterval)
@@ -1269,6 +1349,9 @@ void Page::updateIsPlayingMedia(uint64_t sourceElementID)
 
     m_mediaState = state;
 
+    // Starting or stopping audible playback changes whether this page is exempt from timer throttling.
+    setTimerThrottlingEnabled(m_viewState & ViewState::IsVisuallyIdle);
+
     chrome().client().isPlayingMediaDidChange(state, sourceElementID);
 }
 
@@ -113,6 +113,7 @@ class Range;
 class RenderObject;
 class RenderTheme;
 class ReplayController;
+class ResourcePrefetcher;
 class ResourceUsageOverlay;
 class VisibleSelection;
 class ScrollableArea;
@@ -145,6 +146,18 @@ public:
 
     WEBCORE_EXPORT uint64_t renderTreeSize() const;
 
+    struct MemoryUsage {
+        uint64_t documentCount { 0 };
+        uint64_t rendererCount { 0 };
+        uint64_t cachedResourceCount { 0 };
+        uint64_t cachedResourceEncodedBytes { 0 };
+        uint64_t cachedResourceDecodedBytes { 0 };
+    };
+    // Accounts the parts of process memory that can be attributed to this page.
+    // Process-wide pools like the JS heap and malloc are shared between pages,
+    // so callers report those alongside rather than per page.
+    WEBCORE_EXPORT MemoryUsage memoryUsage() const;
+
     void setNeedsRecalcStyleInAllFrames();
 
     RenderTheme& theme() const { return *m_theme; }
@@ -211,6 +224,8 @@ public:
 
     WEBCORE_EXPORT ScrollingCoordinator* scrollingCoordinator();
 
+    WEBCORE_EXPORT ResourcePrefetcher& resourcePrefetcher();
+
     WEBCORE_EXPORT String scrollingStateTreeAsText();
     WEBCORE_EXPORT String synchronousScrollingReasonsAsText();
     WEBCORE_EXPORT Ref<ClientRectList> nonFastScrollableRects();
@@ -526,6 +541,7 @@ private:
 
     void hiddenPageDOMTimerThrottlingStateChanged();
     void setTimerThrottlingEnabled(bool);
+    void updateDOMTimerAlignmentInterval();
     void setDOMTimerAlignmentInterval(double);
     void timerAlignmentIntervalTimerFired();
     bool canTabSuspend();
@@ -551,6 +567,7 @@ private:
     const std::unique_ptr<PointerLockController> m_pointerLockController;
 #endif
     RefPtr<ScrollingCoordinator> m_scrollingCoordinator;
+    std::unique_ptr<ResourcePrefetcher> m_resourcePrefetcher;
 
     const RefPtr<Settings> m_settings;
     const std::unique_ptr<ProgressTracker> m_progress;
@@ -618,6 +635,8 @@ private:
 
     bool m_timerThrottlingEnabled;
     double m_timerAlignmentInterval;
+    double m_hiddenPageTimerAlignmentInterval;
+    Timer m_timerAlignmentIntervalTimer;
 
     bool m_isEditable;
     bool m_isPrerender;
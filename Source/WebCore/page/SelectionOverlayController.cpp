@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "SelectionOverlayController.h"
+
+#include "FrameSelection.h"
+#include "FrameView.h"
+#include "GraphicsContext.h"
+#include "MainFrame.h"
+#include "Page.h"
+#include "PageOverlayController.h"
+#include "RenderTheme.h"
+
+namespace WebCore {
+
+// The highlight is drawn above the glyphs rather than behind them, so it uses a translucent
+// version of the theme's selection color, like a find-in-page indicator does.
+static const int highlightAlpha = 128;
+
+SelectionOverlayController::SelectionOverlayController(MainFrame& frame)
+    : m_frame(frame)
+{
+}
+
+SelectionOverlayController::~SelectionOverlayController()
+{
+    if (m_overlay)
+        m_frame.pageOverlayController().uninstallPageOverlay(m_overlay.get(), PageOverlay::FadeMode::DoNotFade);
+}
+
+void SelectionOverlayController::selectionDidChange(Frame& frame)
+{
+    if (!m_overlay) {
+        m_overlay = PageOverlay::create(*this, PageOverlay::OverlayType::Document);
+        m_frame.pageOverlayController().installPageOverlay(m_overlay.get(), PageOverlay::FadeMode::DoNotFade);
+    }
+
+    updateHighlightRects(frame);
+}
+
+void SelectionOverlayController::updateHighlightRects(Frame& frame)
+{
+    Vector<FloatRect> oldHighlightRects = WTFMove(m_highlightRects);
+
+    Vector<FloatRect> textRects;
+    frame.selection().getTextRectangles(textRects);
+
+    if (FrameView* view = frame.view()) {
+        IntSize overlayOffset = m_overlay->viewToOverlayOffset();
+        for (const auto& rect : textRects) {
+            FloatRect overlayRect = view->contentsToRootView(enclosingIntRect(rect));
+            overlayRect.move(overlayOffset.width(), overlayOffset.height());
+            m_highlightRects.append(overlayRect);
+        }
+    }
+
+    // Only the area the selection left or entered needs redrawing; during a drag-selection
+    // that is the bounds of the old and new highlights, not the whole overlay.
+    FloatRect dirtyRect;
+    for (const auto& rect : oldHighlightRects)
+        dirtyRect.unite(rect);
+    for (const auto& rect : m_highlightRects)
+        dirtyRect.unite(rect);
+
+    if (dirtyRect.isEmpty())
+        return;
+
+    m_overlay->setNeedsDisplay(enclosingIntRect(dirtyRect));
+}
+
+void SelectionOverlayController::pageOverlayDestroyed(PageOverlay&)
+{
+}
+
+void SelectionOverlayController::willMoveToPage(PageOverlay&, Page* page)
+{
+    if (!page)
+        m_overlay = nullptr;
+}
+
+void SelectionOverlayController::didMoveToPage(PageOverlay&, Page*)
+{
+}
+
+void SelectionOverlayController::drawRect(PageOverlay&, GraphicsContext& context, const IntRect& dirtyRect)
+{
+    context.clearRect(dirtyRect);
+
+    if (m_highlightRects.isEmpty())
+        return;
+
+    Color selectionColor = m_frame.page() ? m_frame.page()->theme().activeSelectionBackgroundColor() : Color(Color::black);
+    Color highlightColor(selectionColor.red(), selectionColor.green(), selectionColor.blue(), highlightAlpha);
+
+    GraphicsContextStateSaver stateSaver(context);
+    context.setFillColor(highlightColor);
+    for (const auto& rect : m_highlightRects) {
+        if (rect.intersects(dirtyRect))
+            context.fillRect(rect);
+    }
+}
+
+bool SelectionOverlayController::mouseEvent(PageOverlay&, const PlatformMouseEvent&)
+{
+    return false;
+}
+
+} // namespace WebCore
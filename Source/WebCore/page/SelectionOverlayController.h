@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SelectionOverlayController_h
+#define SelectionOverlayController_h
+
+#include "FloatRect.h"
+#include "PageOverlay.h"
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+class Frame;
+class MainFrame;
+
+// Draws the selection highlight into a composited overlay layer above the content, so a
+// selection change only repaints the overlay instead of re-rasterizing the content tiles
+// the selection covers. Enabled via Settings::compositedSelectionHighlightEnabled().
+class SelectionOverlayController final : public PageOverlay::Client {
+    WTF_MAKE_NONCOPYABLE(SelectionOverlayController);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    explicit SelectionOverlayController(MainFrame&);
+    ~SelectionOverlayController();
+
+    void selectionDidChange(Frame&);
+
+private:
+    void updateHighlightRects(Frame&);
+
+    // PageOverlay::Client.
+    virtual void pageOverlayDestroyed(PageOverlay&) override;
+    virtual void willMoveToPage(PageOverlay&, Page*) override;
+    virtual void didMoveToPage(PageOverlay&, Page*) override;
+    virtual void drawRect(PageOverlay&, GraphicsContext&, const IntRect& dirtyRect) override;
+    virtual bool mouseEvent(PageOverlay&, const PlatformMouseEvent&) override;
+
+    MainFrame& m_frame;
+    RefPtr<PageOverlay> m_overlay;
+    Vector<FloatRect> m_highlightRects;
+};
+
+} // namespace WebCore
+
+#endif // SelectionOverlayController_h
@@ -214,6 +214,7 @@ Settings::Settings(Page* page)
 #if ENABLE(HIDDEN_PAGE_DOM_TIMER_THROTTLING)
     , m_hiddenPageDOMTimerThrottlingEnabled(false)
 #endif
+    , m_visiblePageDOMTimerAlignmentEnabled(false)
     , m_hiddenPageCSSAnimationSuspensionEnabled(false)
     , m_fontFallbackPrefersPictographs(false)
     , m_forcePendingWebGLPolicy(false)
@@ -683,6 +684,15 @@ void Settings::setHiddenPageDOMTimerThrottlingEnabled(bool flag)
 }
 #endif
 
+void Settings::setVisiblePageDOMTimerAlignmentEnabled(bool flag)
+{
+    if (m_visiblePageDOMTimerAlignmentEnabled == flag)
+        return;
+    m_visiblePageDOMTimerAlignmentEnabled = flag;
+    if (m_page)
+        m_page->updateDOMTimerAlignmentInterval();
+}
+
 void Settings::setHiddenPageCSSAnimationSuspensionEnabled(bool flag)
 {
     if (m_hiddenPageCSSAnimationSuspensionEnabled == flag)
@@ -166,6 +166,9 @@ public:
     WEBCORE_EXPORT void setHiddenPageDOMTimerThrottlingEnabled(bool);
 #endif
 
+    bool visiblePageDOMTimerAlignmentEnabled() const { return m_visiblePageDOMTimerAlignmentEnabled; }
+    WEBCORE_EXPORT void setVisiblePageDOMTimerAlignmentEnabled(bool);
+
     WEBCORE_EXPORT void setUsesPageCache(bool);
     bool usesPageCache() const { return m_usesPageCache; }
         
@@ -337,6 +340,7 @@ private:
 #if ENABLE(HIDDEN_PAGE_DOM_TIMER_THROTTLING)
     bool m_hiddenPageDOMTimerThrottlingEnabled : 1;
 #endif
+    bool m_visiblePageDOMTimerAlignmentEnabled : 1;
     bool m_hiddenPageCSSAnimationSuspensionEnabled : 1;
     bool m_fontFallbackPrefersPictographs : 1;
 
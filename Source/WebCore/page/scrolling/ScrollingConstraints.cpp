@@ -94,6 +94,37 @@ FloatSize StickyPositionViewportConstraints::computeStickyOffset(const FloatRect
     return boxRect.location() - m_stickyBoxRect.location();
 }
 
+ScrollLinkedExpression StickyPositionViewportConstraints::scrollLinkedExpression() const
+{
+    // The constraining rect tracks the scroll position one-to-one, so each anchored edge of
+    // computeStickyOffset() becomes a term whose linear part has coefficient 1 and whose
+    // clamp range is the available space within the containing block. The terms sum because
+    // every edge in computeStickyOffset() measures against the unmoved sticky box rect.
+    ScrollLinkedExpression expression;
+
+    if (hasAnchorEdge(AnchorEdgeRight)) {
+        float availableSpace = std::min<float>(0, m_containingBlockRect.x() - m_stickyBoxRect.x());
+        expression.addHorizontalTerm(ScrollLinkedExpression::Term(1, m_constrainingRectAtLastLayout.maxX() - m_rightOffset - m_stickyBoxRect.maxX(), availableSpace, 0));
+    }
+
+    if (hasAnchorEdge(AnchorEdgeLeft)) {
+        float availableSpace = std::max<float>(0, m_containingBlockRect.maxX() - m_stickyBoxRect.maxX());
+        expression.addHorizontalTerm(ScrollLinkedExpression::Term(1, m_constrainingRectAtLastLayout.x() + m_leftOffset - m_stickyBoxRect.x(), 0, availableSpace));
+    }
+
+    if (hasAnchorEdge(AnchorEdgeBottom)) {
+        float availableSpace = std::min<float>(0, m_containingBlockRect.y() - m_stickyBoxRect.y());
+        expression.addVerticalTerm(ScrollLinkedExpression::Term(1, m_constrainingRectAtLastLayout.maxY() - m_bottomOffset - m_stickyBoxRect.maxY(), availableSpace, 0));
+    }
+
+    if (hasAnchorEdge(AnchorEdgeTop)) {
+        float availableSpace = std::max<float>(0, m_containingBlockRect.maxY() - m_stickyBoxRect.maxY());
+        expression.addVerticalTerm(ScrollLinkedExpression::Term(1, m_constrainingRectAtLastLayout.y() + m_topOffset - m_stickyBoxRect.y(), 0, availableSpace));
+    }
+
+    return expression;
+}
+
 FloatPoint StickyPositionViewportConstraints::layerPositionForConstrainingRect(const FloatRect& constrainingRect) const
 {
     FloatSize offset = computeStickyOffset(constrainingRect);
@@ -27,6 +27,7 @@
 #define ScrollingConstraints_h
 
 #include "FloatRect.h"
+#include "ScrollLinkedExpression.h"
 
 namespace WebCore {
 
@@ -140,6 +141,11 @@ public:
 
     WEBCORE_EXPORT FloatPoint layerPositionForConstrainingRect(const FloatRect& constrainingRect) const;
 
+    // Expresses the sticky offset as clamped linear terms in the scroll delta, so the
+    // compositing side can keep the box stuck between layouts. Only valid until the next
+    // layout updates the rects it is derived from.
+    WEBCORE_EXPORT ScrollLinkedExpression scrollLinkedExpression() const;
+
     const FloatPoint& layerPositionAtLastLayout() const { return m_layerPositionAtLastLayout; }
     void setLayerPositionAtLastLayout(const FloatPoint& point) { m_layerPositionAtLastLayout = point; }
 
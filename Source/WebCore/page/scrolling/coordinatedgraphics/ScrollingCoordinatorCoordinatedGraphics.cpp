@@ -64,6 +64,8 @@ void ScrollingCoordinatorCoordinatedGraphics::detachFromStateTree(ScrollingNodeI
     ScrollingStateNode* node = m_scrollingStateTree->stateNodeForID(nodeID);
     if (node && node->nodeType() == FixedNode)
         toCoordinatedGraphicsLayer(node->layer())->setFixedToViewport(false);
+    else if (node && node->nodeType() == StickyNode)
+        toCoordinatedGraphicsLayer(node->layer())->setScrollLinkedExpression(ScrollLinkedExpression());
 
     m_scrollingStateTree->detachNode(nodeID);
 }
@@ -87,13 +89,24 @@ void ScrollingCoordinatorCoordinatedGraphics::updateViewportConstrainedNode(Scro
         downcast<ScrollingStateFixedNode>(*node).setLayer(graphicsLayer);
         break;
     }
-    case ViewportConstraints::StickyPositionConstraint:
-        break; // FIXME : Support sticky elements.
+    case ViewportConstraints::StickyPositionConstraint: {
+        // There is no ScrollingTree on this path; instead the sticky offset is handed to the
+        // compositing side as a scroll-linked expression, evaluated against the scroll delta
+        // each frame the same way fixed layers are adjusted.
+        const StickyPositionViewportConstraints& stickyConstraints = static_cast<const StickyPositionViewportConstraints&>(constraints);
+        toCoordinatedGraphicsLayer(graphicsLayer)->setScrollLinkedExpression(stickyConstraints.scrollLinkedExpression());
+        downcast<ScrollingStateStickyNode>(*node).setLayer(graphicsLayer);
+        break;
+    }
     default:
         ASSERT_NOT_REACHED();
     }
 }
 
+// Overflow scrolling on this path is delegated rather than threaded: the scrollable area is
+// attached to its CoordinatedGraphicsLayer so the compositing side can apply and commit scroll
+// offsets for it, but there is no ScrollingThread or ScrollingTree here — input handling and
+// ScrollableArea updates stay on the main thread.
 void ScrollingCoordinatorCoordinatedGraphics::scrollableAreaScrollLayerDidChange(ScrollableArea& scrollableArea)
 {
     CoordinatedGraphicsLayer* layer = toCoordinatedGraphicsLayer(scrollLayerForScrollableArea(scrollableArea));
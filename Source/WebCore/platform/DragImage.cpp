@@ -29,6 +29,8 @@
 #include "Frame.h"
 #include "FrameSnapshotting.h"
 #include "FrameView.h"
+#include "GraphicsContext.h"
+#include "Image.h"
 #include "ImageBuffer.h"
 #include "Range.h"
 #include "RenderObject.h"
@@ -68,6 +70,37 @@ DragImageRef fitDragImageToMaxSize(DragImageRef image, const IntSize& layoutSize
     return scaleDragImage(image, FloatSize(scaleX, scaleY));
 }
 
+DragImageRef createScaledDragImageFromImage(Image& image, ImageOrientationDescription orientation, const IntSize& layoutSize, const IntSize& maxSize)
+{
+    float resizeRatio = 1;
+    if (layoutSize.width() > maxSize.width())
+        resizeRatio = maxSize.width() / (float)layoutSize.width();
+    if (layoutSize.height() > maxSize.height())
+        resizeRatio = std::min(resizeRatio, maxSize.height() / (float)layoutSize.height());
+
+    IntSize fittedSize = layoutSize;
+    fittedSize.scale(resizeRatio);
+
+    if (fittedSize.isEmpty() || fittedSize == image.size())
+        return createDragImageFromImage(&image, orientation);
+
+    // Rasterize straight at the fitted size instead of creating a full-size platform image
+    // and scaling it down afterwards; for a large image the latter costs a second full-size
+    // bitmap and a resample of every source pixel.
+    std::unique_ptr<ImageBuffer> buffer = ImageBuffer::create(fittedSize, Unaccelerated);
+    if (!buffer)
+        return createDragImageFromImage(&image, orientation);
+
+    buffer->context().drawImage(image, FloatRect(FloatPoint(), fittedSize), ImagePaintingOptions(orientation, InterpolationMedium));
+
+    RefPtr<Image> fittedImage = ImageBuffer::sinkIntoImage(WTFMove(buffer), Unscaled);
+    if (!fittedImage)
+        return nullptr;
+
+    // The orientation has been baked into the pixels above.
+    return createDragImageFromImage(fittedImage.get(), ImageOrientationDescription());
+}
+
 struct ScopedNodeDragEnabler {
     ScopedNodeDragEnabler(Frame& frame, Node& node)
         : frame(frame)
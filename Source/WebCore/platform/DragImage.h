@@ -84,6 +84,7 @@ DragImageRef scaleDragImage(DragImageRef, FloatSize scale);
 DragImageRef dissolveDragImageToFraction(DragImageRef, float delta);
 
 DragImageRef createDragImageFromImage(Image*, ImageOrientationDescription);
+DragImageRef createScaledDragImageFromImage(Image&, ImageOrientationDescription, const IntSize& layoutSize, const IntSize& maxSize);
 DragImageRef createDragImageIconForCachedImageFilename(const String&);
 
 DragImageRef createDragImageForNode(Frame&, Node&);
@@ -27,13 +27,18 @@ struct NamedColor {
     unsigned ARGBValue;
 };
 
+// The property and value tables are generated with gperf's %pic option, so
+// name is an offset into the generated string pool rather than a pointer.
+// That keeps the tables free of relocations, letting the dynamic linker share
+// them read-only across all web processes. The lookup functions resolve the
+// offsets internally; callers should only use id.
 struct Property {
-    const char* name;
+    int name;
     int id;
 };
 
 struct Value {
-    const char* name;
+    int name;
     int id;
 };
 
@@ -59,6 +59,11 @@ public:
 
     WEBCORE_EXPORT static RefPtr<SharedBuffer> createWithContentsOfFile(const String& filePath);
 
+    // Wraps an existing file mapping without copying, so a resource loaded from a mapped
+    // file (e.g. the network disk cache) keeps its file backing end-to-end; data() stays
+    // cheap because the mapping is contiguous.
+    static Ref<SharedBuffer> create(MappedFileData&& mappedFileData) { return adoptRef(*new SharedBuffer(WTFMove(mappedFileData))); }
+
     WEBCORE_EXPORT static PassRefPtr<SharedBuffer> adoptVector(Vector<char>& vector);
     
     WEBCORE_EXPORT ~SharedBuffer();
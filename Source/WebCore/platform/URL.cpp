@@ -35,11 +35,13 @@
 #include <unicode/uidna.h>
 #include <wtf/HashMap.h>
 #include <wtf/HexNumber.h>
+#include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/StringBuilder.h>
 #include <wtf/text/StringHash.h>
+#include <wtf/text/StringView.h>
 
 // FIXME: This file makes too much use of the + operator on String.
 // We either have to optimize that operator so it doesn't involve
@@ -441,9 +443,46 @@ URL::URL(ParsedURLStringTag, const String& url)
 #endif
 }
 
+// Pages commonly resolve the same href against the same base over and over, for example
+// when link elements are restyled or :visited state is computed. Since resolution is a
+// pure function of the two strings, remember recent results keyed by the string pointers.
+// The entries ref both strings, so an impl can't die and leave a stale pointer as a key.
+struct ResolvedURLCacheEntry {
+    String baseString;
+    String relativeString;
+    URL url;
+};
+typedef HashMap<std::pair<StringImpl*, StringImpl*>, ResolvedURLCacheEntry> ResolvedURLCache;
+
+static const unsigned maximumResolvedURLCacheSize = 512;
+
+static ResolvedURLCache& resolvedURLCache()
+{
+    ASSERT(isMainThread());
+    static NeverDestroyed<ResolvedURLCache> cache;
+    return cache;
+}
+
 URL::URL(const URL& base, const String& relative)
 {
+    if (!isMainThread() || !base.m_string.impl() || !relative.impl()) {
+        init(base, relative, UTF8Encoding());
+        return;
+    }
+
+    auto& cache = resolvedURLCache();
+    auto key = std::make_pair(base.m_string.impl(), relative.impl());
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        *this = it->value.url;
+        return;
+    }
+
     init(base, relative, UTF8Encoding());
+
+    if (cache.size() >= maximumResolvedURLCacheSize)
+        cache.clear();
+    cache.add(key, ResolvedURLCacheEntry { base.m_string, relative, *this });
 }
 
 URL::URL(const URL& base, const String& relative, const TextEncoding& encoding)
@@ -818,6 +857,38 @@ String URL::path() const
     return m_string.substring(m_portEnd, m_pathEnd - m_portEnd);
 }
 
+StringView URL::protocolView() const
+{
+    return StringView(m_string).substring(0, m_schemeEnd);
+}
+
+StringView URL::hostView() const
+{
+    unsigned start = hostStart();
+    return StringView(m_string).substring(start, m_hostEnd - start);
+}
+
+StringView URL::pathView() const
+{
+    return StringView(m_string).substring(m_portEnd, m_pathEnd - m_portEnd);
+}
+
+StringView URL::queryView() const
+{
+    if (m_queryEnd == m_pathEnd)
+        return StringView();
+
+    return StringView(m_string).substring(m_pathEnd + 1, m_queryEnd - (m_pathEnd + 1));
+}
+
+StringView URL::fragmentIdentifierView() const
+{
+    if (m_fragmentEnd == m_queryEnd)
+        return StringView();
+
+    return StringView(m_string).substring(m_queryEnd + 1, m_fragmentEnd - (m_queryEnd + 1));
+}
+
 bool URL::setProtocol(const String& s)
 {
     // Firefox and IE remove everything after the first ':'.
@@ -120,6 +120,15 @@ public:
     WEBCORE_EXPORT String fragmentIdentifier() const;
     WEBCORE_EXPORT bool hasFragmentIdentifier() const;
 
+    // Versions of the component getters above that return views over this URL's string
+    // instead of allocating substrings. The views are only good as long as this URL is
+    // alive and unmodified.
+    StringView protocolView() const;
+    StringView hostView() const;
+    StringView pathView() const;
+    StringView queryView() const;
+    StringView fragmentIdentifierView() const;
+
     // Unlike user() and pass(), these functions don't decode escape sequences.
     // This is necessary for accurate round-tripping, because encoding doesn't encode '%' characters.
     String encodedUser() const;
@@ -666,8 +666,44 @@ void vclip(const float* sourceP, int sourceStride, const float* lowThresholdP, c
     float lowThreshold = *lowThresholdP;
     float highThreshold = *highThresholdP;
 
-    // FIXME: Optimize for SSE2.
-#if HAVE(ARM_NEON_INTRINSICS)
+#ifdef __SSE2__
+    if ((sourceStride == 1) && (destStride == 1)) {
+        // If the sourceP address is not 16-byte aligned, the first several frames (at most three) should be processed separately.
+        while ((reinterpret_cast<uintptr_t>(sourceP) & 0x0F) && n) {
+            *destP = std::max(std::min(*sourceP, highThreshold), lowThreshold);
+            sourceP++;
+            destP++;
+            n--;
+        }
+
+        // Now the sourceP is aligned, use SSE.
+        int tailFrames = n % 4;
+        const float* endP = destP + n - tailFrames;
+        __m128 source;
+        __m128 dest;
+        __m128 mLow = _mm_set_ps1(lowThreshold);
+        __m128 mHigh = _mm_set_ps1(highThreshold);
+
+        bool destAligned = !(reinterpret_cast<uintptr_t>(destP) & 0x0F);
+
+#define SSE2_CLIP(storeInstr)                                       \
+            while (destP < endP)                                    \
+            {                                                       \
+                source = _mm_load_ps(sourceP);                      \
+                dest = _mm_max_ps(_mm_min_ps(source, mHigh), mLow); \
+                _mm_##storeInstr##_ps(destP, dest);                 \
+                sourceP += 4;                                       \
+                destP += 4;                                         \
+            }
+
+        if (destAligned)
+            SSE2_CLIP(store)
+        else
+            SSE2_CLIP(storeu)
+
+        n = tailFrames;
+    }
+#elif HAVE(ARM_NEON_INTRINSICS)
     if ((sourceStride == 1) && (destStride == 1)) {
         int tailFrames = n % 4;
         const float* endP = destP + n - tailFrames;
@@ -114,6 +114,13 @@ bool BitmapImage::hasSingleSecurityOrigin() const
 
 void BitmapImage::destroyDecodedData(bool destroyAll)
 {
+#if USE(CAIRO)
+    // The cached scaled variant is derived from the decoded frame; drop it under the
+    // same memory pressure that drops the frame itself.
+    m_scaledSurface = nullptr;
+    m_scaledSurfaceSize = IntSize();
+#endif
+
     unsigned frameBytesCleared = 0;
     const size_t clearBeforeFrame = destroyAll ? m_frames.size() : m_currentFrame;
 
@@ -386,6 +393,10 @@ bool BitmapImage::ensureFrameIsCached(size_t index, ImageFrameCaching frameCachi
     return true;
 }
 
+// Note that fetching an uncached frame decodes it synchronously on the calling (main) thread;
+// the first paint of a large image pays the full decode cost. Moving the decode to a background
+// thread would require the decoder and its SharedBuffer to stop being mutated from the main
+// thread while decoding, and a way for painting to proceed without the frame until it is ready.
 PassNativeImagePtr BitmapImage::frameAtIndex(size_t index, float presentationScaleHint)
 {
     if (index >= frameCount())
@@ -314,6 +314,12 @@ private:
 #if USE(APPKIT)
     mutable RetainPtr<NSImage> m_nsImage; // A cached NSImage of frame 0. Only built lazily if someone actually queries for one.
 #endif
+#if USE(CAIRO)
+    // The most recently drawn scaled variant of a still image, so redrawing at the same
+    // non-integral scale every frame doesn't make pixman resample every pixel each time.
+    RefPtr<cairo_surface_t> m_scaledSurface;
+    IntSize m_scaledSurfaceSize;
+#endif
 #if USE(CG)
     mutable RetainPtr<CFDataRef> m_tiffRep; // Cached TIFF rep for frame 0. Only built lazily if someone queries for one.
 #endif
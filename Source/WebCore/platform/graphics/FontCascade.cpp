@@ -236,6 +236,13 @@ static FontCascadeCacheKey makeFontCascadeCacheKey(const FontCascadeDescription&
         key.families.uncheckedAppend(description.familyAt(i));
     key.fontSelectorId = fontSelector ? fontSelector->uniqueId() : 0;
     key.fontSelectorVersion = fontSelector ? fontSelector->version() : 0;
+    if (fontSelector) {
+        // Fold in the per-family versions so a font load only invalidates cache entries
+        // whose family lists can see the affected faces. Versions never decrease, so any
+        // change in a component changes the sum.
+        for (auto& family : key.families)
+            key.fontSelectorVersion += fontSelector->versionForFamily(family);
+    }
     return key;
 }
 
@@ -275,8 +282,9 @@ static Ref<FontCascadeFonts> retrieveOrAddCachedFonts(const FontCascadeDescripti
     if (!addResult.isNewEntry && keysMatch(addResult.iterator->value->key, key))
         return addResult.iterator->value->fonts.get();
 
+    unsigned fontSelectorVersion = key.fontSelectorVersion;
     auto& newEntry = addResult.iterator->value;
-    newEntry = std::make_unique<FontCascadeCacheEntry>(WTFMove(key), FontCascadeFonts::create(WTFMove(fontSelector)));
+    newEntry = std::make_unique<FontCascadeCacheEntry>(WTFMove(key), FontCascadeFonts::create(WTFMove(fontSelector), fontSelectorVersion));
     Ref<FontCascadeFonts> glyphs = newEntry->fonts.get();
 
     static const unsigned unreferencedPruneInterval = 50;
@@ -96,10 +96,10 @@ void FontCascadeFonts::GlyphPageCacheEntry::setSingleFontPage(RefPtr<GlyphPage>&
     m_singleFont = page;
 }
 
-FontCascadeFonts::FontCascadeFonts(RefPtr<FontSelector>&& fontSelector)
+FontCascadeFonts::FontCascadeFonts(RefPtr<FontSelector>&& fontSelector, unsigned fontSelectorVersion)
     : m_cachedPrimaryFont(nullptr)
     , m_fontSelector(fontSelector)
-    , m_fontSelectorVersion(m_fontSelector ? m_fontSelector->version() : 0)
+    , m_fontSelectorVersion(fontSelectorVersion)
     , m_generation(FontCache::singleton().generation())
 {
 }
@@ -45,7 +45,7 @@ class MixedFontGlyphPage;
 class FontCascadeFonts : public RefCounted<FontCascadeFonts> {
     WTF_MAKE_NONCOPYABLE(FontCascadeFonts);
 public:
-    static Ref<FontCascadeFonts> create(RefPtr<FontSelector>&& fontSelector) { return adoptRef(*new FontCascadeFonts(WTFMove(fontSelector))); }
+    static Ref<FontCascadeFonts> create(RefPtr<FontSelector>&& fontSelector, unsigned fontSelectorVersion) { return adoptRef(*new FontCascadeFonts(WTFMove(fontSelector), fontSelectorVersion)); }
     static Ref<FontCascadeFonts> createForPlatformFont(const FontPlatformData& platformData) { return adoptRef(*new FontCascadeFonts(platformData)); }
 
     WEBCORE_EXPORT ~FontCascadeFonts();
@@ -73,7 +73,7 @@ public:
     void pruneSystemFallbacks();
 
 private:
-    FontCascadeFonts(RefPtr<FontSelector>&&);
+    FontCascadeFonts(RefPtr<FontSelector>&&, unsigned fontSelectorVersion);
     FontCascadeFonts(const FontPlatformData&);
 
     GlyphData glyphDataForSystemFallback(UChar32, const FontCascadeDescription&, FontVariant);
@@ -53,6 +53,9 @@ public:
 
     virtual unsigned uniqueId() const = 0;
     virtual unsigned version() const = 0;
+    // Incremented when the set of faces available for the given family changes. Lets caches
+    // keyed on a family list ignore invalidations that cannot affect them.
+    virtual unsigned versionForFamily(const AtomicString&) const { return 0; }
 };
 
 class FontSelectorClient {
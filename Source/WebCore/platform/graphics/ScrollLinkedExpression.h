@@ -0,0 +1,108 @@
+/*
+ Copyright (C) 2016 Igalia S.L.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Library General Public
+ License as published by the Free Software Foundation; either
+ version 2 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Library General Public License for more details.
+
+ You should have received a copy of the GNU Library General Public License
+ along with this library; see the file COPYING.LIB.  If not, write to
+ the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ Boston, MA 02110-1301, USA.
+ */
+
+#ifndef ScrollLinkedExpression_h
+#define ScrollLinkedExpression_h
+
+#include "FloatSize.h"
+#include <wtf/MathExtras.h>
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+// Describes how a layer offset responds to scrolling, as a sum of clamped linear terms in
+// the scroll delta, one list of terms per axis. Position:sticky boxes and parallax effects
+// both reduce to this form, which lets the compositing side move the layer in lockstep with
+// the scroll position every frame instead of waiting for the web process to lay out and
+// commit a new position.
+class ScrollLinkedExpression {
+public:
+    struct Term {
+        Term()
+            : coefficient(0)
+            , base(0)
+            , minimum(0)
+            , maximum(0)
+        {
+        }
+
+        Term(float coefficient, float base, float minimum, float maximum)
+            : coefficient(coefficient)
+            , base(base)
+            , minimum(minimum)
+            , maximum(maximum)
+        {
+        }
+
+        // The clamped value at a zero delta is subtracted out so that the term contributes
+        // nothing at the scroll position the expression was built for.
+        float evaluate(float scrollDelta) const
+        {
+            return clampTo(base + coefficient * scrollDelta, minimum, maximum) - clampTo(base, minimum, maximum);
+        }
+
+        bool operator==(const Term& other) const
+        {
+            return coefficient == other.coefficient
+                && base == other.base
+                && minimum == other.minimum
+                && maximum == other.maximum;
+        }
+
+        float coefficient; // Multiplies the scroll delta on this term's axis.
+        float base; // Value of the linear part at a zero scroll delta.
+        float minimum;
+        float maximum;
+    };
+
+    typedef Vector<Term, 2> Terms;
+
+    void addHorizontalTerm(const Term& term) { m_horizontalTerms.append(term); }
+    void addVerticalTerm(const Term& term) { m_verticalTerms.append(term); }
+
+    const Terms& horizontalTerms() const { return m_horizontalTerms; }
+    const Terms& verticalTerms() const { return m_verticalTerms; }
+
+    bool isEmpty() const { return m_horizontalTerms.isEmpty() && m_verticalTerms.isEmpty(); }
+
+    FloatSize evaluate(const FloatSize& scrollDelta) const
+    {
+        FloatSize offset;
+        for (auto& term : m_horizontalTerms)
+            offset.setWidth(offset.width() + term.evaluate(scrollDelta.width()));
+        for (auto& term : m_verticalTerms)
+            offset.setHeight(offset.height() + term.evaluate(scrollDelta.height()));
+        return offset;
+    }
+
+    bool operator==(const ScrollLinkedExpression& other) const
+    {
+        return m_horizontalTerms == other.m_horizontalTerms && m_verticalTerms == other.m_verticalTerms;
+    }
+
+    bool operator!=(const ScrollLinkedExpression& other) const { return !(*this == other); }
+
+private:
+    Terms m_horizontalTerms;
+    Terms m_verticalTerms;
+};
+
+} // namespace WebCore
+
+#endif // ScrollLinkedExpression_h
@@ -215,6 +215,33 @@ inline unsigned WidthIterator::advanceInternal(TextIterator& textIterator, Glyph
     unsigned clusterLength = 0;
     CharactersTreatedAsSpace charactersTreatedAsSpace;
     String normalizedSpacesStringCache;
+
+    // Plain width measurement — no glyph buffer to fill, no letter/word spacing or justification,
+    // no kerning or shaping, no tabs and no glyph bounds tracking — only ever sums cached glyph
+    // advances, so most of the per-character branches below are dead. Sum the advances in a tight
+    // loop instead, falling through to the general loop if we hit a character the primary font
+    // cannot produce a glyph for. The accumulation order and rounding state match the general
+    // loop exactly; callers measure runs in pieces and the results must not drift.
+    if (!glyphBuffer && !hasExtraSpacing && !m_accountForGlyphBounds && !m_forTextEmphasis
+        && !(m_enableKerning || m_requiresShaping) && !m_run.allowTabs() && m_run.horizontalGlyphStretch() == 1) {
+        while (textIterator.consume(character, clusterLength)) {
+            unsigned advanceLength = clusterLength;
+            int currentCharacter = textIterator.currentCharacter();
+            const GlyphData& glyphData = glyphDataForCharacter(character, rtl, currentCharacter, advanceLength, normalizedSpacesStringCache);
+            if (!glyphData.glyph) {
+                textIterator.advance(advanceLength);
+                continue;
+            }
+            // Let the general loop below take over for fallback fonts; it tracks them for the caller.
+            if (glyphData.font != &primaryFont)
+                break;
+            textIterator.advance(advanceLength);
+            widthSinceLastRounding += primaryFont.widthForGlyph(glyphData.glyph);
+            lastRoundingWidth = 0;
+            previousCharacter = character;
+        }
+    }
+
     // We are iterating in string order, not glyph order. Compare this to ComplexTextController::adjustGlyphsAndAdvances()
     while (textIterator.consume(character, clusterLength)) {
         unsigned advanceLength = clusterLength;
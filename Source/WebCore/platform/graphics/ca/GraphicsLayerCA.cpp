@@ -828,8 +828,23 @@ void GraphicsLayerCA::setNeedsDisplayInRect(const FloatRect& r, ShouldClipToLaye
     
     if (m_dirtyRects.size() < maxDirtyRects)
         m_dirtyRects.append(rect);
-    else
-        m_dirtyRects[0].unite(rect);
+    else {
+        // The list is full. Merge the new rect into the existing dirty rect whose union grows
+        // the least, so many small invalidations stay as small disjoint rects instead of all
+        // piling into one huge rect that repaints most of the layer.
+        size_t bestIndex = 0;
+        float leastAddedArea = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < m_dirtyRects.size(); ++i) {
+            FloatRect unionRect = m_dirtyRects[i];
+            unionRect.unite(rect);
+            float addedArea = unionRect.width() * unionRect.height() - m_dirtyRects[i].width() * m_dirtyRects[i].height();
+            if (addedArea < leastAddedArea) {
+                leastAddedArea = addedArea;
+                bestIndex = i;
+            }
+        }
+        m_dirtyRects[bestIndex].unite(rect);
+    }
 
     noteLayerPropertyChanged(DirtyRectsChanged);
 
@@ -1418,6 +1433,9 @@ void GraphicsLayerCA::recursiveCommitChanges(const CommitState& commitState, con
     if (hadChanges)
         client().didCommitChangesForLayer(this);
 
+    // The display list acts as a per-layer paint cache: we re-record only when the layer took
+    // new dirty rects, and platformCALayerPaintContents() replays it for each tile that needs
+    // display, with the replayer culling items whose extents miss the tile clip.
     if (usesDisplayListDrawing() && m_drawsContent && (!m_hasEverPainted || hadDirtyRects)) {
 #ifdef LOG_RECORDING_TIME
         double startTime = currentTime();
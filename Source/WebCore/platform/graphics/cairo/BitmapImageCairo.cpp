@@ -64,6 +64,22 @@ BitmapImage::BitmapImage(PassRefPtr<cairo_surface_t> nativeImage, ImageObserver*
     checkForSolidColor();
 }
 
+static RefPtr<cairo_surface_t> createScaledSurface(cairo_surface_t* surface, const IntSize& sourceSize, const IntSize& scaledSize)
+{
+    RefPtr<cairo_surface_t> scaledSurface = adoptRef(cairo_surface_create_similar(surface, cairo_surface_get_content(surface), scaledSize.width(), scaledSize.height()));
+    if (cairo_surface_status(scaledSurface.get()) != CAIRO_STATUS_SUCCESS)
+        return nullptr;
+
+    RefPtr<cairo_t> cr = adoptRef(cairo_create(scaledSurface.get()));
+    cairo_scale(cr.get(), static_cast<double>(scaledSize.width()) / sourceSize.width(), static_cast<double>(scaledSize.height()) / sourceSize.height());
+    cairo_set_source_surface(cr.get(), surface, 0, 0);
+    cairo_pattern_set_filter(cairo_get_source(cr.get()), CAIRO_FILTER_GOOD);
+    cairo_pattern_set_extend(cairo_get_source(cr.get()), CAIRO_EXTEND_PAD);
+    cairo_set_operator(cr.get(), CAIRO_OPERATOR_SOURCE);
+    cairo_paint(cr.get());
+    return scaledSurface;
+}
+
 void BitmapImage::draw(GraphicsContext& context, const FloatRect& dst, const FloatRect& src, CompositeOperator op,
     BlendMode blendMode, ImageOrientationDescription description)
 {
@@ -114,6 +130,26 @@ void BitmapImage::draw(GraphicsContext& context, const FloatRect& dst, const Flo
         }
     }
 
+    // Themed UIs redraw the same still image at the same non-integral scale every frame,
+    // which makes pixman refilter every destination pixel per draw. Keep the most recent
+    // scaled variant around and blit it 1:1 when the same scale comes back.
+    if (frameCount() == 1 && frameOrientation == DefaultImageOrientation
+        && context.imageInterpolationQuality() != InterpolationNone && context.imageInterpolationQuality() != InterpolationLow) {
+        IntSize surfaceSize = cairoSurfaceSize(surface.get());
+        IntSize scaledSize = roundedIntSize(dstRect.size());
+        if (adjustedSrcRect == FloatRect(FloatPoint(), surfaceSize) && dstRect.size() == FloatSize(scaledSize)
+            && scaledSize != surfaceSize && !scaledSize.isEmpty()) {
+            if (!m_scaledSurface || m_scaledSurfaceSize != scaledSize) {
+                m_scaledSurface = createScaledSurface(surface.get(), surfaceSize, scaledSize);
+                m_scaledSurfaceSize = scaledSize;
+            }
+            if (m_scaledSurface) {
+                surface = m_scaledSurface;
+                adjustedSrcRect = FloatRect(FloatPoint(), scaledSize);
+            }
+        }
+    }
+
     context.platformContext()->drawSurfaceToContext(surface.get(), dstRect, adjustedSrcRect, context);
 
     context.restore();
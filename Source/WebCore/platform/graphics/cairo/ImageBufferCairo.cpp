@@ -542,7 +542,9 @@ bool ImageBuffer::copyToPlatformTexture(GraphicsContext3D&, GC3Denum target, Pla
 
     cairo_surface_flush(m_data.m_surface.get());
 
-    std::unique_ptr<GLContext> context = GLContext::createContextForWindow(0, GLContext::sharingContext());
+    // This path runs for every texImage2D upload from an accelerated canvas, so keep one
+    // offscreen context around instead of creating and destroying one per copy.
+    DEPRECATED_DEFINE_STATIC_LOCAL(std::unique_ptr<GLContext>, context, (GLContext::createOffscreenContext(GLContext::sharingContext())));
     context->makeContextCurrent();
     uint32_t fbo;
     glGenFramebuffers(1, &fbo);
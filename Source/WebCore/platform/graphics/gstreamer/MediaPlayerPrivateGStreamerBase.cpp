@@ -522,6 +522,9 @@ void MediaPlayerPrivateGStreamerBase::repaint()
     if (supportsAcceleratedRendering() && m_player->client().mediaPlayerRenderingCanBeAccelerated(m_player) && client()) {
         client()->setPlatformLayerNeedsDisplay();
 #if USE(GSTREAMER_GL)
+        // Take the lock so the notification can't slip in between the streaming thread
+        // starting the draw timer and blocking on the condition.
+        LockHolder locker(m_drawMutex);
         m_drawCondition.notifyOne();
 #endif
         return;
@@ -531,6 +534,7 @@ void MediaPlayerPrivateGStreamerBase::repaint()
     m_player->repaint();
 
 #if USE(GSTREAMER_GL)
+    LockHolder locker(m_drawMutex);
     m_drawCondition.notifyOne();
 #endif
 }
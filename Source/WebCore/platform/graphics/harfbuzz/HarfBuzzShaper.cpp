@@ -31,15 +31,20 @@
 #include "config.h"
 #include "HarfBuzzShaper.h"
 
+#include "FontCache.h"
 #include "FontCascade.h"
 #include "HarfBuzzFace.h"
+#include "Logging.h"
 #include "SurrogatePairAwareTextIterator.h"
 #include <hb-icu.h>
 #include <unicode/normlzr.h>
 #include <unicode/uchar.h>
+#include <wtf/HashMap.h>
 #include <wtf/MathExtras.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
 #include <wtf/text/StringView.h>
 
 namespace WebCore {
@@ -81,9 +86,67 @@ HarfBuzzShaper::HarfBuzzRun::HarfBuzzRun(const Font* fontData, unsigned startInd
 {
 }
 
-void HarfBuzzShaper::HarfBuzzRun::applyShapeResult(hb_buffer_t* harfBuzzBuffer)
+// Layouts keep shaping the same short strings with the same fonts - menus, labels and grid
+// cells repeat identical runs thousands of times - so we remember the raw HarfBuzz output for
+// recently shaped runs. Letter spacing, word spacing and justification are applied after the
+// cache, so an entry only depends on the inputs that are handed to hb_shape().
+struct ShapedRunCacheEntry {
+    RefPtr<const Font> font;
+    hb_script_t script;
+    hb_direction_t direction;
+    bool directionWasSet;
+    bool verticalSubstitution;
+    Vector<hb_feature_t, 4> features;
+    Vector<hb_glyph_info_t> glyphInfos;
+    Vector<hb_glyph_position_t> glyphPositions;
+};
+
+typedef Vector<std::unique_ptr<ShapedRunCacheEntry>, 1> ShapedRunCacheEntries;
+typedef HashMap<String, ShapedRunCacheEntries> ShapedRunCache;
+
+static const unsigned maximumShapedRunCacheSize = 512;
+
+static ShapedRunCache& shapedRunCache()
+{
+    static NeverDestroyed<ShapedRunCache> cache;
+    return cache;
+}
+
+static void invalidateShapedRunCacheIfNeeded()
+{
+    static unsigned short shapedRunCacheGeneration;
+    unsigned short generation = FontCache::singleton().generation();
+    if (generation == shapedRunCacheGeneration)
+        return;
+    shapedRunCache().clear();
+    shapedRunCacheGeneration = generation;
+}
+
+static bool shapedRunFeaturesMatch(const Vector<hb_feature_t, 4>& a, const Vector<hb_feature_t, 4>& b)
+{
+    if (a.size() != b.size())
+        return false;
+    return a.isEmpty() || !memcmp(a.data(), b.data(), a.size() * sizeof(hb_feature_t));
+}
+
+static inline void recordShapedRunCacheLookup(bool hit)
+{
+#if !LOG_DISABLED
+    static unsigned lookupCount;
+    static unsigned hitCount;
+    ++lookupCount;
+    if (hit)
+        ++hitCount;
+    if (!(lookupCount % 4096))
+        LOG(Layout, "Shaped run cache: %u hits out of %u lookups", hitCount, lookupCount);
+#else
+    UNUSED_PARAM(hit);
+#endif
+}
+
+void HarfBuzzShaper::HarfBuzzRun::applyShapeResult(unsigned numGlyphs)
 {
-    m_numGlyphs = hb_buffer_get_length(harfBuzzBuffer);
+    m_numGlyphs = numGlyphs;
     m_glyphs.resize(m_numGlyphs);
     m_advances.resize(m_numGlyphs);
     m_glyphToCharacterIndexes.resize(m_numGlyphs);
@@ -462,6 +525,10 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns(bool shouldSetDirection)
 
     hb_buffer_set_unicode_funcs(harfBuzzBuffer.get(), hb_icu_get_unicode_funcs());
 
+    invalidateShapedRunCacheIfNeeded();
+
+    bool verticalSubstitution = m_font->fontDescription().orientation() == Vertical;
+
     for (unsigned i = 0; i < m_harfBuzzRuns.size(); ++i) {
         unsigned runIndex = m_run.rtl() ? m_harfBuzzRuns.size() - i - 1 : i;
         HarfBuzzRun* currentRun = m_harfBuzzRuns[runIndex].get();
@@ -469,9 +536,37 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns(bool shouldSetDirection)
         if (currentFontData->isSVGFont())
             return false;
 
+        hb_direction_t direction = currentRun->rtl() ? HB_DIRECTION_RTL : HB_DIRECTION_LTR;
+
+        String runText(m_normalizedBuffer.get() + currentRun->startIndex(), currentRun->numCharacters());
+        if (m_font->isSmallCaps() && u_islower(m_normalizedBuffer[currentRun->startIndex()])) {
+            runText = runText.convertToUppercaseWithoutLocale();
+            currentFontData = m_font->glyphDataForCharacter(runText[0], false, SmallCapsVariant).font;
+        }
+
+        ShapedRunCacheEntry* cachedEntry = nullptr;
+        auto cacheIterator = shapedRunCache().find(runText);
+        if (cacheIterator != shapedRunCache().end()) {
+            for (auto& entry : cacheIterator->value) {
+                if (entry->font == currentFontData && entry->script == currentRun->script()
+                    && entry->directionWasSet == shouldSetDirection && (!shouldSetDirection || entry->direction == direction)
+                    && entry->verticalSubstitution == verticalSubstitution && shapedRunFeaturesMatch(entry->features, m_features)) {
+                    cachedEntry = entry.get();
+                    break;
+                }
+            }
+        }
+        recordShapedRunCacheLookup(cachedEntry);
+
+        if (cachedEntry) {
+            currentRun->applyShapeResult(cachedEntry->glyphInfos.size());
+            setGlyphPositionsForHarfBuzzRun(currentRun, cachedEntry->glyphInfos.data(), cachedEntry->glyphPositions.data());
+            continue;
+        }
+
         hb_buffer_set_script(harfBuzzBuffer.get(), currentRun->script());
         if (shouldSetDirection)
-            hb_buffer_set_direction(harfBuzzBuffer.get(), currentRun->rtl() ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
+            hb_buffer_set_direction(harfBuzzBuffer.get(), direction);
         else
             // Leaving direction to HarfBuzz to guess is *really* bad, but will do for now.
             hb_buffer_guess_segment_properties(harfBuzzBuffer.get());
@@ -481,28 +576,42 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns(bool shouldSetDirection)
         static const uint16_t preContext = ' ';
         hb_buffer_add_utf16(harfBuzzBuffer.get(), &preContext, 1, 1, 0);
 
-        if (m_font->isSmallCaps() && u_islower(m_normalizedBuffer[currentRun->startIndex()])) {
-            String upperText = String(m_normalizedBuffer.get() + currentRun->startIndex(), currentRun->numCharacters()).convertToUppercaseWithoutLocale();
-            currentFontData = m_font->glyphDataForCharacter(upperText[0], false, SmallCapsVariant).font;
-            const UChar* characters = StringView(upperText).upconvertedCharacters();
-            hb_buffer_add_utf16(harfBuzzBuffer.get(), reinterpret_cast<const uint16_t*>(characters), currentRun->numCharacters(), 0, currentRun->numCharacters());
-        } else
-            hb_buffer_add_utf16(harfBuzzBuffer.get(), reinterpret_cast<const uint16_t*>(m_normalizedBuffer.get() + currentRun->startIndex()), currentRun->numCharacters(), 0, currentRun->numCharacters());
+        {
+            auto upconvertedCharacters = StringView(runText).upconvertedCharacters();
+            hb_buffer_add_utf16(harfBuzzBuffer.get(), reinterpret_cast<const uint16_t*>(static_cast<const UChar*>(upconvertedCharacters)), currentRun->numCharacters(), 0, currentRun->numCharacters());
+        }
 
         FontPlatformData* platformData = const_cast<FontPlatformData*>(&currentFontData->platformData());
         HarfBuzzFace* face = platformData->harfBuzzFace();
         if (!face)
             return false;
 
-        if (m_font->fontDescription().orientation() == Vertical)
+        if (verticalSubstitution)
             face->setScriptForVerticalGlyphSubstitution(harfBuzzBuffer.get());
 
         HarfBuzzScopedPtr<hb_font_t> harfBuzzFont(face->createFont(), hb_font_destroy);
 
         hb_shape(harfBuzzFont.get(), harfBuzzBuffer.get(), m_features.isEmpty() ? 0 : m_features.data(), m_features.size());
 
-        currentRun->applyShapeResult(harfBuzzBuffer.get());
-        setGlyphPositionsForHarfBuzzRun(currentRun, harfBuzzBuffer.get());
+        unsigned numGlyphs = hb_buffer_get_length(harfBuzzBuffer.get());
+        const hb_glyph_info_t* glyphInfos = hb_buffer_get_glyph_infos(harfBuzzBuffer.get(), nullptr);
+        const hb_glyph_position_t* glyphPositions = hb_buffer_get_glyph_positions(harfBuzzBuffer.get(), nullptr);
+
+        currentRun->applyShapeResult(numGlyphs);
+        setGlyphPositionsForHarfBuzzRun(currentRun, glyphInfos, glyphPositions);
+
+        auto newEntry = std::make_unique<ShapedRunCacheEntry>();
+        newEntry->font = currentFontData;
+        newEntry->script = currentRun->script();
+        newEntry->direction = direction;
+        newEntry->directionWasSet = shouldSetDirection;
+        newEntry->verticalSubstitution = verticalSubstitution;
+        newEntry->features = m_features;
+        newEntry->glyphInfos.append(glyphInfos, numGlyphs);
+        newEntry->glyphPositions.append(glyphPositions, numGlyphs);
+        if (shapedRunCache().size() >= maximumShapedRunCacheSize)
+            shapedRunCache().clear();
+        shapedRunCache().add(runText, ShapedRunCacheEntries()).iterator->value.append(WTFMove(newEntry));
 
         hb_buffer_reset(harfBuzzBuffer.get());
     }
@@ -510,12 +619,9 @@ bool HarfBuzzShaper::shapeHarfBuzzRuns(bool shouldSetDirection)
     return true;
 }
 
-void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, hb_buffer_t* harfBuzzBuffer)
+void HarfBuzzShaper::setGlyphPositionsForHarfBuzzRun(HarfBuzzRun* currentRun, const hb_glyph_info_t* glyphInfos, const hb_glyph_position_t* glyphPositions)
 {
     const Font* currentFontData = currentRun->fontData();
-    hb_glyph_info_t* glyphInfos = hb_buffer_get_glyph_infos(harfBuzzBuffer, 0);
-    hb_glyph_position_t* glyphPositions = hb_buffer_get_glyph_positions(harfBuzzBuffer, 0);
-
     unsigned numGlyphs = currentRun->numGlyphs();
     uint16_t* glyphToCharacterIndexes = currentRun->glyphToCharacterIndexes();
     float totalAdvance = 0;
@@ -66,7 +66,7 @@ private:
     public:
         HarfBuzzRun(const Font*, unsigned startIndex, unsigned numCharacters, TextDirection, hb_script_t);
 
-        void applyShapeResult(hb_buffer_t*);
+        void applyShapeResult(unsigned numGlyphs);
         void setGlyphAndPositions(unsigned index, uint16_t glyphId, float advance, float offsetX, float offsetY);
         void setWidth(float width) { m_width = width; }
 
@@ -116,7 +116,7 @@ private:
     bool shapeHarfBuzzRuns(bool shouldSetDirection);
     bool fillGlyphBuffer(GlyphBuffer*);
     void fillGlyphBufferFromHarfBuzzRun(GlyphBuffer*, HarfBuzzRun*, FloatPoint& firstOffsetOfNextRun);
-    void setGlyphPositionsForHarfBuzzRun(HarfBuzzRun*, hb_buffer_t*);
+    void setGlyphPositionsForHarfBuzzRun(HarfBuzzRun*, const hb_glyph_info_t*, const hb_glyph_position_t*);
 
     GlyphBufferAdvance createGlyphBufferAdvance(float, float);
 
@@ -27,6 +27,9 @@
 #include "config.h"
 #include "BitmapTexturePool.h"
 
+#include "Logging.h"
+#include "MemoryPressureHandler.h"
+
 #if USE(TEXTURE_MAPPER_GL)
 #include "BitmapTextureGL.h"
 #endif
@@ -35,6 +38,14 @@ namespace WebCore {
 
 static const double s_releaseUnusedSecondsTolerance = 3;
 static const double s_releaseUnusedTexturesTimerInterval = 0.5;
+static const size_t s_maximumPooledBytes = 32 * 1024 * 1024;
+
+static size_t approximateBytesForTexture(const BitmapTexture& texture)
+{
+    // Pooled textures use four bytes per pixel.
+    IntSize size = texture.size();
+    return size.width() * size.height() * 4;
+}
 
 #if USE(TEXTURE_MAPPER_GL)
 BitmapTexturePool::BitmapTexturePool(RefPtr<GraphicsContext3D>&& context3D)
@@ -72,7 +83,9 @@ void BitmapTexturePool::scheduleReleaseUnusedTextures()
 void BitmapTexturePool::releaseUnusedTexturesTimerFired()
 {
     // Delete entries, which have been unused in s_releaseUnusedSecondsTolerance.
-    double minUsedTime = monotonicallyIncreasingTime() - s_releaseUnusedSecondsTolerance;
+    // Under memory pressure, don't keep unused textures around at all.
+    double releaseUnusedSecondsTolerance = MemoryPressureHandler::singleton().isUnderMemoryPressure() ? 0 : s_releaseUnusedSecondsTolerance;
+    double minUsedTime = monotonicallyIncreasingTime() - releaseUnusedSecondsTolerance;
 
     if (!m_textures.isEmpty()) {
         std::sort(m_textures.begin(), m_textures.end(),
@@ -98,10 +111,29 @@ void BitmapTexturePool::releaseUnusedTexturesTimerFired()
         }
     }
 
+    // Recently used entries may still hold more memory than we want to retain; both lists are
+    // sorted most recently used first now, so trim the least recently used entries past the budget.
+    size_t remainingBytes = s_maximumPooledBytes;
+    enforceByteBudget(m_textures, remainingBytes);
+    enforceByteBudget(m_attachmentTextures, remainingBytes);
+
     if (!m_textures.isEmpty() || !m_attachmentTextures.isEmpty())
         scheduleReleaseUnusedTextures();
 }
 
+void BitmapTexturePool::enforceByteBudget(Vector<Entry>& list, size_t& remainingBytes)
+{
+    for (size_t i = 0; i < list.size(); ++i) {
+        size_t entryBytes = approximateBytesForTexture(*list[i].m_texture);
+        if (entryBytes > remainingBytes) {
+            LOG(MemoryPressure, "BitmapTexturePool::enforceByteBudget() - releasing %zu least recently used textures", list.size() - i);
+            list.remove(i, list.size() - i);
+            return;
+        }
+        remainingBytes -= entryBytes;
+    }
+}
+
 RefPtr<BitmapTexture> BitmapTexturePool::createTexture(const BitmapTexture::Flags flags)
 {
 #if USE(TEXTURE_MAPPER_GL)
@@ -64,6 +64,7 @@ private:
 
     void scheduleReleaseUnusedTextures();
     void releaseUnusedTexturesTimerFired();
+    void enforceByteBudget(Vector<Entry>&, size_t& remainingBytes);
     RefPtr<BitmapTexture> createTexture(const BitmapTexture::Flags);
 
 #if USE(TEXTURE_MAPPER_GL)
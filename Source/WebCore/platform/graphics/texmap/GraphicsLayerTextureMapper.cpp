@@ -610,8 +610,21 @@ bool GraphicsLayerTextureMapper::setFilters(const FilterOperations& filters)
     TextureMapper* textureMapper = m_layer.textureMapper();
     if (!textureMapper)
         return false;
-    notifyChange(FilterChange);
-    return GraphicsLayer::setFilters(filters);
+
+    bool canCompositeFilters = TextureMapperLayer::filtersCanBeComposited(filters);
+    if (this->filters() == filters)
+        return canCompositeFilters;
+
+    if (canCompositeFilters) {
+        GraphicsLayer::setFilters(filters);
+        notifyChange(FilterChange);
+    } else if (this->filters().size()) {
+        // In this case filters are rendered in software, so we need to remove any
+        // previously attached hardware filters.
+        clearFilters();
+        notifyChange(FilterChange);
+    }
+    return canCompositeFilters;
 }
 
 void GraphicsLayerTextureMapper::setFixedToViewport(bool fixed)
@@ -610,6 +610,35 @@ void TextureMapperLayer::setFilters(const FilterOperations& filters)
     m_state.filters = filters;
 }
 
+bool TextureMapperLayer::filtersCanBeComposited(const FilterOperations& filters)
+{
+    // Return false if there are no filters to avoid needless work.
+    if (!filters.size())
+        return false;
+
+    for (const auto& filterOperation : filters.operations()) {
+        switch (filterOperation->type()) {
+        case FilterOperation::GRAYSCALE:
+        case FilterOperation::SEPIA:
+        case FilterOperation::SATURATE:
+        case FilterOperation::HUE_ROTATE:
+        case FilterOperation::INVERT:
+        case FilterOperation::BRIGHTNESS:
+        case FilterOperation::CONTRAST:
+        case FilterOperation::OPACITY:
+        case FilterOperation::BLUR:
+        case FilterOperation::DROP_SHADOW:
+            break;
+        default:
+            // Reference filters and anything else without a shader pass have to be
+            // rendered in software by FilterEffectRenderer.
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void TextureMapperLayer::setDebugVisuals(bool showDebugBorders, const Color& debugBorderColor, float debugBorderWidth, bool showRepaintCounter)
 {
     m_state.showDebugBorders = showDebugBorders;
@@ -638,6 +667,11 @@ void TextureMapperLayer::setFixedToViewport(bool fixedToViewport)
     m_fixedToViewport = fixedToViewport;
 }
 
+void TextureMapperLayer::setScrollLinkedExpression(const ScrollLinkedExpression& expression)
+{
+    m_scrollLinkedExpression = expression;
+}
+
 void TextureMapperLayer::setBackingStore(PassRefPtr<TextureMapperBackingStore> backingStore)
 {
     m_backingStore = backingStore;
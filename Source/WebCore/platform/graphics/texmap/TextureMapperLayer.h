@@ -23,6 +23,7 @@
 #include "FilterOperations.h"
 #include "FloatRect.h"
 #include "GraphicsLayerTransform.h"
+#include "ScrollLinkedExpression.h"
 #include "TextureMapper.h"
 #include "TextureMapperAnimation.h"
 #include "TextureMapperBackingStore.h"
@@ -105,6 +106,10 @@ public:
     void setContentsTilePhase(const FloatSize&);
     void setFilters(const FilterOperations&);
 
+    // Returns true when every operation in the list maps to one of the GLSL filter
+    // passes in TextureMapperGL, so the whole list can run on the composited texture.
+    static bool filtersCanBeComposited(const FilterOperations&);
+
     bool hasFilters() const
     {
         return !m_currentFilters.isEmpty();
@@ -117,6 +122,9 @@ public:
     void setAnimations(const TextureMapperAnimations&);
     void setFixedToViewport(bool);
     bool fixedToViewport() const { return m_fixedToViewport; }
+
+    void setScrollLinkedExpression(const ScrollLinkedExpression&);
+    const ScrollLinkedExpression& scrollLinkedExpression() const { return m_scrollLinkedExpression; }
     void setBackingStore(PassRefPtr<TextureMapperBackingStore>);
 
     void syncAnimations();
@@ -252,6 +260,7 @@ private:
     TextureMapperAnimations m_animations;
     FloatSize m_scrollPositionDelta;
     bool m_fixedToViewport;
+    ScrollLinkedExpression m_scrollLinkedExpression;
     uint32_t m_id;
     ScrollingClient* m_scrollClient;
     bool m_isScrollable;
@@ -33,6 +33,7 @@
 #include "GraphicsLayerFactory.h"
 #include "Page.h"
 #include "ScrollableArea.h"
+#include "TextureMapperLayer.h"
 #include <wtf/CurrentTime.h>
 #include <wtf/HashMap.h>
 #ifndef NDEBUG
@@ -433,14 +434,21 @@ void CoordinatedGraphicsLayer::setContentsToPlatformLayer(PlatformLayer* platfor
 
 bool CoordinatedGraphicsLayer::setFilters(const FilterOperations& newFilters)
 {
+    bool canCompositeFilters = TextureMapperLayer::filtersCanBeComposited(newFilters);
     if (filters() == newFilters)
-        return true;
-
-    if (!GraphicsLayer::setFilters(newFilters))
-        return false;
-
-    didChangeFilters();
-    return true;
+        return canCompositeFilters;
+
+    if (canCompositeFilters) {
+        if (!GraphicsLayer::setFilters(newFilters))
+            return false;
+        didChangeFilters();
+    } else if (filters().size()) {
+        // In this case filters are rendered in software, so we need to remove any
+        // previously attached hardware filters.
+        clearFilters();
+        didChangeFilters();
+    }
+    return canCompositeFilters;
 }
 
 void CoordinatedGraphicsLayer::setContentsToSolidColor(const Color& color)
@@ -585,6 +593,18 @@ void CoordinatedGraphicsLayer::setFixedToViewport(bool isFixed)
     didChangeLayerState();
 }
 
+void CoordinatedGraphicsLayer::setScrollLinkedExpression(const ScrollLinkedExpression& expression)
+{
+    if (m_scrollLinkedExpression == expression)
+        return;
+
+    m_scrollLinkedExpression = expression;
+    m_layerState.scrollLinkedExpression = expression;
+    m_layerState.scrollLinkedExpressionChanged = true;
+
+    didChangeLayerState();
+}
+
 void CoordinatedGraphicsLayer::flushCompositingState(const FloatRect& rect, bool viewportIsStable)
 {
     if (notifyFlushRequired())
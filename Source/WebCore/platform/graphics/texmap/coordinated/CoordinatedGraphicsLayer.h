@@ -128,6 +128,7 @@ public:
     CoordinatedLayerID id() const { return m_id; }
 
     void setFixedToViewport(bool isFixed);
+    void setScrollLinkedExpression(const ScrollLinkedExpression&);
 
     IntRect coverRect() const { return m_mainBackingStore ? m_mainBackingStore->mapToContents(m_mainBackingStore->coverRect()) : IntRect(); }
     IntRect transformedVisibleRect();
@@ -212,6 +213,7 @@ private:
     FloatSize m_pixelAlignmentOffset;
     FloatSize m_adjustedSize;
     FloatPoint m_adjustedPosition;
+    ScrollLinkedExpression m_scrollLinkedExpression;
     FloatPoint3D m_adjustedAnchorPoint;
 
 #ifndef NDEBUG
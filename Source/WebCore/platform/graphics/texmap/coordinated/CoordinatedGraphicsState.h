@@ -35,6 +35,7 @@
 #include "FloatSize.h"
 #include "IntRect.h"
 #include "IntSize.h"
+#include "ScrollLinkedExpression.h"
 #include "SurfaceUpdateInfo.h"
 #include "TextureMapperAnimation.h"
 #include "TransformationMatrix.h"
@@ -95,6 +96,7 @@ struct CoordinatedGraphicsLayerState {
             bool isScrollableChanged: 1;
             bool committedScrollOffsetChanged: 1;
             bool contentsTilingChanged: 1;
+            bool scrollLinkedExpressionChanged: 1;
         };
         unsigned changeMask;
     };
@@ -176,6 +178,7 @@ struct CoordinatedGraphicsLayerState {
 #endif
 
     IntSize committedScrollOffset;
+    ScrollLinkedExpression scrollLinkedExpression;
 
     bool hasPendingChanges() const
     {
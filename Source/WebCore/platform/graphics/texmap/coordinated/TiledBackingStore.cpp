@@ -22,8 +22,11 @@
 
 #if USE(COORDINATED_GRAPHICS)
 #include "GraphicsContext.h"
+#include "MemoryPressureHandler.h"
 #include "TiledBackingStoreClient.h"
+#include <algorithm>
 #include <wtf/CheckedArithmetic.h>
+#include <wtf/CurrentTime.h>
 
 namespace WebCore {
 
@@ -39,6 +42,8 @@ TiledBackingStore::TiledBackingStore(TiledBackingStoreClient* client, float cont
     : m_client(client)
     , m_tileSize(defaultTileDimension, defaultTileDimension)
     , m_coverAreaMultiplier(2.0f)
+    , m_trajectoryVelocity(0)
+    , m_pendingTrajectoryVelocity(0)
     , m_contentsScale(contentsScale)
     , m_supportsAlpha(false)
     , m_pendingTileCreation(false)
@@ -51,6 +56,9 @@ TiledBackingStore::~TiledBackingStore()
 
 void TiledBackingStore::setTrajectoryVector(const FloatPoint& trajectoryVector)
 {
+    // Keep the magnitude around; it is the scroll velocity in pixels and scales how far ahead
+    // in the scroll direction tiles are created.
+    m_pendingTrajectoryVelocity = trajectoryVector.length();
     m_pendingTrajectoryVector = trajectoryVector;
     m_pendingTrajectoryVector.normalize();
 }
@@ -60,7 +68,7 @@ void TiledBackingStore::createTilesIfNeeded(const IntRect& unscaledVisibleRect,
     IntRect scaledContentsRect = mapFromContents(contentsRect);
     IntRect visibleRect = mapFromContents(unscaledVisibleRect);
 
-    bool didChange = m_trajectoryVector != m_pendingTrajectoryVector || m_visibleRect != visibleRect || m_rect != scaledContentsRect;
+    bool didChange = m_trajectoryVector != m_pendingTrajectoryVector || m_trajectoryVelocity != m_pendingTrajectoryVelocity || m_visibleRect != visibleRect || m_rect != scaledContentsRect;
     if (didChange || m_pendingTileCreation)
         createTiles(visibleRect, scaledContentsRect);
 }
@@ -90,19 +98,45 @@ void TiledBackingStore::invalidate(const IntRect& contentsDirtyRect)
 
 void TiledBackingStore::updateTileBuffers()
 {
-    // FIXME: In single threaded case, tile back buffers could be updated asynchronously 
+    // FIXME: In single threaded case, tile back buffers could be updated asynchronously
     // one by one and then swapped to front in one go. This would minimize the time spent
     // blocking on tile updates.
-    bool updated = false;
+
+    // Update the tiles closest to the viewport first, under a fixed time budget. Visible tiles
+    // are always updated; speculative ones beyond the budget are deferred to the next pass so
+    // prepaint never steals a whole frame from the visible content.
+    static const double tileUpdateTimeBudget = 0.008;
+
+    Vector<Tile*> dirtyTiles;
     for (auto& tile : m_tiles.values()) {
-        if (!tile->isDirty())
-            continue;
+        if (tile->isDirty())
+            dirtyTiles.append(tile.get());
+    }
 
+    if (dirtyTiles.isEmpty())
+        return;
+
+    std::sort(dirtyTiles.begin(), dirtyTiles.end(), [this](Tile* a, Tile* b) {
+        return tileDistance(m_visibleRect, a->coordinate()) < tileDistance(m_visibleRect, b->coordinate());
+    });
+
+    double updateStartTime = monotonicallyIncreasingTime();
+
+    bool updated = false;
+    bool ranOutOfBudget = false;
+    for (auto* tile : dirtyTiles) {
+        if (tileDistance(m_visibleRect, tile->coordinate()) && monotonicallyIncreasingTime() - updateStartTime > tileUpdateTimeBudget) {
+            ranOutOfBudget = true;
+            break;
+        }
         updated |= tile->updateBackBuffer();
     }
 
     if (updated)
         m_client->didUpdateTileBuffers();
+
+    if (ranOutOfBudget)
+        m_client->tiledBackingStoreHasPendingTileCreation();
 }
 
 double TiledBackingStore::tileDistance(const IntRect& viewport, const Tile::Coordinate& tileCoordinate) const
@@ -149,6 +183,7 @@ void TiledBackingStore::createTiles(const IntRect& visibleRect, const IntRect& s
     const IntRect previousRect = m_rect;
     m_rect = scaledContentsRect;
     m_trajectoryVector = m_pendingTrajectoryVector;
+    m_trajectoryVelocity = m_pendingTrajectoryVelocity;
     m_visibleRect = visibleRect;
 
     if (m_rect.isEmpty()) {
@@ -287,6 +322,14 @@ void TiledBackingStore::computeCoverAndKeepRect(const IntRect& visibleRect, IntR
     coverRect = visibleRect;
     keepRect = visibleRect;
 
+    // Under memory pressure speculative tiles are the first thing to go: cover only what is
+    // visible and let setKeepRect() drop everything outside it.
+    if (MemoryPressureHandler::singleton().isUnderMemoryPressure()) {
+        adjustForContentsRect(coverRect);
+        keepRect = coverRect;
+        return;
+    }
+
     // If we cover more that the actual viewport we can be smart about which tiles we choose to render.
     if (m_coverAreaMultiplier > 1) {
         // The initial cover area covers equally in each direction, according to the coverAreaMultiplier.
@@ -307,11 +350,18 @@ void TiledBackingStore::computeCoverAndKeepRect(const IntRect& visibleRect, IntR
             // Multiply the vector by the distance to the edge of the cover area.
             float trajectoryVectorMultiplier = (m_coverAreaMultiplier - 1) / 2;
 
+            // The faster the scroll, the further ahead tiles are created, up to a bounded number
+            // of extra viewports, so flings meet painted tiles instead of checkerboard.
+            static const float maximumVelocityMultiplier = 3;
+            float viewportDimension = std::max<float>(std::max(visibleRect.width(), visibleRect.height()), 1);
+            float velocityMultiplier = 1 + std::min(m_trajectoryVelocity / viewportDimension, maximumVelocityMultiplier - 1);
+
             // Unite the visible rect with a "ghost" of the visible rect moved in the direction of the trajectory vector.
             coverRect = visibleRect;
-            coverRect.move(coverRect.width() * m_trajectoryVector.x() * trajectoryVectorMultiplier, coverRect.height() * m_trajectoryVector.y() * trajectoryVectorMultiplier);
+            coverRect.move(coverRect.width() * m_trajectoryVector.x() * trajectoryVectorMultiplier * velocityMultiplier, coverRect.height() * m_trajectoryVector.y() * trajectoryVectorMultiplier * velocityMultiplier);
 
             coverRect.unite(visibleRect);
+            keepRect.unite(coverRect);
         }
         ASSERT(keepRect.contains(coverRect));
     }
@@ -89,6 +89,8 @@ private:
 
     FloatPoint m_trajectoryVector;
     FloatPoint m_pendingTrajectoryVector;
+    float m_trajectoryVelocity;
+    float m_pendingTrajectoryVelocity;
     IntRect m_visibleRect;
 
     IntRect m_coverRect;
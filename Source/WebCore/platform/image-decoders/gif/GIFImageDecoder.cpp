@@ -325,6 +325,23 @@ void GIFImageDecoder::decode(unsigned haltAtFrame, GIFQuery query)
     if (query == GIFFrameCountQuery)
         return;
 
+    // If the requested frame was decoded before and then evicted to save memory,
+    // sequential decoding has already moved past it (or the reader was recreated and
+    // would start over at frame 0). Resume from the nearest preserved frame instead of
+    // re-decoding the whole animation: any complete frame whose disposal method is not
+    // DisposeOverwritePrevious can serve as the starting state of its successor in
+    // initFrameBuffer(). clearFrameBufferCache() always preserves such a frame.
+    if (haltAtFrame && haltAtFrame <= m_frameBufferCache.size() && m_frameBufferCache[haltAtFrame - 1].status() != ImageFrame::FrameComplete) {
+        size_t resumeFrame = haltAtFrame - 1;
+        while (resumeFrame) {
+            const ImageFrame& buffer = m_frameBufferCache[resumeFrame - 1];
+            if (buffer.status() == ImageFrame::FrameComplete && buffer.disposalMethod() != ImageFrame::DisposeOverwritePrevious)
+                break;
+            --resumeFrame;
+        }
+        m_reader->resumeDecodingAtFrame(resumeFrame);
+    }
+
     if (!m_reader->decode(GIFFullQuery, haltAtFrame)) {
         setFailed();
         return;
@@ -386,6 +386,22 @@ bool GIFImageReader::decode(GIFImageDecoder::GIFQuery query, unsigned haltAtFram
     return true;
 }
 
+void GIFImageReader::resumeDecodingAtFrame(size_t frameIndex)
+{
+    ASSERT(frameIndex <= m_frames.size());
+    if (frameIndex == m_currentDecodingFrame)
+        return;
+
+    // Frames between the resume point and the old position were decoded before and
+    // have exhausted their LZW block cursors; reset them so they can decode again.
+    // When jumping forward (a recreated reader after gifComplete()), the skipped
+    // frames still hold fresh state and the loop below does nothing.
+    size_t end = std::min(m_currentDecodingFrame + 1, m_frames.size());
+    for (size_t i = frameIndex; i < end; ++i)
+        m_frames[i]->clearDecodeState();
+    m_currentDecodingFrame = frameIndex;
+}
+
 // Parse incoming GIF data stream into internal data structures.
 // Return true if parsing has progressed or there is not enough data.
 // Return false if a fatal error is encountered.
@@ -201,6 +201,14 @@ public:
 
     bool decode(const unsigned char* data, size_t length, WebCore::GIFImageDecoder* client, bool* frameDecoded);
 
+    // Discards the LZW decoding state so decode() can be called again to rebuild the
+    // frame's pixels. The parse results (header, colormap and block positions) are kept.
+    void clearDecodeState()
+    {
+        m_lzwContext = nullptr;
+        m_currentLzwBlock = 0;
+    }
+
     bool isComplete() const { return m_isComplete; }
     void setComplete() { m_isComplete = true; }
     bool isHeaderDefined() const { return m_isHeaderDefined; }
@@ -250,6 +258,11 @@ public:
     // FIXME: haltAtFrame should be size_t.
     bool decode(WebCore::GIFImageDecoder::GIFQuery, unsigned haltAtFrame);
 
+    // Makes the next decode() call start at |frameIndex| instead of wherever sequential
+    // decoding last stopped, so frames evicted from the decoder's buffer cache can be
+    // rebuilt without re-decoding the whole animation from the first frame.
+    void resumeDecodingAtFrame(size_t frameIndex);
+
     size_t imagesCount() const
     {
         if (m_frames.isEmpty())
@@ -49,6 +49,10 @@
 #include <qcms.h>
 #endif
 
+#if HAVE(ARM_NEON_INTRINSICS)
+#include <arm_neon.h>
+#endif
+
 #if defined(PNG_LIBPNG_VER_MAJOR) && defined(PNG_LIBPNG_VER_MINOR) && (PNG_LIBPNG_VER_MAJOR > 1 || (PNG_LIBPNG_VER_MAJOR == 1 && PNG_LIBPNG_VER_MINOR >= 4))
 #define JMPBUF(png_ptr) png_jmpbuf(png_ptr)
 #else
@@ -525,6 +529,49 @@ static inline void setPixelPremultipliedRGBA(ImageFrame::PixelData* dest, png_by
     nonTrivialAlphaMask |= (255 - a);
 }
 
+#if HAVE(ARM_NEON_INTRINSICS)
+// The helpers below write pixels in the same a << 24 | r << 16 | g << 8 | b word layout as
+// setPixelRGB/setPixelRGBA; on this (little-endian) path the bytes land in memory as b, g, r, a.
+// Following the convention of the SIMD converters in FormatConverter, they consume as many
+// whole vectors as fit and update their arguments so the scalar loop handles the tail.
+
+static inline void setRowRGB(ImageFrame::PixelData*& address, png_bytep& pixel, int& width)
+{
+    int vectorSize = width & ~7;
+    uint8_t* destination = reinterpret_cast<uint8_t*>(address);
+    for (int x = 0; x < vectorSize; x += 8) {
+        uint8x8x3_t rgb = vld3_u8(pixel);
+        uint8x8x4_t bgra = {{ rgb.val[2], rgb.val[1], rgb.val[0], vdup_n_u8(0xFF) }};
+        vst4_u8(destination, bgra);
+        pixel += 8 * 3;
+        destination += 8 * 4;
+    }
+    address += vectorSize;
+    width -= vectorSize;
+}
+
+static inline void setRowRGBA(ImageFrame::PixelData*& address, png_bytep& pixel, int& width, unsigned char& nonTrivialAlphaMask)
+{
+    int vectorSize = width & ~7;
+    uint8_t* destination = reinterpret_cast<uint8_t*>(address);
+    uint8x8_t minimumAlpha = vdup_n_u8(0xFF);
+    for (int x = 0; x < vectorSize; x += 8) {
+        uint8x8x4_t rgba = vld4_u8(pixel);
+        minimumAlpha = vmin_u8(minimumAlpha, rgba.val[3]);
+        uint8x8x4_t bgra = {{ rgba.val[2], rgba.val[1], rgba.val[0], rgba.val[3] }};
+        vst4_u8(destination, bgra);
+        pixel += 8 * 4;
+        destination += 8 * 4;
+    }
+    minimumAlpha = vpmin_u8(minimumAlpha, minimumAlpha);
+    minimumAlpha = vpmin_u8(minimumAlpha, minimumAlpha);
+    minimumAlpha = vpmin_u8(minimumAlpha, minimumAlpha);
+    nonTrivialAlphaMask |= 0xFF - vget_lane_u8(minimumAlpha, 0);
+    address += vectorSize;
+    width -= vectorSize;
+}
+#endif // HAVE(ARM_NEON_INTRINSICS)
+
 void PNGImageDecoder::rowAvailable(unsigned char* rowBuffer, unsigned rowIndex, int)
 {
     if (m_frameBufferCache.isEmpty())
@@ -660,10 +707,16 @@ void PNGImageDecoder::rowAvailable(unsigned char* rowBuffer, unsigned rowIndex,
                 for (int x = 0; x < width; ++x, pixel += 4)
                     setPixelPremultipliedRGBA(address++, pixel, nonTrivialAlphaMask);
             } else {
+#if HAVE(ARM_NEON_INTRINSICS)
+                setRowRGBA(address, pixel, width, nonTrivialAlphaMask);
+#endif
                 for (int x = 0; x < width; ++x, pixel += 4)
                     setPixelRGBA(address++, pixel, nonTrivialAlphaMask);
             }
         } else {
+#if HAVE(ARM_NEON_INTRINSICS)
+            setRowRGB(address, pixel, width);
+#endif
             for (int x = 0; x < width; ++x, pixel += 3)
                 setPixelRGB(address++, pixel);
         }
@@ -33,6 +33,7 @@
 
 #include "Blob.h"
 #include "BlobURL.h"
+#include <algorithm>
 #include <wtf/PassRefPtr.h>
 #include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
@@ -89,6 +90,38 @@ void BlobData::appendFile(BlobDataFileReference* file, long long offset, long lo
 void BlobData::swapItems(BlobDataItemList& items)
 {
     m_items.swap(items);
+    // The item count may not have changed, so the size check in
+    // ensureCumulativeItemEndOffsets() is not enough to catch this.
+    m_cumulativeItemEndOffsets.clear();
+}
+
+void BlobData::ensureCumulativeItemEndOffsets() const
+{
+    // Items are only ever appended, so a matching count means the cache is current.
+    if (m_cumulativeItemEndOffsets.size() == m_items.size())
+        return;
+
+    m_cumulativeItemEndOffsets.clear();
+    m_cumulativeItemEndOffsets.reserveCapacity(m_items.size());
+    unsigned long long endOffset = 0;
+    for (const BlobDataItem& item : m_items) {
+        endOffset += item.length();
+        m_cumulativeItemEndOffsets.uncheckedAppend(endOffset);
+    }
+}
+
+unsigned long long BlobData::size() const
+{
+    ensureCumulativeItemEndOffsets();
+    return m_cumulativeItemEndOffsets.isEmpty() ? 0 : m_cumulativeItemEndOffsets.last();
+}
+
+size_t BlobData::itemIndexForPosition(unsigned long long position, unsigned long long& positionInItem) const
+{
+    ensureCumulativeItemEndOffsets();
+    size_t index = std::upper_bound(m_cumulativeItemEndOffsets.begin(), m_cumulativeItemEndOffsets.end(), position) - m_cumulativeItemEndOffsets.begin();
+    positionInItem = index ? position - m_cumulativeItemEndOffsets[index - 1] : position;
+    return index;
 }
 
 } // namespace WebCore
@@ -113,6 +113,14 @@ public:
     void appendData(const ThreadSafeDataBuffer&);
     void appendFile(PassRefPtr<BlobDataFileReference>);
 
+    // Total length of all items, computed once and cached.
+    unsigned long long size() const;
+
+    // Finds the item containing the given byte position by binary search over cached
+    // cumulative offsets, so slicing doesn't walk the item list. Returns the item index
+    // and the position relative to that item's start.
+    size_t itemIndexForPosition(unsigned long long position, unsigned long long& positionInItem) const;
+
 private:
     friend class BlobRegistryImpl;
     BlobData(const String& contentType);
@@ -120,8 +128,11 @@ private:
     void appendData(const ThreadSafeDataBuffer&, long long offset, long long length);
     void appendFile(BlobDataFileReference*, long long offset, long long length);
 
+    void ensureCumulativeItemEndOffsets() const;
+
     String m_contentType;
     BlobDataItemList m_items;
+    mutable Vector<unsigned long long> m_cumulativeItemEndOffsets;
 };
 
 } // namespace WebCore
@@ -81,31 +81,31 @@ RefPtr<ResourceHandle> BlobRegistryImpl::createResourceHandle(const ResourceRequ
     return handle;
 }
 
-void BlobRegistryImpl::appendStorageItems(BlobData* blobData, const BlobDataItemList& items, long long offset, long long length)
+void BlobRegistryImpl::appendStorageItems(BlobData* blobData, const BlobData& originalData, long long offset, long long length)
 {
     ASSERT(length != BlobDataItem::toEndOfFile);
 
-    BlobDataItemList::const_iterator iter = items.begin();
-    if (offset) {
-        for (; iter != items.end(); ++iter) {
-            if (offset >= iter->length())
-                offset -= iter->length();
-            else
-                break;
-        }
-    }
-
-    for (; iter != items.end() && length > 0; ++iter) {
-        long long currentLength = iter->length() - offset;
+    // Seek to the item containing the slice start by binary search instead of walking
+    // the item list; slice chains on many-part blobs hit this on every slice. The new
+    // items share the original payload buffers and file references, so no bytes are
+    // copied here.
+    unsigned long long positionInItem = 0;
+    size_t index = originalData.itemIndexForPosition(offset, positionInItem);
+    long long itemOffset = positionInItem;
+
+    const BlobDataItemList& items = originalData.items();
+    for (; index < items.size() && length > 0; ++index) {
+        const BlobDataItem& item = items[index];
+        long long currentLength = item.length() - itemOffset;
         long long newLength = currentLength > length ? length : currentLength;
-        if (iter->type() == BlobDataItem::Type::Data)
-            blobData->appendData(iter->data(), iter->offset() + offset, newLength);
+        if (item.type() == BlobDataItem::Type::Data)
+            blobData->appendData(item.data(), item.offset() + itemOffset, newLength);
         else {
-            ASSERT(iter->type() == BlobDataItem::Type::File);
-            blobData->appendFile(iter->file(), iter->offset() + offset, newLength);
+            ASSERT(item.type() == BlobDataItem::Type::File);
+            blobData->appendFile(item.file(), item.offset() + itemOffset, newLength);
         }
         length -= newLength;
-        offset = 0;
+        itemOffset = 0;
     }
     ASSERT(!length);
 }
@@ -197,7 +197,7 @@ void BlobRegistryImpl::registerBlobURLForSlice(const URL& url, const URL& srcURL
     unsigned long long newLength = end - start;
     RefPtr<BlobData> newData = BlobData::create(originalData->contentType());
 
-    appendStorageItems(newData.get(), originalData->items(), start, newLength);
+    appendStorageItems(newData.get(), *originalData, start, newLength);
 
     m_blobs.set(url.string(), newData.release());
 }
@@ -221,11 +221,7 @@ unsigned long long BlobRegistryImpl::blobSize(const URL& url)
     if (!data)
         return 0;
 
-    unsigned long long result = 0;
-    for (const BlobDataItem& item : data->items())
-        result += item.length();
-
-    return result;
+    return data->size();
 }
 
 } // namespace WebCore
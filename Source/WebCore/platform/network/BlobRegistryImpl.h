@@ -56,7 +56,7 @@ public:
     RefPtr<ResourceHandle> createResourceHandle(const ResourceRequest&, ResourceHandleClient*);
 
 private:
-    void appendStorageItems(BlobData*, const BlobDataItemList&, long long offset, long long length);
+    void appendStorageItems(BlobData*, const BlobData& original, long long offset, long long length);
 
     virtual void registerFileBlobURL(const URL&, RefPtr<BlobDataFileReference>&&, const String& contentType) override;
     virtual void registerBlobURL(const URL&, Vector<BlobPart>, const String& contentType) override;
@@ -289,17 +289,33 @@ static void appendBlobResolved(FormData* formData, const URL& url)
         return;
     }
 
-    BlobDataItemList::const_iterator it = blobData->items().begin();
-    const BlobDataItemList::const_iterator itend = blobData->items().end();
-    for (; it != itend; ++it) {
-        const BlobDataItem& blobItem = *it;
-        if (blobItem.type() == BlobDataItem::Type::Data) {
-            ASSERT(blobItem.data().data());
-            formData->appendData(blobItem.data().data()->data() + static_cast<int>(blobItem.offset()), static_cast<int>(blobItem.length()));
-        } else if (blobItem.type() == BlobDataItem::Type::File)
+    const BlobDataItemList& items = blobData->items();
+    for (size_t i = 0; i < items.size(); ++i) {
+        const BlobDataItem& blobItem = items[i];
+        if (blobItem.type() == BlobDataItem::Type::File) {
             formData->appendFileRange(blobItem.file()->path(), blobItem.offset(), blobItem.length(), blobItem.file()->expectedModificationTime());
-        else
-            ASSERT_NOT_REACHED();
+            continue;
+        }
+        ASSERT(blobItem.type() == BlobDataItem::Type::Data);
+
+        // Grow the data store once for each run of consecutive memory items instead of
+        // once per item. Appending a large in-memory blob item by item reallocates the
+        // vector repeatedly, and each reallocation briefly holds both the old and the
+        // new buffer; for a recording-sized blob that transiently doubles memory use.
+        size_t runEnd = i;
+        size_t runLength = 0;
+        for (; runEnd < items.size() && items[runEnd].type() == BlobDataItem::Type::Data; ++runEnd)
+            runLength += static_cast<size_t>(items[runEnd].length());
+
+        char* destination = formData->expandDataStore(runLength);
+        for (; i < runEnd; ++i) {
+            const BlobDataItem& dataItem = items[i];
+            ASSERT(dataItem.data().data());
+            size_t itemLength = static_cast<size_t>(dataItem.length());
+            memcpy(destination, dataItem.data().data()->data() + static_cast<int>(dataItem.offset()), itemLength);
+            destination += itemLength;
+        }
+        --i; // Compensate for the outer loop's increment.
     }
 }
 
@@ -38,6 +38,7 @@
 #include <wtf/NeverDestroyed.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringView.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/unicode/CharacterNames.h>
 
@@ -121,12 +122,11 @@ bool isValidHTTPHeaderValue(const String& value)
 }
 
 // See RFC 7230, Section 3.2.6.
-bool isValidHTTPToken(const String& value)
+bool isValidHTTPToken(StringView value)
 {
     if (value.isEmpty())
         return false;
-    auto valueStringView = StringView(value);
-    for (UChar c : valueStringView.codeUnits()) {
+    for (UChar c : value.codeUnits()) {
         if (c <= 0x20 || c >= 0x7F
             || c == '(' || c == ')' || c == '<' || c == '>' || c == '@'
             || c == ',' || c == ';' || c == ':' || c == '\\' || c == '"'
@@ -137,6 +137,23 @@ bool isValidHTTPToken(const String& value)
     return true;
 }
 
+bool isValidHTTPToken(const String& value)
+{
+    return isValidHTTPToken(StringView(value));
+}
+
+// Strips the same characters String::stripWhiteSpace() does, without allocating a substring.
+static StringView stripWhiteSpace(StringView view)
+{
+    unsigned start = 0;
+    unsigned end = view.length();
+    while (start < end && isSpaceOrNewline(view[start]))
+        ++start;
+    while (end > start && isSpaceOrNewline(view[end - 1]))
+        --end;
+    return view.substring(start, end - start);
+}
+
 static const size_t maxInputSampleSize = 128;
 static String trimInputSample(const char* p, size_t length)
 {
@@ -151,11 +168,24 @@ ContentDispositionType contentDispositionType(const String& contentDisposition)
     if (contentDisposition.isEmpty())
         return ContentDispositionNone;
 
-    Vector<String> parameters;
-    contentDisposition.split(';', parameters);
+    // The disposition type is the first non-empty ';'-separated piece of the header,
+    // matching what split(';') used to produce without building a Vector of substrings.
+    StringView header(contentDisposition);
+    StringView dispositionType;
+    unsigned start = 0;
+    while (start < header.length()) {
+        size_t end = header.find(';', start);
+        if (end == notFound)
+            end = header.length();
+        if (end > start) {
+            dispositionType = header.substring(start, end - start);
+            break;
+        }
+        start = end + 1;
+    }
 
-    String dispositionType = parameters[0];
-    dispositionType.stripWhiteSpace();
+    if (dispositionType.isEmpty())
+        return ContentDispositionNone;
 
     if (equalLettersIgnoringASCIICase(dispositionType, "inline"))
         return ContentDispositionInline;
@@ -252,27 +282,31 @@ Optional<std::chrono::system_clock::time_point> parseHTTPDate(const String& valu
 // in a case-sensitive manner. (There are likely other bugs as well.)
 String filenameFromHTTPContentDisposition(const String& value)
 {
-    Vector<String> keyValuePairs;
-    value.split(';', keyValuePairs);
-
-    unsigned length = keyValuePairs.size();
-    for (unsigned i = 0; i < length; i++) {
-        size_t valueStartPos = keyValuePairs[i].find('=');
+    StringView header(value);
+    unsigned start = 0;
+    while (start < header.length()) {
+        size_t end = header.find(';', start);
+        if (end == notFound)
+            end = header.length();
+        StringView keyValuePair = header.substring(start, end - start);
+        start = end + 1;
+
+        size_t valueStartPos = keyValuePair.find('=');
         if (valueStartPos == notFound)
             continue;
 
-        String key = keyValuePairs[i].left(valueStartPos).stripWhiteSpace();
+        StringView key = stripWhiteSpace(keyValuePair.substring(0, valueStartPos));
 
         if (key.isEmpty() || key != "filename")
             continue;
-        
-        String value = keyValuePairs[i].substring(valueStartPos + 1).stripWhiteSpace();
+
+        StringView filename = stripWhiteSpace(keyValuePair.substring(valueStartPos + 1));
 
         // Remove quotes if there are any
-        if (value[0] == '\"')
-            value = value.substring(1, value.length() - 2);
+        if (filename.length() && filename[0] == '\"')
+            filename = filename.substring(1, filename.length() >= 2 ? filename.length() - 2 : 0);
 
-        return value;
+        return filename.toString();
     }
 
     return String();
@@ -456,7 +490,7 @@ ContentSecurityPolicy::ReflectedXSSDisposition parseXSSProtectionHeader(const St
 #if ENABLE(NOSNIFF)
 ContentTypeOptionsDisposition parseContentTypeOptionsHeader(const String& header)
 {
-    if (equalLettersIgnoringASCIICase(header.stripWhiteSpace(), "nosniff"))
+    if (equalLettersIgnoringASCIICase(stripWhiteSpace(StringView(header)), "nosniff"))
         return ContentTypeOptionsNosniff;
     return ContentTypeOptionsNone;
 }
@@ -477,11 +511,19 @@ XFrameOptionsDisposition parseXFrameOptionsHeader(const String& header)
     if (header.isEmpty())
         return result;
 
-    Vector<String> headers;
-    header.split(',', headers);
+    StringView headerView(header);
+    unsigned start = 0;
+    while (start < headerView.length()) {
+        size_t end = headerView.find(',', start);
+        if (end == notFound)
+            end = headerView.length();
+        if (end == start) {
+            ++start;
+            continue;
+        }
+        StringView currentHeader = stripWhiteSpace(headerView.substring(start, end - start));
+        start = end + 1;
 
-    for (size_t i = 0; i < headers.size(); i++) {
-        String currentHeader = headers[i].stripWhiteSpace();
         XFrameOptionsDisposition currentValue = XFrameOptionsNone;
         if (equalLettersIgnoringASCIICase(currentHeader, "deny"))
             currentValue = XFrameOptionsDeny;
@@ -64,6 +64,7 @@ enum XFrameOptionsDisposition {
 ContentDispositionType contentDispositionType(const String&);
 bool isValidHTTPHeaderValue(const String&);
 bool isValidHTTPToken(const String&);
+bool isValidHTTPToken(StringView);
 bool parseHTTPRefresh(const String& refresh, bool fromHttpEquivMeta, double& delay, String& url);
 Optional<std::chrono::system_clock::time_point> parseHTTPDate(const String&);
 String filenameFromHTTPContentDisposition(const String&); 
@@ -29,6 +29,10 @@
 
 #include <wtf/text/ASCIIFastPath.h>
 
+#if CPU(X86_64) && !ASAN_ENABLED
+#include <emmintrin.h>
+#endif
+
 namespace WebCore {
 
 template<size_t size> struct UCharByteFiller;
@@ -75,6 +79,31 @@ inline void copyASCIIMachineWord(UChar* destination, const uint8_t* source)
     UCharByteFiller<sizeof(WTF::MachineWord)>::copy(destination, source);
 }
 
+#if CPU(X86_64) && !ASAN_ENABLED
+// Copies a 16 byte block if every byte in it is ASCII. Returns false without copying
+// anything when the block contains a non-ASCII byte; the caller's byte-wise path then
+// finds and handles it.
+inline bool copyASCII16Bytes(LChar* destination, const uint8_t* source)
+{
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    if (_mm_movemask_epi8(chunk))
+        return false;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), chunk);
+    return true;
+}
+
+inline bool copyASCII16Bytes(UChar* destination, const uint8_t* source)
+{
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    if (_mm_movemask_epi8(chunk))
+        return false;
+    __m128i zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi8(chunk, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 8), _mm_unpackhi_epi8(chunk, zero));
+    return true;
+}
+#endif
+
 } // namespace WebCore
 
 #endif // TextCodecASCIIFastPath_h
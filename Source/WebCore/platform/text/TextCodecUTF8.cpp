@@ -292,6 +292,16 @@ String TextCodecUTF8::decode(const char* bytes, size_t length, bool flush, bool
         while (source < end) {
             if (isASCII(*source)) {
                 // Fast path for ASCII. Most UTF-8 text will be ASCII.
+#if CPU(X86_64) && !ASAN_ENABLED
+                while (end - source >= 16 && copyASCII16Bytes(destination, source)) {
+                    source += 16;
+                    destination += 16;
+                }
+                if (source == end)
+                    break;
+                if (!isASCII(*source))
+                    continue;
+#endif
                 if (isAlignedToMachineWord(source)) {
                     while (source < alignedEnd) {
                         MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
@@ -369,6 +379,16 @@ upConvertTo16Bit:
         while (source < end) {
             if (isASCII(*source)) {
                 // Fast path for ASCII. Most UTF-8 text will be ASCII.
+#if CPU(X86_64) && !ASAN_ENABLED
+                while (end - source >= 16 && copyASCII16Bytes(destination16, source)) {
+                    source += 16;
+                    destination16 += 16;
+                }
+                if (source == end)
+                    break;
+                if (!isASCII(*source))
+                    continue;
+#endif
                 if (isAlignedToMachineWord(source)) {
                     while (source < alignedEnd) {
                         MachineWord chunk = *reinterpret_cast_ptr<const MachineWord*>(source);
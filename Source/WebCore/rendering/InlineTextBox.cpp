@@ -424,6 +424,11 @@ void InlineTextBox::paint(PaintInfo& paintInfo, const LayoutPoint& paintOffset,
         // When only painting the selection, don't bother to paint if there is none.
         return;
 
+    // When the selection highlight is composited into an overlay, normal painting leaves the
+    // selection to the overlay; selection-only painting (drag images) still draws it here.
+    if (haveSelection && paintInfo.phase != PaintPhaseSelection && renderer().frame().settings().compositedSelectionHighlightEnabled())
+        haveSelection = false;
+
     if (m_truncation != cNoTruncation) {
         if (renderer().containingBlock()->style().isLeftToRightDirection() != isLeftToRightDirection()) {
             // Make the visible fragment of text hug the edge closest to the rest of the run by moving the origin
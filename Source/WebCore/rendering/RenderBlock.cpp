@@ -1143,11 +1143,42 @@ void RenderBlock::setLogicalTopForChild(RenderBox& child, LayoutUnit logicalTop,
     }
 }
 
+// A child whose border box and margins all resolve to fixed lengths lays out the same way
+// whatever the containing block's size is, so a relayout-children pass doesn't need to dirty it.
+// Floats and pagination feed positions from outside the child back into its layout, so they
+// disqualify the skip.
+static bool childLayoutIsUnaffectedByContainingBlockResize(const RenderBlock& parent, const RenderBox& child)
+{
+    if (parent.document().paginated() || parent.flowThreadState() != RenderObject::NotInsideFlowThread)
+        return false;
+    if (is<RenderBlockFlow>(parent) && downcast<RenderBlockFlow>(parent).containsFloats())
+        return false;
+    if (child.isFloatingOrOutOfFlowPositioned() || child.isWritingModeRoot())
+        return false;
+    if (is<RenderBlockFlow>(child) && downcast<RenderBlockFlow>(child).containsFloats())
+        return false;
+    auto& style = child.style();
+    if (!style.logicalWidth().isFixed() || !style.logicalHeight().isFixed())
+        return false;
+    auto isFixedOrUnconstrained = [](const Length& length) {
+        return length.isFixed() || length.isAuto() || length.isUndefined();
+    };
+    if (!isFixedOrUnconstrained(style.logicalMinWidth()) || !isFixedOrUnconstrained(style.logicalMaxWidth())
+        || !isFixedOrUnconstrained(style.logicalMinHeight()) || !isFixedOrUnconstrained(style.logicalMaxHeight()))
+        return false;
+    if (!style.marginStart().isFixed() || !style.marginEnd().isFixed() || !style.marginBefore().isFixed() || !style.marginAfter().isFixed())
+        return false;
+    if (!style.paddingStart().isFixed() || !style.paddingEnd().isFixed() || !style.paddingBefore().isFixed() || !style.paddingAfter().isFixed())
+        return false;
+    return true;
+}
+
 void RenderBlock::updateBlockChildDirtyBitsBeforeLayout(bool relayoutChildren, RenderBox& child)
 {
     // FIXME: Technically percentage height objects only need a relayout if their percentage isn't going to be turned into
     // an auto value. Add a method to determine this, so that we can avoid the relayout.
-    if (relayoutChildren || (child.hasRelativeLogicalHeight() && !isRenderView()))
+    if ((child.hasRelativeLogicalHeight() && !isRenderView())
+        || (relayoutChildren && !childLayoutIsUnaffectedByContainingBlockResize(*this, child)))
         child.setChildNeedsLayout(MarkOnlyThis);
 
     // If relayoutChildren is set and the child has percentage padding or an embedded content box, we also need to invalidate the childs pref widths.
@@ -1726,6 +1757,8 @@ void RenderBlock::paintContinuationOutlines(PaintInfo& info, const LayoutPoint&
 
 bool RenderBlock::shouldPaintSelectionGaps() const
 {
+    if (frame().settings().compositedSelectionHighlightEnabled())
+        return false;
     return selectionState() != SelectionNone && style().visibility() == VISIBLE && isSelectionRoot();
 }
 
@@ -686,6 +686,10 @@ LayoutUnit RenderFlexibleBox::preferredMainAxisContentExtentForChild(RenderBox&
 
 void RenderFlexibleBox::layoutFlexItems(bool relayoutChildren, Vector<LineContext>& lineContexts)
 {
+    // Note that items are laid out strictly in order. Even items with definite sizes can't be laid
+    // out concurrently: child layout reads and writes document-global state (LayoutState, the
+    // percent height descendant registries, scrollbar and overflow updates on this flex box),
+    // and the flex algorithm itself feeds each line's measurements into the next.
     OrderedFlexItemList orderedChildren;
     LayoutUnit preferredMainAxisExtent;
     double totalFlexGrow;
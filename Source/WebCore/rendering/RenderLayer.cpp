@@ -122,6 +122,7 @@
 #include "WheelEventTestTrigger.h"
 #include <stdio.h>
 #include <wtf/StdLibExtras.h>
+#include <wtf/SystemTracing.h>
 #include <wtf/text/CString.h>
 
 #if ENABLE(CSS_SCROLL_SNAP)
@@ -3778,6 +3779,8 @@ bool RenderLayer::scroll(ScrollDirection direction, ScrollGranularity granularit
 
 void RenderLayer::paint(GraphicsContext& context, const LayoutRect& damageRect, const LayoutSize& subpixelAccumulation, PaintBehavior paintBehavior, RenderObject* subtreePaintRoot, PaintLayerFlags paintFlags)
 {
+    TraceScope tracingScope(PaintLayerStart, PaintLayerEnd);
+
     OverlapTestRequestMap overlapTestRequests;
 
     LayerPaintingInfo paintingInfo(this, enclosingIntRect(damageRect), paintBehavior, subpixelAccumulation, subtreePaintRoot, &overlapTestRequests);
@@ -4430,6 +4433,23 @@ void RenderLayer::paintLayerByApplyingTransform(GraphicsContext& context, const
     context.setCTM(oldTransfrom);
 }
 
+bool RenderLayer::occludesPaintDirtyRect(const LayerPaintingInfo& paintingInfo) const
+{
+    // Composited layers paint into their own backing, not into this software paint.
+    if (isComposited())
+        return false;
+
+    if (isFlowThreadCollectingGraphicsLayersUnderRegions())
+        return false;
+
+    if (!canUseConvertToLayerCoords())
+        return false;
+
+    LayoutRect localRect(paintingInfo.paintDirtyRect);
+    localRect.move(-offsetFromAncestor(paintingInfo.rootLayer));
+    return backgroundIsKnownToBeOpaqueInRect(localRect);
+}
+
 void RenderLayer::paintList(Vector<RenderLayer*>* list, GraphicsContext& context, const LayerPaintingInfo& paintingInfo, PaintLayerFlags paintFlags)
 {
     if (!list)
@@ -4442,7 +4462,30 @@ void RenderLayer::paintList(Vector<RenderLayer*>* list, GraphicsContext& context
     LayerListMutationDetector mutationChecker(this);
 #endif
 
-    for (auto* childLayer : *list) {
+    // Since the list paints back to front, everything beneath the topmost child that opaquely
+    // covers the whole dirty rect is invisible; don't spend raster time on it. Only the normal
+    // painting behavior can be culled this way: special passes (selection only, flattening
+    // compositing layers, a subtree paint root) may not actually paint the occluding background.
+    size_t firstVisibleIndex = 0;
+    if (paintingInfo.paintBehavior == PaintBehaviorNormal && !paintingInfo.subtreePaintRoot && !paintingInfo.overlapTestRequests) {
+        for (size_t i = list->size(); i-- > 1; ) {
+            if (list->at(i)->occludesPaintDirtyRect(paintingInfo)) {
+                firstVisibleIndex = i;
+                break;
+            }
+        }
+#if !LOG_DISABLED
+        if (firstVisibleIndex) {
+            static unsigned long long culledPaintArea;
+            IntSize dirtySize = snappedIntRect(paintingInfo.paintDirtyRect).size();
+            culledPaintArea += static_cast<unsigned long long>(dirtySize.width()) * dirtySize.height() * firstVisibleIndex;
+            LOG(Compositing, "RenderLayer %p paintList culled %zu layer(s) under opaque content, %llu px cumulative", this, firstVisibleIndex, culledPaintArea);
+        }
+#endif
+    }
+
+    for (size_t i = firstVisibleIndex; i < list->size(); ++i) {
+        RenderLayer* childLayer = list->at(i);
         if (childLayer->isFlowThreadCollectingGraphicsLayersUnderRegions())
             continue;
         childLayer->paintLayer(context, paintingInfo, paintFlags);
@@ -6252,11 +6295,13 @@ void RenderLayer::rebuildZOrderLists(CollectLayersBehavior behavior, std::unique
         if (!m_reflection || reflectionLayer() != child)
             child->collectLayers(includeHiddenLayers, behavior, posZOrderList, negZOrderList);
 
-    // Sort the two lists.
-    if (posZOrderList)
+    // Sort the two lists. Layers were collected in document order, which is usually already
+    // sorted since few siblings carry explicit z-indices; stable_sort would be a no-op then,
+    // so check first and skip its temporary buffer and comparisons.
+    if (posZOrderList && !std::is_sorted(posZOrderList->begin(), posZOrderList->end(), compareZIndex))
         std::stable_sort(posZOrderList->begin(), posZOrderList->end(), compareZIndex);
 
-    if (negZOrderList)
+    if (negZOrderList && !std::is_sorted(negZOrderList->begin(), negZOrderList->end(), compareZIndex))
         std::stable_sort(negZOrderList->begin(), negZOrderList->end(), compareZIndex);
 }
 
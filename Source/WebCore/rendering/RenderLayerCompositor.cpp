@@ -46,6 +46,7 @@
 #include "NodeList.h"
 #include "Page.h"
 #include "PageOverlayController.h"
+#include "Region.h"
 #include "RenderEmbeddedObject.h"
 #include "RenderFlowThread.h"
 #include "RenderFullScreen.h"
@@ -102,34 +103,27 @@ using namespace HTMLNames;
 
 class OverlapMapContainer {
 public:
+    // Storing the rects as a Region keeps the query cost proportional to the shape's span count
+    // rather than the number of layers added: abutting and overlapping layer rects coalesce, so
+    // lists of items going in one direction collapse into a handful of spans instead of growing
+    // a rect per layer. Region is integer-based; enclosingIntRect is conservative, which can only
+    // cause extra compositing, never missed overlap.
     void add(const LayoutRect& bounds)
     {
-        m_layerRects.append(bounds);
-        m_boundingBox.unite(bounds);
+        m_layerRegion.unite(Region(enclosingIntRect(bounds)));
     }
 
     bool overlapsLayers(const LayoutRect& bounds) const
     {
-        // Checking with the bounding box will quickly reject cases when
-        // layers are created for lists of items going in one direction and
-        // never overlap with each other.
-        if (!bounds.intersects(m_boundingBox))
-            return false;
-        for (const auto& layerRect : m_layerRects) {
-            if (layerRect.intersects(bounds))
-                return true;
-        }
-        return false;
+        return m_layerRegion.intersects(Region(enclosingIntRect(bounds)));
     }
 
     void unite(const OverlapMapContainer& otherContainer)
     {
-        m_layerRects.appendVector(otherContainer.m_layerRects);
-        m_boundingBox.unite(otherContainer.m_boundingBox);
+        m_layerRegion.unite(otherContainer.m_layerRegion);
     }
 private:
-    Vector<LayoutRect> m_layerRects;
-    LayoutRect m_boundingBox;
+    Region m_layerRegion;
 };
 
 class RenderLayerCompositor::OverlapMap {
@@ -179,35 +173,6 @@ public:
     RenderGeometryMap& geometryMap() { return m_geometryMap; }
 
 private:
-    struct RectList {
-        Vector<LayoutRect> rects;
-        LayoutRect boundingRect;
-        
-        void append(const LayoutRect& rect)
-        {
-            rects.append(rect);
-            boundingRect.unite(rect);
-        }
-
-        void append(const RectList& rectList)
-        {
-            rects.appendVector(rectList.rects);
-            boundingRect.unite(rectList.boundingRect);
-        }
-        
-        bool intersects(const LayoutRect& rect) const
-        {
-            if (!rects.size() || !boundingRect.intersects(rect))
-                return false;
-
-            for (const auto& currentRect : rects) {
-                if (currentRect.intersects(rect))
-                    return true;
-            }
-            return false;
-        }
-    };
-
     Vector<OverlapMapContainer> m_overlapStack;
     RenderGeometryMap m_geometryMap;
     bool m_isEmpty { true };
@@ -38,6 +38,7 @@
 #include "RenderNamedFlowFragment.h"
 #include "RenderTheme.h"
 #include "RenderView.h"
+#include "Settings.h"
 #include "VisiblePosition.h"
 #include <wtf/StackStats.h>
 
@@ -132,6 +133,8 @@ void RenderReplaced::intrinsicSizeChanged()
 
 bool RenderReplaced::shouldDrawSelectionTint() const
 {
+    if (frame().settings().compositedSelectionHighlightEnabled())
+        return false;
     return selectionState() != SelectionNone && !document().printing();
 }
 
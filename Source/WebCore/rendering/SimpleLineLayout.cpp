@@ -96,7 +96,6 @@ enum AvoidanceReason_ : uint64_t {
     FlowHasNonAutoTrailingWord            = 1LLU  << 31,
     FlowHasSVGFont                        = 1LLU  << 32,
     FlowTextIsEmpty                       = 1LLU  << 33,
-    FlowTextHasNoBreakSpace               = 1LLU  << 34,
     FlowTextHasSoftHyphen                 = 1LLU  << 35,
     FlowTextHasDirectionCharacter         = 1LLU  << 36,
     FlowIsMissingPrimaryFont              = 1LLU  << 37,
@@ -147,9 +146,12 @@ static AvoidanceReasonFlags canUseForText(const CharacterType* text, unsigned le
         if (character == ' ')
             continue;
 
-        // These would be easy to support.
+        // The line breaking and whitespace collapsing logic already treat no-break-space as regular,
+        // non-breakable content, and the font code measures it with the space glyph.
         if (character == noBreakSpace)
-            SET_REASON_AND_RETURN_IF_NEEDED(FlowTextHasNoBreakSpace, reasons, includeReasons);
+            continue;
+
+        // This would be easy to support.
         if (character == softHyphen)
             SET_REASON_AND_RETURN_IF_NEEDED(FlowTextHasSoftHyphen, reasons, includeReasons);
 
@@ -882,9 +884,6 @@ static void printReason(AvoidanceReason reason, TextStream& stream)
     case FlowHasSVGFont:
         stream << "SVG font";
         break;
-    case FlowTextHasNoBreakSpace:
-        stream << "No-break-space character";
-        break;
     case FlowTextHasSoftHyphen:
         stream << "soft hyphen character";
         break;
@@ -96,6 +96,23 @@ WEBCORE_EXPORT const unsigned char asciiLineBreakTable[][asciiLineBreakTableColu
 #undef DI
 #undef AL
 
+// Characters that are "inert" for line breaking: they are never breakable spaces, never need
+// the Unicode algorithm, and their asciiLineBreakTable row is empty, so a break can never occur
+// after one of them. Kept in sync with the table above by hand; '-' is excluded because of the
+// hard-coded digit rule in shouldBreakAfter().
+const unsigned char inertLineBreakCharacterTable[256] = {
+    //        0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
+    /* 0x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, // control characters except tab and newline
+    /* 1x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    /* 2x */  0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, // space through '/'
+    /* 3x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, // digits through '?'
+    /* 4x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // '@' and 'A'-'O'
+    /* 5x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, // 'P'-'Z', '[', '^', '_'
+    /* 6x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // '`' and 'a'-'o'
+    /* 7x */  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, // 'p'-'z', '{', DEL
+    // Everything from 0x80 up may need the Unicode line breaking algorithm.
+};
+
 COMPILE_ASSERT(WTF_ARRAY_LENGTH(asciiLineBreakTable) == asciiLineBreakTableLastChar - asciiLineBreakTableFirstChar + 1, TestLineBreakTableConsistency);
 
 } // namespace WebCore
@@ -35,6 +35,19 @@ static const unsigned asciiLineBreakTableColumnCount = (asciiLineBreakTableLastC
 
 WEBCORE_EXPORT extern const unsigned char asciiLineBreakTable[][asciiLineBreakTableColumnCount];
 
+// True for characters that can neither form a break opportunity with any neighbor through
+// the table above nor require consulting ICU: ASCII letters, digits and the like. Runs of
+// them can be stepped over without evaluating the per-character rules.
+WEBCORE_EXPORT extern const unsigned char inertLineBreakCharacterTable[256];
+
+template<typename CharacterType>
+inline bool isInertLineBreakCharacter(CharacterType ch)
+{
+    if (sizeof(CharacterType) > 1 && ch > 0xFF)
+        return false;
+    return inertLineBreakCharacterTable[static_cast<unsigned char>(ch)];
+}
+
 enum class NBSPBehavior {
     IgnoreNBSP,
     TreatNBSPAsBreak,
@@ -94,6 +107,18 @@ inline int nextBreakablePositionNonLoosely(LazyLineBreakIterator& lazyBreakItera
     for (int i = pos; i < len; i++) {
         CharacterType ch = str[i];
 
+        // Two adjacent inert characters can't break against each other and can't require ICU,
+        // so step over whole runs of them without evaluating the rules below.
+        if (isInertLineBreakCharacter(lastCh) && isInertLineBreakCharacter(ch)) {
+            do {
+                lastLastCh = lastCh;
+                lastCh = ch;
+                if (++i == len)
+                    return len;
+                ch = str[i];
+            } while (isInertLineBreakCharacter(ch));
+        }
+
         // Non-loose mode, so use ASCII shortcut (shouldBreakAfter) if not breakable space.
         if (isBreakableSpace<nbspBehavior>(ch) || shouldBreakAfter(lastLastCh, lastCh, ch))
             return i;
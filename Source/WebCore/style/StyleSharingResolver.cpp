@@ -332,11 +332,19 @@ bool SharingResolver::sharingCandidateHasIdenticalStyleAffectingAttributes(const
 
 bool SharingResolver::classNamesAffectedByRules(const SpaceSplitString& classNames) const
 {
-    for (unsigned i = 0; i < classNames.size(); ++i) {
-        if (m_ruleSets.features().classesInRules.contains(classNames[i].impl()))
-            return true;
-    }
-    return false;
+    SpaceSplitStringData* classNamesData = classNames.data();
+    if (!classNamesData)
+        return false;
+    // Class lists are deduplicated so long runs of identically classed elements share a
+    // single SpaceSplitStringData, and the rule features can't change during a resolution
+    // pass. Memoizing the answer turns the per-element hash lookups into a single one.
+    return m_classNamesAffectedByRulesCache.ensure(classNamesData, [&] {
+        for (unsigned i = 0; i < classNames.size(); ++i) {
+            if (m_ruleSets.features().classesInRules.contains(classNames[i].impl()))
+                return true;
+        }
+        return false;
+    }).iterator->value;
 }
 
 
@@ -26,6 +26,7 @@
 #ifndef StyleSharingResolver_h
 #define StyleSharingResolver_h
 
+#include "SpaceSplitString.h"
 #include <wtf/HashMap.h>
 
 namespace WebCore {
@@ -37,7 +38,6 @@ class Node;
 class RenderStyle;
 class RuleSet;
 class SelectorFilter;
-class SpaceSplitString;
 class StyledElement;
 
 namespace Style {
@@ -63,6 +63,7 @@ private:
     const SelectorFilter& m_selectorFilter;
 
     HashMap<const Element*, const Element*> m_elementsSharingStyle;
+    mutable HashMap<RefPtr<SpaceSplitStringData>, bool> m_classNamesAffectedByRulesCache;
 };
 
 }
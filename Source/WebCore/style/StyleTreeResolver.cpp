@@ -514,8 +514,10 @@ void TreeResolver::createRenderTreeRecursively(Element& current, RenderStyle& in
 
     bool shouldCallCreateRenderer = shouldCreateRenderer(current, renderTreePosition.parent());
 
+    // Elements under a renderer that can't have children never get renderers of their own,
+    // and nothing below looks at their style, so skip resolving it for the whole subtree.
     RefPtr<RenderStyle> style = resolvedStyle;
-    if (!style)
+    if (!style && shouldCallCreateRenderer)
         style = styleForElement(current, inheritedStyle);
 
 #if ENABLE(SHADOW_DOM) || ENABLE(DETAILS_ELEMENT)
@@ -666,6 +668,8 @@ static bool pseudoStyleCacheIsInvalid(RenderElement* renderer, RenderStyle* newS
 
 Change TreeResolver::resolveElement(Element& current)
 {
+    ++m_resolvedElementCount;
+
     Change localChange = Detach;
     RefPtr<RenderStyle> newStyle;
     RefPtr<RenderStyle> currentStyle = current.renderStyle();
@@ -55,6 +55,10 @@ public:
 
     void resolve(Change);
 
+    // The number of elements that went through resolveElement(). Only meaningful after
+    // resolve(); Document uses it for restyle tracing.
+    unsigned resolvedElementCount() const { return m_resolvedElementCount; }
+
 private:
     Ref<RenderStyle> styleForElement(Element&, RenderStyle& inheritedStyle);
 
@@ -109,6 +113,7 @@ private:
     Document& m_document;
     Vector<Ref<Scope>, 4> m_scopeStack;
     Vector<Parent, 32> m_parentStack;
+    unsigned m_resolvedElementCount { 0 };
 };
 
 void detachRenderTree(Element&);
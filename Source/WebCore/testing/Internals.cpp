@@ -2526,6 +2526,27 @@ unsigned long Internals::styleRecalcCount(ExceptionCode& ec)
     return document->styleRecalcCount();
 }
 
+void Internals::setStyleRecalcTracingEnabled(bool enabled, ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return;
+    }
+    document->setStyleRecalcTracingEnabled(enabled);
+}
+
+String Internals::styleRecalcTrace(ExceptionCode& ec) const
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return String();
+    }
+
+    return document->styleRecalcTraceAsText();
+}
+
 void Internals::startTrackingCompositingUpdates(ExceptionCode& ec)
 {
     Document* document = contextDocument();
@@ -2578,6 +2599,14 @@ unsigned Internals::layoutCount() const
     return document->view()->layoutCount();
 }
 
+unsigned Internals::dimensionsCheckAvoidedLayoutCount() const
+{
+    Document* document = contextDocument();
+    if (!document)
+        return 0;
+    return document->dimensionsCheckAvoidedLayoutCount();
+}
+
 #if !PLATFORM(IOS)
 static const char* cursorTypeToString(Cursor::Type cursorType)
 {
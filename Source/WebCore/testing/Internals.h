@@ -333,6 +333,8 @@ public:
     
     void startTrackingStyleRecalcs(ExceptionCode&);
     unsigned long styleRecalcCount(ExceptionCode&);
+    void setStyleRecalcTracingEnabled(bool, ExceptionCode&);
+    String styleRecalcTrace(ExceptionCode&) const;
 
     void startTrackingCompositingUpdates(ExceptionCode&);
     unsigned long compositingUpdateCount(ExceptionCode&);
@@ -340,6 +342,7 @@ public:
     void updateLayoutIgnorePendingStylesheetsAndRunPostLayoutTasks(ExceptionCode&);
     void updateLayoutIgnorePendingStylesheetsAndRunPostLayoutTasks(Node*, ExceptionCode&);
     unsigned layoutCount() const;
+    unsigned dimensionsCheckAvoidedLayoutCount() const;
 
     RefPtr<ArrayBuffer> serializeObject(PassRefPtr<SerializedScriptValue>) const;
     RefPtr<SerializedScriptValue> deserializeBuffer(PassRefPtr<ArrayBuffer>) const;
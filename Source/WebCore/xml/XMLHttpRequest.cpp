@@ -1171,6 +1171,15 @@ void XMLHttpRequest::didReceiveData(const char* data, int len)
             m_decoder = TextResourceDecoder::create("text/html", "UTF-8");
         else
             m_decoder = TextResourceDecoder::create("text/plain", "UTF-8");
+
+        // Reserve the expected response size up front so a large responseText is not copied
+        // over and over as the builder's buffer doubles, transiently costing a multiple of the
+        // response size in memory. The reservation is capped so a bogus Content-Length cannot
+        // make us allocate far more than the server will ever send.
+        static const long long maxResponsePreallocationSize = 16 * 1024 * 1024;
+        long long expectedLength = m_response.expectedContentLength();
+        if (expectedLength > 0 && expectedLength <= maxResponsePreallocationSize)
+            m_responseBuilder.reserveCapacity(static_cast<unsigned>(expectedLength));
     }
 
     if (!len)
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "NetworkLoadScheduler.h"
+
+#include "NetworkResourceLoader.h"
+#include <wtf/NeverDestroyed.h>
+#include <wtf/RunLoop.h>
+#include <wtf/Vector.h>
+
+using namespace WebCore;
+
+namespace WebKit {
+
+static const unsigned maximumLoadsInFlightPerHost = 6;
+
+NetworkLoadScheduler& NetworkLoadScheduler::singleton()
+{
+    ASSERT(RunLoop::isMain());
+    static NeverDestroyed<NetworkLoadScheduler> scheduler;
+    return scheduler;
+}
+
+NetworkLoadScheduler::NetworkLoadScheduler()
+{
+}
+
+bool NetworkLoadScheduler::HostInformation::hasPendingLoaders() const
+{
+    for (auto& queue : pendingLoaders) {
+        if (!queue.isEmpty())
+            return true;
+    }
+    return false;
+}
+
+auto NetworkLoadScheduler::hostInformation(const String& hostName) -> HostInformation&
+{
+    auto& host = m_hosts.add(hostName, nullptr).iterator->value;
+    if (!host)
+        host = std::make_unique<HostInformation>();
+    return *host;
+}
+
+void NetworkLoadScheduler::scheduleLoader(NetworkResourceLoader& loader)
+{
+    String hostName = loader.originalRequest().url().host();
+
+    // Local loads (data:, blob:, file:) have no host to contend for.
+    if (hostName.isEmpty()) {
+        loader.start();
+        return;
+    }
+
+    auto& host = hostInformation(hostName);
+    if (host.loadersInFlight.size() < maximumLoadsInFlightPerHost) {
+        host.loadersInFlight.add(&loader);
+        loader.start();
+        return;
+    }
+
+    host.pendingLoaders[static_cast<unsigned>(loader.originalRequest().priority())].append(&loader);
+}
+
+void NetworkLoadScheduler::removeLoader(NetworkResourceLoader& loader)
+{
+    String hostName = loader.originalRequest().url().host();
+    if (hostName.isEmpty())
+        return;
+
+    auto it = m_hosts.find(hostName);
+    if (it == m_hosts.end())
+        return;
+    auto& host = *it->value;
+
+    if (!host.loadersInFlight.remove(&loader)) {
+        // The loader was aborted while still queued (or bypassed the scheduler, like
+        // synchronous loads do).
+        auto& queue = host.pendingLoaders[static_cast<unsigned>(loader.originalRequest().priority())];
+        for (auto queueIterator = queue.begin(); queueIterator != queue.end(); ++queueIterator) {
+            if (*queueIterator == &loader) {
+                queue.remove(queueIterator);
+                break;
+            }
+        }
+    }
+
+    // Fill the freed slots, but update all bookkeeping before calling start(): a load
+    // completing synchronously would re-enter removeLoader().
+    Vector<RefPtr<NetworkResourceLoader>> loadersToStart;
+    while (host.loadersInFlight.size() < maximumLoadsInFlightPerHost) {
+        RefPtr<NetworkResourceLoader> next = takeNextPendingLoader(host);
+        if (!next)
+            break;
+        host.loadersInFlight.add(next.get());
+        loadersToStart.append(WTFMove(next));
+    }
+
+    if (host.loadersInFlight.isEmpty() && !host.hasPendingLoaders())
+        m_hosts.remove(it);
+
+    for (auto& loaderToStart : loadersToStart)
+        loaderToStart->start();
+}
+
+RefPtr<NetworkResourceLoader> NetworkLoadScheduler::takeNextPendingLoader(HostInformation& host)
+{
+    // Loads for visible pages go first at any priority so that, for example, a
+    // foreground navigation is not stuck behind a background tab's image loads.
+    if (!m_visibleWebPages.isEmpty()) {
+        if (RefPtr<NetworkResourceLoader> loader = takeNextPendingLoader(host, true))
+            return loader;
+    }
+    return takeNextPendingLoader(host, false);
+}
+
+RefPtr<NetworkResourceLoader> NetworkLoadScheduler::takeNextPendingLoader(HostInformation& host, bool visiblePagesOnly)
+{
+    for (int priority = resourceLoadPriorityCount - 1; priority >= 0; --priority) {
+        auto& queue = host.pendingLoaders[priority];
+        for (auto queueIterator = queue.begin(); queueIterator != queue.end(); ++queueIterator) {
+            if (visiblePagesOnly && !m_visibleWebPages.contains((*queueIterator)->pageID()))
+                continue;
+            RefPtr<NetworkResourceLoader> loader = *queueIterator;
+            queue.remove(queueIterator);
+            return loader;
+        }
+    }
+    return nullptr;
+}
+
+void NetworkLoadScheduler::setWebPageIsVisible(uint64_t webPageID, bool isVisible)
+{
+    if (isVisible)
+        m_visibleWebPages.add(webPageID);
+    else
+        m_visibleWebPages.remove(webPageID);
+}
+
+} // namespace WebKit
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NetworkLoadScheduler_h
+#define NetworkLoadScheduler_h
+
+#include <WebCore/ResourceLoadPriority.h>
+#include <wtf/Deque.h>
+#include <wtf/Forward.h>
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/RefPtr.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebKit {
+
+class NetworkResourceLoader;
+
+// Stages asynchronous resource loads so that requests are issued in
+// ResourceLoadPriority order and no single host monopolizes the connection pool.
+// Queued loads for web pages the UI process reported visible are served ahead of
+// background-page loads, so a background tab's subresource storm cannot delay a
+// foreground navigation.
+class NetworkLoadScheduler {
+    WTF_MAKE_NONCOPYABLE(NetworkLoadScheduler);
+    friend NeverDestroyed<NetworkLoadScheduler>;
+public:
+    static NetworkLoadScheduler& singleton();
+
+    // Starts the loader right away if its host has a free slot, otherwise queues it.
+    void scheduleLoader(NetworkResourceLoader&);
+
+    // Called when a load finishes, fails or is aborted. Also removes loaders that
+    // were aborted while still queued, and starts queued loads that now fit.
+    void removeLoader(NetworkResourceLoader&);
+
+    void setWebPageIsVisible(uint64_t webPageID, bool isVisible);
+
+private:
+    NetworkLoadScheduler();
+
+    struct HostInformation {
+        Deque<RefPtr<NetworkResourceLoader>> pendingLoaders[WebCore::resourceLoadPriorityCount];
+        HashSet<NetworkResourceLoader*> loadersInFlight;
+
+        bool hasPendingLoaders() const;
+    };
+
+    HostInformation& hostInformation(const String& hostName);
+    RefPtr<NetworkResourceLoader> takeNextPendingLoader(HostInformation&);
+    RefPtr<NetworkResourceLoader> takeNextPendingLoader(HostInformation&, bool visiblePagesOnly);
+
+    HashMap<String, std::unique_ptr<HostInformation>> m_hosts;
+    HashSet<uint64_t> m_visibleWebPages;
+};
+
+} // namespace WebKit
+
+#endif // NetworkLoadScheduler_h
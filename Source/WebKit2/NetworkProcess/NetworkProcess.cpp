@@ -33,6 +33,7 @@
 #include "CustomProtocolManager.h"
 #include "Logging.h"
 #include "NetworkConnectionToWebProcess.h"
+#include "NetworkLoadScheduler.h"
 #include "NetworkProcessCreationParameters.h"
 #include "NetworkProcessPlatformStrategies.h"
 #include "NetworkProcessProxyMessages.h"
@@ -260,6 +261,11 @@ void NetworkProcess::clearCachedCredentials()
     NetworkStorageSession::defaultStorageSession().credentialStorage().clearCredentials();
 }
 
+void NetworkProcess::webPageVisibilityDidChange(uint64_t webPageID, bool isVisible)
+{
+    NetworkLoadScheduler::singleton().setWebPageIsVisible(webPageID, isVisible);
+}
+
 void NetworkProcess::ensurePrivateBrowsingSession(SessionID sessionID)
 {
     RemoteNetworkingContext::ensurePrivateBrowsingSession(sessionID);
@@ -148,6 +148,8 @@ private:
 
     void clearCachedCredentials();
 
+    void webPageVisibilityDidChange(uint64_t webPageID, bool isVisible);
+
     // FIXME: This should take a session ID so we can identify which disk cache to delete.
     void clearDiskCache(std::chrono::system_clock::time_point modifiedSince, std::function<void ()> completionHandler);
 
@@ -32,6 +32,7 @@
 #include "NetworkCache.h"
 #include "NetworkConnectionToWebProcess.h"
 #include "NetworkLoad.h"
+#include "NetworkLoadScheduler.h"
 #include "NetworkProcessConnectionMessages.h"
 #include "WebCoreArgumentCoders.h"
 #include "WebResourceLoaderMessages.h"
@@ -48,6 +49,24 @@ using namespace WebCore;
 
 namespace WebKit {
 
+#if ENABLE(SHAREABLE_RESOURCE) && !PLATFORM(COCOA)
+// On Cocoa, tryGetShareableHandleFromSharedBuffer() shares buffers that are already
+// backed by a mapped file. Other ports have no such backing outside the disk cache, so
+// pay for one copy into freshly allocated shared memory; the web process then maps the
+// same pages instead of receiving the body as a stream of copied message chunks.
+static const size_t minimumSizeForShareableResource = 64 * 1024;
+
+static void tryGetShareableHandleForBuffer(ShareableResource::Handle& handle, SharedBuffer& buffer)
+{
+    RefPtr<SharedMemory> sharedMemory = SharedMemory::allocate(buffer.size());
+    if (!sharedMemory)
+        return;
+
+    memcpy(sharedMemory->data(), buffer.data(), buffer.size());
+    ShareableResource::create(sharedMemory.release(), 0, buffer.size())->createHandle(handle);
+}
+#endif
+
 struct NetworkResourceLoader::SynchronousLoadData {
     SynchronousLoadData(RefPtr<Messages::NetworkConnectionToWebProcess::PerformSynchronousLoad::DelayedReply>&& reply)
         : delayedReply(WTFMove(reply))
@@ -227,6 +246,8 @@ void NetworkResourceLoader::cleanup()
 
     m_bufferingTimer.stop();
 
+    NetworkLoadScheduler::singleton().removeLoader(*this);
+
     invalidateSandboxExtensions();
 
     m_networkLoad = nullptr;
@@ -351,6 +372,24 @@ void NetworkResourceLoader::didFinishLoading(double finishTime)
         sendReplyToSynchronousRequest(*m_synchronousLoadData, m_bufferedData.get());
     else {
         if (m_bufferedData && !m_bufferedData->isEmpty()) {
+#if ENABLE(SHAREABLE_RESOURCE) && !PLATFORM(COCOA)
+            // If buffering held on to the entire body and it is large enough, deliver it
+            // as a single shared memory handle: one copy here instead of a copy per
+            // message chunk in each process. DidReceiveResource also finishes the load
+            // on the web process side.
+            if (m_bufferedData->size() >= minimumSizeForShareableResource && m_bufferedData->size() == m_bytesReceived) {
+                ShareableResource::Handle shareableResourceHandle;
+                tryGetShareableHandleForBuffer(shareableResourceHandle, *m_bufferedData);
+                if (!shareableResourceHandle.isNull()) {
+                    send(Messages::WebResourceLoader::DidReceiveResource(shareableResourceHandle, finishTime));
+#if ENABLE(NETWORK_CACHE)
+                    tryStoreAsCacheEntry();
+#endif
+                    cleanup();
+                    return;
+                }
+            }
+#endif
             // FIXME: Pass a real value or remove the encoded data size feature.
             bool shouldContinue = sendBufferMaybeAborting(*m_bufferedData, -1);
             if (!shouldContinue)
@@ -371,7 +410,16 @@ void NetworkResourceLoader::didFailLoading(const ResourceError& error)
     ASSERT(!error.isNull());
 
 #if ENABLE(NETWORK_CACHE)
-    m_cacheEntryForValidation = nullptr;
+    if (m_cacheEntryForValidation) {
+        if (!error.isCancellation()) {
+            // The network went away under a revalidation but we still hold the entry we
+            // went out to revalidate. Serving it stale beats handing the page an error.
+            LOG(NetworkCache, "(NetworkProcess) revalidation failed, serving stale entry");
+            didRetrieveCacheEntry(WTFMove(m_cacheEntryForValidation));
+            return;
+        }
+        m_cacheEntryForValidation = nullptr;
+    }
 #endif
 
     if (isSynchronous()) {
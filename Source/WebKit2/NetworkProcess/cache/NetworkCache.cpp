@@ -59,6 +59,12 @@ static const AtomicString& resourceType()
     return resource;
 }
 
+static std::chrono::system_clock::time_point sessionStartTime()
+{
+    static const auto startTime = std::chrono::system_clock::now();
+    return startTime;
+}
+
 Cache& singleton()
 {
     static NeverDestroyed<Cache> instance;
@@ -76,6 +82,9 @@ bool Cache::initialize(const String& cachePath, const Parameters& parameters)
 {
     m_storage = Storage::open(cachePath);
 
+    // Anchor the "this session" boundary for revalidation trust before any entries are stored.
+    sessionStartTime();
+
 #if ENABLE(NETWORK_CACHE_SPECULATIVE_REVALIDATION)
     if (parameters.enableNetworkCacheSpeculativeRevalidation)
         m_speculativeLoadManager = std::make_unique<SpeculativeLoadManager>(*m_storage);
@@ -216,12 +225,33 @@ static bool responseNeedsRevalidation(const WebCore::ResourceResponse& response,
     return responseHasExpired(response, timestamp, requestDirectives.maxStale);
 }
 
+static bool entryIsTrustedForSession(const Entry& entry)
+{
+    // An entry qualifies if we fetched or successfully revalidated it during this session
+    // and the server gave it a freshness lifetime long enough to read as "effectively
+    // immutable". Such entries are served without another conditional GET for the rest
+    // of the session.
+    if (entry.timeStamp() < sessionStartTime())
+        return false;
+    static const auto minimumLifetimeForSessionTrust = std::chrono::hours(24);
+    return WebCore::computeFreshnessLifetimeForHTTPFamily(entry.response(), entry.timeStamp()) >= minimumLifetimeForSessionTrust;
+}
+
 static UseDecision makeUseDecision(const Entry& entry, const WebCore::ResourceRequest& request)
 {
     // The request is conditional so we force revalidation from the network. We merely check the disk cache
     // so we can update the cache entry.
-    if (request.isConditional() && !entry.redirectRequest())
+    if (request.isConditional() && !entry.redirectRequest()) {
+        // Reloads conditionalize every subresource individually and the resulting serial
+        // revalidation round-trips dominate reload time on slow links. If the entry is
+        // fresh, was seen this session and is effectively immutable, answer from the
+        // cache instead of dispatching the conditional GET.
+        if (entryIsTrustedForSession(entry)
+            && !responseNeedsRevalidation(entry.response(), request, entry.timeStamp())
+            && verifyVaryingRequestHeaders(entry.varyingRequestHeaders(), request))
+            return UseDecision::Use;
         return UseDecision::Validate;
+    }
 
     if (!verifyVaryingRequestHeaders(entry.varyingRequestHeaders(), request))
         return UseDecision::NoDueToVaryingHeaderMismatch;
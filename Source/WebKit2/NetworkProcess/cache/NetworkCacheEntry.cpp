@@ -161,6 +161,14 @@ void Entry::initializeBufferFromStorageRecord() const
         if (m_buffer)
             return;
     }
+#endif
+#if USE(SOUP)
+    if (m_sourceStorageRecord.body.isMap()) {
+        // The body is a file mapping whose lifetime the SoupBuffer manages; share it
+        // instead of copying a potentially multi-megabyte resource.
+        m_buffer = WebCore::SharedBuffer::wrapSoupBuffer(soup_buffer_copy(m_sourceStorageRecord.body.soupBuffer()));
+        return;
+    }
 #endif
     m_buffer = WebCore::SharedBuffer::create(m_sourceStorageRecord.body.data(), m_sourceStorageRecord.body.size());
 }
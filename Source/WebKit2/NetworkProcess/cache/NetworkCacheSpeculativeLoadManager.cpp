@@ -48,6 +48,11 @@ using namespace WebCore;
 
 static const auto preloadedEntryLifetime = 10_s;
 
+// A subresource needs to have been used by this many recent loads of the page before we preload it.
+static const unsigned minimumHitCountForPreload = 2;
+// Host-wide predictions aggregate many unrelated pages so we demand more evidence before preloading.
+static const unsigned minimumHitCountForHostPreload = 3;
+
 #if !LOG_DISABLED
 static HashCountedSet<String>& allSpeculativeLoadingDiagnosticMessages()
 {
@@ -84,6 +89,13 @@ static inline Key makeSubresourcesKey(const Key& resourceKey)
     return Key(resourceKey.partition(), subresourcesType(), resourceKey.range(), resourceKey.identifier());
 }
 
+// Aggregates subresources across all pages on a host so that navigating to any of them
+// preloads the ones they share, like framework scripts and stylesheets.
+static inline Key makeHostSubresourcesKey(const Key& resourceKey, const URL& mainResourceURL)
+{
+    return Key(resourceKey.partition(), subresourcesType(), { }, "host:" + mainResourceURL.host());
+}
+
 static inline ResourceRequest constructRevalidationRequest(const Entry& entry)
 {
     ResourceRequest revalidationRequest(entry.key().identifier());
@@ -146,15 +158,16 @@ private:
 
 class SpeculativeLoadManager::PendingFrameLoad : public RefCounted<PendingFrameLoad> {
 public:
-    static Ref<PendingFrameLoad> create(Storage& storage, const Key& mainResourceKey, std::function<void()>&& loadCompletionHandler)
+    static Ref<PendingFrameLoad> create(Storage& storage, const Key& mainResourceKey, const Key& hostSubresourcesKey, std::function<void()>&& loadCompletionHandler)
     {
-        return adoptRef(*new PendingFrameLoad(storage, mainResourceKey, WTFMove(loadCompletionHandler)));
+        return adoptRef(*new PendingFrameLoad(storage, mainResourceKey, hostSubresourcesKey, WTFMove(loadCompletionHandler)));
     }
 
     ~PendingFrameLoad()
     {
         ASSERT(m_didFinishLoad);
         ASSERT(m_didRetrieveExistingEntry);
+        ASSERT(m_didRetrieveExistingHostEntry);
     }
 
     void registerSubresource(const Key& subresourceKey)
@@ -189,17 +202,28 @@ public:
         saveToDiskIfReady();
     }
 
+    void setExistingHostSubresourcesEntry(std::unique_ptr<SubresourcesEntry> entry)
+    {
+        ASSERT(!m_existingHostEntry);
+        ASSERT(!m_didRetrieveExistingHostEntry);
+
+        m_existingHostEntry = WTFMove(entry);
+        m_didRetrieveExistingHostEntry = true;
+        saveToDiskIfReady();
+    }
+
 private:
-    PendingFrameLoad(Storage& storage, const Key& mainResourceKey, std::function<void()>&& loadCompletionHandler)
+    PendingFrameLoad(Storage& storage, const Key& mainResourceKey, const Key& hostSubresourcesKey, std::function<void()>&& loadCompletionHandler)
         : m_storage(storage)
         , m_mainResourceKey(mainResourceKey)
+        , m_hostSubresourcesKey(hostSubresourcesKey)
         , m_loadCompletionHandler(WTFMove(loadCompletionHandler))
         , m_loadHysteresisActivity([this](HysteresisState state) { if (state == HysteresisState::Stopped) markLoadAsCompleted(); })
     { }
 
     void saveToDiskIfReady()
     {
-        if (!m_didFinishLoad || !m_didRetrieveExistingEntry)
+        if (!m_didFinishLoad || !m_didRetrieveExistingEntry || !m_didRetrieveExistingHostEntry)
             return;
 
         if (m_subresourceKeys.isEmpty())
@@ -218,16 +242,28 @@ private:
             SubresourcesEntry entry(makeSubresourcesKey(m_mainResourceKey), m_subresourceKeys);
             m_storage.store(entry.encodeAsStorageRecord(), [](const Data&) { });
         }
+
+        // Also update the host-wide entry so navigations to other pages on the host benefit.
+        if (m_existingHostEntry) {
+            m_existingHostEntry->updateSubresourceKeys(m_subresourceKeys);
+            m_storage.store(m_existingHostEntry->encodeAsStorageRecord(), [](const Data&) { });
+        } else {
+            SubresourcesEntry hostEntry(Key(m_hostSubresourcesKey), m_subresourceKeys);
+            m_storage.store(hostEntry.encodeAsStorageRecord(), [](const Data&) { });
+        }
     }
 
     Storage& m_storage;
     Key m_mainResourceKey;
+    Key m_hostSubresourcesKey;
     Vector<Key> m_subresourceKeys;
     std::function<void()> m_loadCompletionHandler;
     HysteresisActivity m_loadHysteresisActivity;
     std::unique_ptr<SubresourcesEntry> m_existingEntry;
+    std::unique_ptr<SubresourcesEntry> m_existingHostEntry;
     bool m_didFinishLoad { false };
     bool m_didRetrieveExistingEntry { false };
+    bool m_didRetrieveExistingHostEntry { false };
 };
 
 SpeculativeLoadManager::SpeculativeLoadManager(Storage& storage)
@@ -288,8 +324,10 @@ void SpeculativeLoadManager::registerLoad(const GlobalFrameID& frameID, const Re
 
         ASSERT(!m_pendingFrameLoads.contains(frameID));
 
+        auto hostSubresourcesKey = makeHostSubresourcesKey(resourceKey, request.url());
+
         // Start tracking loads in this frame.
-        RefPtr<PendingFrameLoad> pendingFrameLoad = PendingFrameLoad::create(m_storage, resourceKey, [this, frameID] {
+        RefPtr<PendingFrameLoad> pendingFrameLoad = PendingFrameLoad::create(m_storage, resourceKey, hostSubresourcesKey, [this, frameID] {
             bool wasRemoved = m_pendingFrameLoads.remove(frameID);
             ASSERT_UNUSED(wasRemoved, wasRemoved);
         });
@@ -298,10 +336,18 @@ void SpeculativeLoadManager::registerLoad(const GlobalFrameID& frameID, const Re
         // Retrieve the subresources entry if it exists to start speculative revalidation and to update it.
         retrieveSubresourcesEntry(resourceKey, [this, frameID, pendingFrameLoad](std::unique_ptr<SubresourcesEntry> entry) {
             if (entry)
-                startSpeculativeRevalidation(frameID, *entry);
+                startSpeculativeRevalidation(frameID, *entry, minimumHitCountForPreload);
 
             pendingFrameLoad->setExistingSubresourcesEntry(WTFMove(entry));
         });
+
+        // The host-wide entry catches subresources shared between different pages on the host.
+        retrieveSubresourcesEntryForStorageKey(hostSubresourcesKey, [this, frameID, pendingFrameLoad](std::unique_ptr<SubresourcesEntry> entry) {
+            if (entry)
+                startSpeculativeRevalidation(frameID, *entry, minimumHitCountForHostPreload);
+
+            pendingFrameLoad->setExistingHostSubresourcesEntry(WTFMove(entry));
+        });
         return;
     }
 
@@ -409,14 +455,20 @@ void SpeculativeLoadManager::preloadEntry(const Key& key, const GlobalFrameID& f
     });
 }
 
-void SpeculativeLoadManager::startSpeculativeRevalidation(const GlobalFrameID& frameID, SubresourcesEntry& entry)
+void SpeculativeLoadManager::startSpeculativeRevalidation(const GlobalFrameID& frameID, SubresourcesEntry& entry, unsigned minimumHitCount)
 {
     for (auto& subresource : entry.subresources()) {
         auto key = subresource.key;
-        if (!subresource.value.isTransient)
+        // The page entry and the host-wide entry may both predict the same subresource.
+        if (m_pendingPreloads.contains(key) || m_preloadedEntries.contains(key))
+            continue;
+        if (subresource.value.hitCount >= minimumHitCount) {
+            m_notPreloadedEntries.remove(key);
             preloadEntry(key, frameID);
-        else {
-            LOG(NetworkCacheSpeculativePreloading, "(NetworkProcess) Not preloading '%s' because it is marked as transient", subresource.key.identifier().utf8().data());
+        } else {
+            LOG(NetworkCacheSpeculativePreloading, "(NetworkProcess) Not preloading '%s' because its hit count %u is below the threshold", subresource.key.identifier().utf8().data(), subresource.value.hitCount);
+            if (m_notPreloadedEntries.contains(key))
+                continue;
             m_notPreloadedEntries.add(key, std::make_unique<ExpiringEntry>([this, key, frameID] {
                 logSpeculativeLoadingDiagnosticMessage(frameID, DiagnosticLoggingKeys::entryRightlyNotWarmedUpKey());
                 m_notPreloadedEntries.remove(key);
@@ -428,7 +480,11 @@ void SpeculativeLoadManager::startSpeculativeRevalidation(const GlobalFrameID& f
 void SpeculativeLoadManager::retrieveSubresourcesEntry(const Key& storageKey, std::function<void (std::unique_ptr<SubresourcesEntry>)> completionHandler)
 {
     ASSERT(storageKey.type() == "resource");
-    auto subresourcesStorageKey = makeSubresourcesKey(storageKey);
+    retrieveSubresourcesEntryForStorageKey(makeSubresourcesKey(storageKey), WTFMove(completionHandler));
+}
+
+void SpeculativeLoadManager::retrieveSubresourcesEntryForStorageKey(const Key& subresourcesStorageKey, std::function<void (std::unique_ptr<SubresourcesEntry>)> completionHandler)
+{
     m_storage.retrieve(subresourcesStorageKey, static_cast<unsigned>(ResourceLoadPriority::Medium), [completionHandler](std::unique_ptr<Storage::Record> record) {
         if (!record) {
             completionHandler(nullptr);
@@ -60,7 +60,8 @@ private:
     void revalidateEntry(std::unique_ptr<Entry>, const GlobalFrameID&);
     bool satisfyPendingRequests(const Key&, Entry*);
     void retrieveSubresourcesEntry(const Key& storageKey, std::function<void (std::unique_ptr<SubresourcesEntry>)>);
-    void startSpeculativeRevalidation(const GlobalFrameID&, SubresourcesEntry&);
+    void retrieveSubresourcesEntryForStorageKey(const Key& subresourcesStorageKey, std::function<void (std::unique_ptr<SubresourcesEntry>)>);
+    void startSpeculativeRevalidation(const GlobalFrameID&, SubresourcesEntry&, unsigned minimumHitCount);
 
     Storage& m_storage;
 
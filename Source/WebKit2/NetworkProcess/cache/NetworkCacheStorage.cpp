@@ -46,6 +46,7 @@ namespace NetworkCache {
 static const char versionDirectoryPrefix[] = "Version ";
 static const char recordsDirectoryName[] = "Records";
 static const char blobsDirectoryName[] = "Blobs";
+static const char indexSnapshotFileName[] = "IndexSnapshot";
 static const char blobSuffix[] = "-blob";
 
 static double computeRecordWorth(FileTimes);
@@ -153,6 +154,11 @@ static String makeBlobDirectoryPath(const String& baseDirectoryPath)
     return WebCore::pathByAppendingComponent(makeVersionedDirectoryPath(baseDirectoryPath), blobsDirectoryName);
 }
 
+static String makeIndexSnapshotFilePath(const String& baseDirectoryPath)
+{
+    return WebCore::pathByAppendingComponent(makeVersionedDirectoryPath(baseDirectoryPath), indexSnapshotFileName);
+}
+
 void traverseRecordsFiles(const String& recordsPath, const String& expectedType, const std::function<void (const String& fileName, const String& hashString, const String& type, bool isBlob, const String& recordDirectoryPath)>& function)
 {
     traverseDirectory(recordsPath, [&recordsPath, &function, &expectedType](const String& partitionName, DirectoryEntryType entryType) {
@@ -202,6 +208,7 @@ static void deleteEmptyRecordsDirectories(const String& recordsPath)
 Storage::Storage(const String& baseDirectoryPath)
     : m_basePath(baseDirectoryPath)
     , m_recordsPath(makeRecordsDirectoryPath(baseDirectoryPath))
+    , m_indexSnapshotPath(makeIndexSnapshotFilePath(baseDirectoryPath))
     , m_readOperationTimeoutTimer(*this, &Storage::cancelAllReadOperations)
     , m_writeOperationDispatchTimer(*this, &Storage::dispatchPendingWriteOperations)
     , m_ioQueue(WorkQueue::create("com.apple.WebKit.Cache.Storage", WorkQueue::Type::Concurrent))
@@ -210,6 +217,7 @@ Storage::Storage(const String& baseDirectoryPath)
     , m_blobStorage(makeBlobDirectoryPath(baseDirectoryPath))
 {
     deleteOldVersions();
+    loadIndexSnapshot();
     synchronize();
 }
 
@@ -232,6 +240,11 @@ String Storage::recordsPath() const
     return m_recordsPath.isolatedCopy();
 }
 
+String Storage::indexSnapshotPath() const
+{
+    return m_indexSnapshotPath.isolatedCopy();
+}
+
 size_t Storage::approximateSize() const
 {
     return m_approximateRecordsSize + m_blobStorage.approximateSize();
@@ -296,6 +309,8 @@ void Storage::synchronize()
             m_blobFilter = WTFMove(blobFilter);
             m_approximateRecordsSize = recordsSize;
             m_synchronizationInProgress = false;
+
+            persistIndexSnapshot();
         });
 
         m_blobStorage.synchronize();
@@ -306,6 +321,105 @@ void Storage::synchronize()
     });
 }
 
+// The index snapshot persists the contents filters so they are available right after launch,
+// before synchronize() has finished traversing the records directory. The snapshot may lag
+// behind the actual cache contents: a stale positive costs a failed disk read and a stale
+// negative a refetch, and the filters built by the traversal replace it soon after startup.
+struct IndexSnapshotHeader {
+    unsigned cacheStorageVersion;
+    unsigned filterTableSize;
+    uint64_t generation;
+    uint64_t approximateRecordsSize;
+    SHA1::Digest filterTablesHash;
+};
+
+void Storage::loadIndexSnapshot()
+{
+    ASSERT(RunLoop::isMain());
+
+    ioQueue().dispatch([this] {
+        auto snapshotData = mapFile(WebCore::fileSystemRepresentation(indexSnapshotPath()).data());
+
+        const size_t tableBytes = sizeof(ContentsFilter::RawTable);
+        if (snapshotData.size() != sizeof(IndexSnapshotHeader) + 2 * tableBytes)
+            return;
+
+        IndexSnapshotHeader header;
+        memcpy(&header, snapshotData.data(), sizeof(header));
+        if (header.cacheStorageVersion != version)
+            return;
+        if (header.filterTableSize != ContentsFilter::tableSize)
+            return;
+        if (header.filterTablesHash != computeSHA1(snapshotData.subrange(sizeof(IndexSnapshotHeader), 2 * tableBytes)))
+            return;
+
+        auto recordFilter = std::make_unique<ContentsFilter>();
+        auto blobFilter = std::make_unique<ContentsFilter>();
+        ContentsFilter::RawTable table;
+        memcpy(table.data(), snapshotData.data() + sizeof(IndexSnapshotHeader), tableBytes);
+        recordFilter->setRawTable(table);
+        memcpy(table.data(), snapshotData.data() + sizeof(IndexSnapshotHeader) + tableBytes, tableBytes);
+        blobFilter->setRawTable(table);
+
+        auto* recordFilterPtr = recordFilter.release();
+        auto* blobFilterPtr = blobFilter.release();
+        uint64_t generation = header.generation;
+        uint64_t approximateRecordsSize = header.approximateRecordsSize;
+        RunLoop::main().dispatch([this, recordFilterPtr, blobFilterPtr, generation, approximateRecordsSize] {
+            auto recordFilter = std::unique_ptr<ContentsFilter>(recordFilterPtr);
+            auto blobFilter = std::unique_ptr<ContentsFilter>(blobFilterPtr);
+
+            // The initial synchronization finished first or the cache was cleared meanwhile.
+            if (m_recordFilter || !m_synchronizationInProgress)
+                return;
+
+            // Entries added while the snapshot was loading are only in the pending hash vectors.
+            // Add them without consuming the vectors, the ongoing synchronization needs them too.
+            for (auto& hash : m_recordFilterHashesAddedDuringSynchronization)
+                recordFilter->add(hash);
+            for (auto& hash : m_blobFilterHashesAddedDuringSynchronization)
+                blobFilter->add(hash);
+
+            m_recordFilter = WTFMove(recordFilter);
+            m_blobFilter = WTFMove(blobFilter);
+            m_approximateRecordsSize = approximateRecordsSize;
+            m_indexGeneration = generation;
+
+            LOG(NetworkCacheStorage, "(NetworkProcess) loaded index snapshot generation=%llu size=%llu", static_cast<unsigned long long>(generation), static_cast<unsigned long long>(approximateRecordsSize));
+        });
+    });
+}
+
+void Storage::persistIndexSnapshot()
+{
+    ASSERT(RunLoop::isMain());
+
+    if (!m_recordFilter || !m_blobFilter)
+        return;
+
+    ++m_indexGeneration;
+
+    const size_t tableBytes = sizeof(ContentsFilter::RawTable);
+    Vector<uint8_t> buffer(sizeof(IndexSnapshotHeader) + 2 * tableBytes);
+    memcpy(buffer.data() + sizeof(IndexSnapshotHeader), m_recordFilter->rawTable().data(), tableBytes);
+    memcpy(buffer.data() + sizeof(IndexSnapshotHeader) + tableBytes, m_blobFilter->rawTable().data(), tableBytes);
+
+    IndexSnapshotHeader header;
+    header.cacheStorageVersion = version;
+    header.filterTableSize = ContentsFilter::tableSize;
+    header.generation = m_indexGeneration;
+    header.approximateRecordsSize = m_approximateRecordsSize;
+    header.filterTablesHash = computeSHA1(Data(buffer.data() + sizeof(IndexSnapshotHeader), 2 * tableBytes));
+    memcpy(buffer.data(), &header, sizeof(header));
+
+    Data snapshotData(buffer.data(), buffer.size());
+    serialBackgroundIOQueue().dispatch([this, snapshotData] {
+        auto snapshotPath = indexSnapshotPath();
+        WebCore::deleteFile(snapshotPath);
+        snapshotData.mapToFile(WebCore::fileSystemRepresentation(snapshotPath).data());
+    });
+}
+
 void Storage::addToRecordFilter(const Key& key)
 {
     ASSERT(RunLoop::isMain());
@@ -746,6 +860,10 @@ void Storage::finishWriteOperation(WriteOperation& writeOperation)
     m_activeWriteOperations.remove(&writeOperation);
     dispatchPendingWriteOperations();
 
+    // Refresh the snapshot when a write burst quiesces so a relaunch sees the new entries.
+    if (m_activeWriteOperations.isEmpty() && m_pendingWriteOperations.isEmpty())
+        persistIndexSnapshot();
+
     shrinkIfNeeded();
 }
 
@@ -902,6 +1020,9 @@ void Storage::clear(const String& type, std::chrono::system_clock::time_point mo
     auto* completionHandlerPtr = completionHandler ? new std::function<void ()>(WTFMove(completionHandler)) : nullptr;
     StringCapture typeCapture(type);
     ioQueue().dispatch([this, modifiedSinceTime, completionHandlerPtr, typeCapture] {
+        // The snapshot no longer matches the contents; the next synchronization writes a fresh one.
+        WebCore::deleteFile(indexSnapshotPath());
+
         auto recordsPath = this->recordsPath();
         traverseRecordsFiles(recordsPath, typeCapture.string(), [modifiedSinceTime](const String& fileName, const String& hashString, const String& type, bool isBlob, const String& recordDirectoryPath) {
             auto filePath = WebCore::pathByAppendingComponent(recordDirectoryPath, fileName);
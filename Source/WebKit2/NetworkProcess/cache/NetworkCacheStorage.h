@@ -100,8 +100,11 @@ private:
     String recordDirectoryPathForKey(const Key&) const;
     String recordPathForKey(const Key&) const;
     String blobPathForKey(const Key&) const;
+    String indexSnapshotPath() const;
 
     void synchronize();
+    void loadIndexSnapshot();
+    void persistIndexSnapshot();
     void deleteOldVersions();
     void shrinkIfNeeded();
     void shrink();
@@ -135,6 +138,7 @@ private:
 
     const String m_basePath;
     const String m_recordsPath;
+    const String m_indexSnapshotPath;
 
     size_t m_capacity { std::numeric_limits<size_t>::max() };
     size_t m_approximateRecordsSize { 0 };
@@ -146,6 +150,7 @@ private:
 
     bool m_synchronizationInProgress { false };
     bool m_shrinkInProgress { false };
+    uint64_t m_indexGeneration { 0 };
 
     Vector<Key::HashType> m_recordFilterHashesAddedDuringSynchronization;
     Vector<Key::HashType> m_blobFilterHashesAddedDuringSynchronization;
@@ -75,17 +75,31 @@ SubresourcesEntry::SubresourcesEntry(Key&& key, const Vector<Key>& subresourceKe
 {
     ASSERT(m_key.type() == "subresources");
     for (auto& key : subresourceKeys)
-        m_subresources.add(key, SubresourceInfo());
+        m_subresources.add(key, SubresourceInfo(1));
 }
 
 void SubresourcesEntry::updateSubresourceKeys(const Vector<Key>& subresourceKeys)
 {
+    // Bounds how long it takes a formerly popular subresource to decay away.
+    static const unsigned maximumHitCount = 8;
+
     auto oldSubresources = WTFMove(m_subresources);
 
-    // Mark keys that are common with last load as non-Transient.
     for (auto& key : subresourceKeys) {
-        bool isTransient = !oldSubresources.contains(key);
-        m_subresources.add(key, SubresourceInfo(isTransient));
+        auto it = oldSubresources.find(key);
+        unsigned hitCount = 1;
+        if (it != oldSubresources.end()) {
+            hitCount = std::min(it->value.hitCount + 1, maximumHitCount);
+            oldSubresources.remove(it);
+        }
+        m_subresources.add(key, SubresourceInfo(hitCount));
+    }
+
+    // Decay subresources this load didn't use instead of dropping them right away.
+    for (auto& subresource : oldSubresources) {
+        unsigned decayedHitCount = subresource.value.hitCount / 2;
+        if (decayedHitCount)
+            m_subresources.add(subresource.key, SubresourceInfo(decayedHitCount));
     }
 }
 
@@ -40,13 +40,15 @@ class SubresourcesEntry {
     WTF_MAKE_NONCOPYABLE(SubresourcesEntry); WTF_MAKE_FAST_ALLOCATED;
 public:
     struct SubresourceInfo {
-        void encode(Encoder& encoder) const { encoder << isTransient; }
-        static bool decode(Decoder& decoder, SubresourceInfo& info) { return decoder.decode(info.isTransient); }
+        void encode(Encoder& encoder) const { encoder << hitCount; }
+        static bool decode(Decoder& decoder, SubresourceInfo& info) { return decoder.decode(info.hitCount); }
 
         SubresourceInfo() = default;
-        SubresourceInfo(bool isTransient) : isTransient(isTransient) { }
+        explicit SubresourceInfo(unsigned hitCount) : hitCount(hitCount) { }
 
-        bool isTransient { false };
+        // Number of recent loads that used the subresource. Halved by every load that doesn't,
+        // so rarely used subresources decay away instead of being forgotten immediately.
+        unsigned hitCount { 0 };
     };
     SubresourcesEntry(Key&&, const Vector<Key>& subresourceKeys);
     explicit SubresourcesEntry(const Storage::Record&);
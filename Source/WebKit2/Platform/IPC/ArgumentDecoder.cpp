@@ -27,6 +27,7 @@
 #include "ArgumentDecoder.h"
 
 #include "DataReference.h"
+#include "SharedMemory.h"
 #include <stdio.h>
 
 namespace IPC {
@@ -109,7 +110,30 @@ bool ArgumentDecoder::decodeVariableLengthByteArray(DataReference& dataReference
     uint64_t size;
     if (!decode(size))
         return false;
-    
+
+    bool isOutOfLine;
+    if (!decode(isOutOfLine))
+        return false;
+
+    if (isOutOfLine) {
+        WebKit::SharedMemory::Handle handle;
+        if (!decode(handle)) {
+            markInvalid();
+            return false;
+        }
+
+        RefPtr<WebKit::SharedMemory> memory = WebKit::SharedMemory::map(handle, WebKit::SharedMemory::Protection::ReadOnly);
+        if (!memory || memory->size() < size) {
+            markInvalid();
+            return false;
+        }
+
+        // Keep the mapping alive for the lifetime of the decoder; the data reference is a view into it.
+        dataReference = DataReference(static_cast<const uint8_t*>(memory->data()), size);
+        m_outOfLineMemoryRegions.append(WTFMove(memory));
+        return true;
+    }
+
     if (!alignBufferPosition(1, size))
         return false;
 
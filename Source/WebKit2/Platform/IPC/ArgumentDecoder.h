@@ -28,8 +28,13 @@
 
 #include "ArgumentCoder.h"
 #include "Attachment.h"
+#include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 
+namespace WebKit {
+class SharedMemory;
+}
+
 namespace IPC {
 
 class DataReference;
@@ -105,6 +110,9 @@ private:
     uint8_t* m_bufferEnd;
 
     Vector<Attachment> m_attachments;
+
+    // Mappings backing out-of-line byte arrays; the decoded data references are views into these.
+    Vector<RefPtr<WebKit::SharedMemory>> m_outOfLineMemoryRegions;
 };
 
 } // namespace IPC
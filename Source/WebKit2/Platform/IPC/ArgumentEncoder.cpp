@@ -27,6 +27,7 @@
 #include "ArgumentEncoder.h"
 
 #include "DataReference.h"
+#include "SharedMemory.h"
 #include <algorithm>
 #include <stdio.h>
 
@@ -119,10 +120,31 @@ void ArgumentEncoder::encodeFixedLengthData(const uint8_t* data, size_t size, un
     memcpy(buffer, data, size);
 }
 
+// Below this size the fixed costs of allocating, attaching and mapping a shared memory region
+// outweigh the copy into the contiguous buffer.
+static const size_t minimumSizeForOutOfLinePayload = 128 * 1024;
+
 void ArgumentEncoder::encodeVariableLengthByteArray(const DataReference& dataReference)
 {
     encode(static_cast<uint64_t>(dataReference.size()));
-    encodeFixedLengthData(dataReference.data(), dataReference.size(), 1);
+
+    // Large payloads are copied straight into their own shared memory region attached to the
+    // message instead of growing the contiguous buffer, so peak memory stays bounded by the
+    // payload itself and the receiver can map the data in place.
+    RefPtr<WebKit::SharedMemory> outOfLineMemory;
+    if (m_allowsOutOfLinePayloads && dataReference.size() >= minimumSizeForOutOfLinePayload)
+        outOfLineMemory = WebKit::SharedMemory::allocate(dataReference.size());
+
+    WebKit::SharedMemory::Handle handle;
+    if (!outOfLineMemory || !outOfLineMemory->createHandle(handle, WebKit::SharedMemory::Protection::ReadOnly)) {
+        encode(false);
+        encodeFixedLengthData(dataReference.data(), dataReference.size(), 1);
+        return;
+    }
+
+    memcpy(outOfLineMemory->data(), dataReference.data(), dataReference.size());
+    encode(true);
+    encode(handle);
 }
 
 template<typename Type>
@@ -69,6 +69,11 @@ public:
     Vector<Attachment> releaseAttachments();
     void reserve(size_t);
 
+protected:
+    // Spilling large byte arrays into shared memory is only valid for encoders whose attachments
+    // travel with the message; plain buffer encoders must keep all their data inline.
+    void setAllowsOutOfLinePayloads() { m_allowsOutOfLinePayloads = true; }
+
 private:
     void encode(bool);
     void encode(uint8_t);
@@ -90,6 +95,8 @@ private:
     size_t m_bufferSize;
     size_t m_bufferCapacity;
 
+    bool m_allowsOutOfLinePayloads { false };
+
     Vector<Attachment> m_attachments;
 };
 
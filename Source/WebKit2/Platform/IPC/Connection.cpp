@@ -31,6 +31,8 @@
 #include <wtf/HashSet.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/RunLoop.h>
+#include <wtf/SystemTracing.h>
+#include <wtf/text/StringHash.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/threads/BinarySemaphore.h>
 
@@ -55,6 +57,60 @@ struct WaitForMessageState {
     std::unique_ptr<MessageDecoder> decoder;
 };
 
+// Sync wait times are recorded into a process-wide table so they survive individual connections
+// and can be reported long after the waits happened.
+struct SyncWaitStatisticsStore {
+    Lock lock;
+    HashMap<String, Connection::SyncWaitHistogram> histograms;
+};
+
+static SyncWaitStatisticsStore& syncWaitStatisticsStore()
+{
+    static NeverDestroyed<SyncWaitStatisticsStore> store;
+    return store;
+}
+
+static String syncMessageNameKey(const MessageEncoder& encoder)
+{
+    StringReference receiverName = encoder.messageReceiverName();
+    StringReference messageName = encoder.messageName();
+    return String(receiverName.data(), receiverName.size()) + "::" + String(messageName.data(), messageName.size());
+}
+
+static void recordSyncWait(const String& messageKey, double waitDurationInSeconds)
+{
+    uint64_t milliseconds = static_cast<uint64_t>(waitDurationInSeconds * 1000);
+
+    unsigned bucket = 0;
+    while (bucket < Connection::SyncWaitHistogram::bucketCount - 1 && milliseconds >= (1u << bucket))
+        ++bucket;
+
+    auto& store = syncWaitStatisticsStore();
+    LockHolder locker(store.lock);
+
+    auto it = store.histograms.find(messageKey);
+    if (it == store.histograms.end())
+        it = store.histograms.add(messageKey.isolatedCopy(), Connection::SyncWaitHistogram()).iterator;
+
+    Connection::SyncWaitHistogram& histogram = it->value;
+    ++histogram.buckets[bucket];
+    ++histogram.count;
+    histogram.totalMilliseconds += milliseconds;
+    if (milliseconds > histogram.maximumMilliseconds)
+        histogram.maximumMilliseconds = milliseconds;
+}
+
+HashMap<String, Connection::SyncWaitHistogram> Connection::syncWaitStatistics()
+{
+    auto& store = syncWaitStatisticsStore();
+    LockHolder locker(store.lock);
+
+    HashMap<String, SyncWaitHistogram> result;
+    for (auto& entry : store.histograms)
+        result.add(entry.key.isolatedCopy(), entry.value);
+    return result;
+}
+
 class Connection::SyncMessageState {
 public:
     static SyncMessageState& singleton();
@@ -373,9 +429,14 @@ bool Connection::sendMessage(std::unique_ptr<MessageEncoder> encoder, unsigned m
     {
         std::lock_guard<Lock> lock(m_outgoingMessagesMutex);
         m_outgoingMessages.append(WTFMove(encoder));
+
+        // If a drain of the outgoing queue is already scheduled it will pick this message
+        // up too; don't wake the connection queue once per message.
+        if (m_sendOutgoingMessagesScheduled)
+            return true;
+        m_sendOutgoingMessagesScheduled = true;
     }
-    
-    // FIXME: We should add a boolean flag so we don't call this when work has already been scheduled.
+
     RefPtr<Connection> protectedThis(this);
     m_connectionQueue->dispatch([protectedThis] {
         protectedThis->sendOutgoingMessages();
@@ -483,13 +544,17 @@ std::unique_ptr<MessageDecoder> Connection::sendSyncMessage(uint64_t syncRequest
     auto token = MessageRecorder::recordOutgoingMessage(*this, *encoder);
 #endif
 
+    String messageKey = syncMessageNameKey(*encoder);
+
     // First send the message.
     sendMessage(WTFMove(encoder), DispatchMessageEvenWhenWaitingForSyncReply, true);
 
     // Then wait for a reply. Waiting for a reply could involve dispatching incoming sync messages, so
     // keep an extra reference to the connection here in case it's invalidated.
     Ref<Connection> protect(*this);
+    double waitStartTime = monotonicallyIncreasingTime();
     std::unique_ptr<MessageDecoder> reply = waitForSyncReply(syncRequestID, timeout, syncSendFlags);
+    recordSyncWait(messageKey, monotonicallyIncreasingTime() - waitStartTime);
 
     --m_inSendSyncCount;
 
@@ -529,9 +594,13 @@ std::unique_ptr<MessageDecoder> Connection::sendSyncMessageFromSecondaryThread(u
     auto token = MessageRecorder::recordOutgoingMessage(*this, *encoder);
 #endif
 
+    String messageKey = syncMessageNameKey(*encoder);
+
     sendMessage(WTFMove(encoder), 0, true);
 
+    double waitStartTime = monotonicallyIncreasingTime();
     pendingReply.semaphore.wait(currentTime() + (timeout.count() / 1000.0));
+    recordSyncWait(messageKey, monotonicallyIncreasingTime() - waitStartTime);
 
     // Finally, pop the pending sync reply information.
     {
@@ -543,6 +612,32 @@ std::unique_ptr<MessageDecoder> Connection::sendSyncMessageFromSecondaryThread(u
     return WTFMove(pendingReply.replyDecoder);
 }
 
+bool Connection::sendMessageWithAsyncReply(uint64_t syncRequestID, std::unique_ptr<MessageEncoder> encoder, std::function<void (std::unique_ptr<MessageDecoder>)> replyHandler)
+{
+    if (!isValid()) {
+        RunLoop::main().dispatch([replyHandler] {
+            replyHandler(nullptr);
+        });
+        return false;
+    }
+
+    {
+        LockHolder locker(m_syncReplyStateMutex);
+        if (!m_shouldWaitForSyncReplies) {
+            RunLoop::main().dispatch([replyHandler] {
+                replyHandler(nullptr);
+            });
+            return false;
+        }
+
+        m_asyncReplyHandlers.add(syncRequestID, WTFMove(replyHandler));
+    }
+
+    // Ask the remote process to dispatch the message even when it is itself blocked on a sync
+    // reply, matching the behavior of a normal synchronous send.
+    return sendMessage(WTFMove(encoder), DispatchMessageEvenWhenWaitingForSyncReply);
+}
+
 std::unique_ptr<MessageDecoder> Connection::waitForSyncReply(uint64_t syncRequestID, std::chrono::milliseconds timeout, unsigned syncSendFlags)
 {
     double absoluteTime = currentTime() + (timeout.count() / 1000.0);
@@ -621,6 +716,17 @@ void Connection::processIncomingSyncReply(std::unique_ptr<MessageDecoder> decode
         ASSERT(!reply->replyDecoder);
         reply->replyDecoder = WTFMove(decoder);
         reply->semaphore.signal();
+        return;
+    }
+
+    // Check if it is a reply to a message sent with sendWithAsyncReply().
+    auto replyHandler = m_asyncReplyHandlers.take(decoder->destinationID());
+    if (replyHandler) {
+        MessageDecoder* replyDecoderPtr = decoder.release();
+        RunLoop::main().dispatch([replyHandler, replyDecoderPtr] {
+            replyHandler(std::unique_ptr<MessageDecoder>(replyDecoderPtr));
+        });
+        return;
     }
 
     // If we get here, it means we got a reply for a message that wasn't in the sync request stack or map.
@@ -762,6 +868,15 @@ void Connection::connectionDidClose()
 
         for (SecondaryThreadPendingSyncReplyMap::iterator iter = m_secondaryThreadPendingSyncReplyMap.begin(); iter != m_secondaryThreadPendingSyncReplyMap.end(); ++iter)
             iter->value->semaphore.signal();
+
+        // Replies to messages sent with sendWithAsyncReply() will never arrive now; invoke their
+        // completion handlers with a null decoder.
+        for (auto& replyHandler : m_asyncReplyHandlers.values()) {
+            RunLoop::main().dispatch([replyHandler] {
+                replyHandler(nullptr);
+            });
+        }
+        m_asyncReplyHandlers.clear();
     }
 
     {
@@ -798,6 +913,13 @@ bool Connection::canSendOutgoingMessages() const
 
 void Connection::sendOutgoingMessages()
 {
+    {
+        // Clear the flag before draining: a message appended after this point schedules a
+        // new drain, while anything already queued is picked up by the loop below.
+        std::lock_guard<Lock> lock(m_outgoingMessagesMutex);
+        m_sendOutgoingMessagesScheduled = false;
+    }
+
     if (!canSendOutgoingMessages())
         return;
 
@@ -888,6 +1010,7 @@ void Connection::enqueueIncomingMessage(std::unique_ptr<MessageDecoder> incoming
 
 void Connection::dispatchMessage(MessageDecoder& decoder)
 {
+    TraceScope traceScope(IPCMessageDispatchStart, IPCMessageDispatchEnd);
     m_client->didReceiveMessage(*this, decoder);
 }
 
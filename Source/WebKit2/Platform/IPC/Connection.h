@@ -33,6 +33,7 @@
 #include "MessageEncoder.h"
 #include "MessageReceiver.h"
 #include "ProcessType.h"
+#include <array>
 #include <atomic>
 #include <wtf/Condition.h>
 #include <wtf/Deque.h>
@@ -41,6 +42,7 @@
 #include <wtf/Lock.h>
 #include <wtf/WorkQueue.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
 
 #if OS(DARWIN) && !USE(UNIX_DOMAIN_SOCKETS)
 #include <mach/mach_port.h>
@@ -172,12 +174,14 @@ public:
     template<typename T> bool send(T&& message, uint64_t destinationID, unsigned messageSendFlags = 0);
     template<typename T> bool sendSync(T&& message, typename T::Reply&& reply, uint64_t destinationID, std::chrono::milliseconds timeout = std::chrono::milliseconds::max(), unsigned syncSendFlags = 0);
     template<typename T> bool waitForAndDispatchImmediately(uint64_t destinationID, std::chrono::milliseconds timeout, unsigned waitForMessageFlags = 0);
+    template<typename T> bool sendWithAsyncReply(T&& message, uint64_t destinationID, typename T::AsyncReplyHandler);
 
     std::unique_ptr<MessageEncoder> createSyncMessageEncoder(StringReference messageReceiverName, StringReference messageName, uint64_t destinationID, uint64_t& syncRequestID);
     bool sendMessage(std::unique_ptr<MessageEncoder>, unsigned messageSendFlags = 0, bool alreadyRecordedMessage = false);
     std::unique_ptr<MessageDecoder> sendSyncMessage(uint64_t syncRequestID, std::unique_ptr<MessageEncoder>, std::chrono::milliseconds timeout, unsigned syncSendFlags = 0);
     std::unique_ptr<MessageDecoder> sendSyncMessageFromSecondaryThread(uint64_t syncRequestID, std::unique_ptr<MessageEncoder>, std::chrono::milliseconds timeout);
     bool sendSyncReply(std::unique_ptr<MessageEncoder>);
+    bool sendMessageWithAsyncReply(uint64_t syncRequestID, std::unique_ptr<MessageEncoder>, std::function<void (std::unique_ptr<MessageDecoder>)> replyHandler);
 
     void wakeUpRunLoop();
 
@@ -205,6 +209,19 @@ public:
 
     void allowFullySynchronousModeForTesting() { m_fullySynchronousModeIsAllowedForTesting = true; }
 
+    // Time spent blocked waiting for sync replies, bucketed by power-of-two milliseconds and
+    // aggregated over all connections in the process. Bucket i counts waits of [2^(i-1), 2^i)
+    // milliseconds, except that the first bucket starts at 0 and the last one is unbounded.
+    struct SyncWaitHistogram {
+        static const unsigned bucketCount = 11;
+        std::array<uint64_t, bucketCount> buckets { };
+        uint64_t count { 0 };
+        uint64_t totalMilliseconds { 0 };
+        uint64_t maximumMilliseconds { 0 };
+    };
+    // Returns a snapshot keyed by "Receiver::Message". Safe to call from any thread.
+    static HashMap<String, SyncWaitHistogram> syncWaitStatistics();
+
 private:
     Connection(Identifier, bool isServer, Client&);
     void platformInitialize(Identifier);
@@ -267,6 +284,7 @@ private:
     // Outgoing messages.
     Lock m_outgoingMessagesMutex;
     Deque<std::unique_ptr<MessageEncoder>> m_outgoingMessages;
+    bool m_sendOutgoingMessagesScheduled { false };
     
     Condition m_waitForMessageCondition;
     Lock m_waitForMessageMutex;
@@ -309,6 +327,9 @@ private:
     typedef HashMap<uint64_t, SecondaryThreadPendingSyncReply*> SecondaryThreadPendingSyncReplyMap;
     SecondaryThreadPendingSyncReplyMap m_secondaryThreadPendingSyncReplyMap;
 
+    // Completion handlers for messages sent with sendWithAsyncReply(), keyed by sync request ID.
+    HashMap<uint64_t, std::function<void (std::unique_ptr<MessageDecoder>)>> m_asyncReplyHandlers;
+
     Lock m_incomingSyncMessageCallbackMutex;
     HashMap<uint64_t, std::function<void ()>> m_incomingSyncMessageCallbacks;
     RefPtr<WorkQueue> m_incomingSyncMessageCallbackQueue;
@@ -390,6 +411,23 @@ template<typename T> bool Connection::sendSync(T&& message, typename T::Reply&&
     return replyDecoder->decode(reply);
 }
 
+template<typename T> bool Connection::sendWithAsyncReply(T&& message, uint64_t destinationID, typename T::AsyncReplyHandler replyHandler)
+{
+    COMPILE_ASSERT(T::isSync, SyncMessageExpected);
+
+    uint64_t syncRequestID = 0;
+    std::unique_ptr<MessageEncoder> encoder = createSyncMessageEncoder(T::receiverName(), T::name(), destinationID, syncRequestID);
+
+    // Encode the rest of the input arguments.
+    encoder->encode(message.arguments());
+
+    // The receiver handles this like any other sync message and replies through its DelayedReply
+    // object whenever it is ready, but the sender never blocks waiting for the reply.
+    return sendMessageWithAsyncReply(syncRequestID, WTFMove(encoder), [replyHandler](std::unique_ptr<MessageDecoder> replyDecoder) {
+        T::callReply(WTFMove(replyDecoder), replyHandler);
+    });
+}
+
 template<typename T> bool Connection::waitForAndDispatchImmediately(uint64_t destinationID, std::chrono::milliseconds timeout, unsigned waitForMessageFlags)
 {
     std::unique_ptr<MessageDecoder> decoder = waitForMessage(T::receiverName(), T::name(), destinationID, timeout, waitForMessageFlags);
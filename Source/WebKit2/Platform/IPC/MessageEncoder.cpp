@@ -43,6 +43,7 @@ MessageEncoder::MessageEncoder(StringReference messageReceiverName, StringRefere
     , m_destinationID(destinationID)
 {
     uuid_copy(m_UUID, UUID);
+    setAllowsOutOfLinePayloads();
     encodeHeader();
 }
 #endif
@@ -55,6 +56,7 @@ MessageEncoder::MessageEncoder(StringReference messageReceiverName, StringRefere
 #if HAVE(DTRACE)
     uuid_generate(m_UUID);
 #endif
+    setAllowsOutOfLinePayloads();
     encodeHeader();
 }
 
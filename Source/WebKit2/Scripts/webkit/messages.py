@@ -28,6 +28,7 @@ from webkit import parser
 WANTS_CONNECTION_ATTRIBUTE = 'WantsConnection'
 LEGACY_RECEIVER_ATTRIBUTE = 'LegacyReceiver'
 DELAYED_ATTRIBUTE = 'Delayed'
+ASYNC_REPLY_ATTRIBUTE = 'Async'
 
 _license_header = """/*
  * Copyright (C) 2010 Apple Inc. All rights reserved.
@@ -116,7 +117,7 @@ def message_to_struct_declaration(message):
     result.append('    static const bool isSync = %s;\n' % ('false', 'true')[message.reply_parameters != None])
     result.append('\n')
     if message.reply_parameters != None:
-        if message.has_attribute(DELAYED_ATTRIBUTE):
+        if message.has_attribute(DELAYED_ATTRIBUTE) or message.has_attribute(ASYNC_REPLY_ATTRIBUTE):
             send_parameters = [(function_parameter_type(x.type), x.name) for x in message.reply_parameters]
             result.append('    struct DelayedReply : public ThreadSafeRefCounted<DelayedReply> {\n')
             result.append('        DelayedReply(PassRefPtr<IPC::Connection>, std::unique_ptr<IPC::MessageEncoder>);\n')
@@ -129,6 +130,18 @@ def message_to_struct_declaration(message):
             result.append('        std::unique_ptr<IPC::MessageEncoder> m_encoder;\n')
             result.append('    };\n\n')
 
+        if message.has_attribute(ASYNC_REPLY_ATTRIBUTE):
+            result.append('    typedef std::function<void (%s)> AsyncReplyHandler;\n' % ', '.join([function_parameter_type(x.type) for x in message.reply_parameters]))
+            result.append('\n')
+            result.append('    static void callReply(std::unique_ptr<IPC::MessageDecoder> decoder, const AsyncReplyHandler& replyHandler)\n')
+            result.append('    {\n')
+            result += ['        %s %s { };\n' % (x.type, x.name) for x in message.reply_parameters]
+            result.append('        if (decoder) {\n')
+            result += ['            decoder->decode(%s);\n' % x.name for x in message.reply_parameters]
+            result.append('        }\n')
+            result.append('        replyHandler(%s);\n' % ', '.join([x.name for x in message.reply_parameters]))
+            result.append('    }\n\n')
+
         result.append('    typedef %s Reply;\n' % reply_type(message))
 
     if len(function_parameters):
@@ -179,9 +192,16 @@ def forward_declarations_and_headers(receiver):
     ])
 
     for message in receiver.messages:
-        if message.reply_parameters != None and message.has_attribute(DELAYED_ATTRIBUTE):
+        if message.reply_parameters != None and (message.has_attribute(DELAYED_ATTRIBUTE) or message.has_attribute(ASYNC_REPLY_ATTRIBUTE)):
             headers.add('<wtf/ThreadSafeRefCounted.h>')
             types_by_namespace['IPC'].update([('class', 'Connection')])
+        if message.reply_parameters != None and message.has_attribute(ASYNC_REPLY_ATTRIBUTE):
+            # callReply() constructs and decodes the reply arguments in the header, so it needs
+            # their full definitions rather than forward declarations.
+            headers.add('<functional>')
+            headers.add('"MessageDecoder.h"')
+            for parameter in message.reply_parameters:
+                headers.update(headers_for_type(parameter.type))
 
     for parameter in receiver.iterparameters():
         kind = parameter.kind
@@ -276,15 +296,17 @@ def async_message_statement(receiver, message):
 
 
 def sync_message_statement(receiver, message):
+    has_delayed_reply = message.has_attribute(DELAYED_ATTRIBUTE) or message.has_attribute(ASYNC_REPLY_ATTRIBUTE)
+
     dispatch_function = 'handleMessage'
-    if message.has_attribute(DELAYED_ATTRIBUTE):
+    if has_delayed_reply:
         dispatch_function += 'Delayed'
 
-    wants_connection = message.has_attribute(DELAYED_ATTRIBUTE) or message.has_attribute(WANTS_CONNECTION_ATTRIBUTE)
+    wants_connection = has_delayed_reply or message.has_attribute(WANTS_CONNECTION_ATTRIBUTE)
 
     result = []
     result.append('    if (decoder.messageName() == Messages::%s::%s::name()) {\n' % (receiver.name, message.name))
-    result.append('        IPC::%s<Messages::%s::%s>(%sdecoder, %sreplyEncoder, this, &%s);\n' % (dispatch_function, receiver.name, message.name, 'connection, ' if wants_connection else '', '' if message.has_attribute(DELAYED_ATTRIBUTE) else '*', handler_function(receiver, message)))
+    result.append('        IPC::%s<Messages::%s::%s>(%sdecoder, %sreplyEncoder, this, &%s);\n' % (dispatch_function, receiver.name, message.name, 'connection, ' if wants_connection else '', '' if has_delayed_reply else '*', handler_function(receiver, message)))
     result.append('        return;\n')
     result.append('    }\n')
     return surround_in_condition(''.join(result), message.condition)
@@ -474,7 +496,7 @@ def generate_message_handler(file):
 
     sync_delayed_messages = []
     for message in receiver.messages:
-        if message.reply_parameters != None and message.has_attribute(DELAYED_ATTRIBUTE):
+        if message.reply_parameters != None and (message.has_attribute(DELAYED_ATTRIBUTE) or message.has_attribute(ASYNC_REPLY_ATTRIBUTE)):
             sync_delayed_messages.append(message)
 
     if sync_delayed_messages:
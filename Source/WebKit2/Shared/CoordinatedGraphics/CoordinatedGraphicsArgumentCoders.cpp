@@ -44,6 +44,7 @@
 #include <WebCore/PerspectiveTransformOperation.h>
 #include <WebCore/RotateTransformOperation.h>
 #include <WebCore/ScaleTransformOperation.h>
+#include <WebCore/ScrollLinkedExpression.h>
 #include <WebCore/SkewTransformOperation.h>
 #include <WebCore/SurfaceUpdateInfo.h>
 #include <WebCore/TextureMapperAnimation.h>
@@ -599,6 +600,63 @@ bool ArgumentCoder<SurfaceUpdateInfo>::decode(ArgumentDecoder& decoder, SurfaceU
     return SimpleArgumentCoder<SurfaceUpdateInfo>::decode(decoder, surfaceUpdateInfo);
 }
 
+static void encodeScrollLinkedExpressionTerms(ArgumentEncoder& encoder, const ScrollLinkedExpression::Terms& terms)
+{
+    encoder << static_cast<uint32_t>(terms.size());
+    for (auto& term : terms) {
+        encoder << term.coefficient;
+        encoder << term.base;
+        encoder << term.minimum;
+        encoder << term.maximum;
+    }
+}
+
+static bool decodeScrollLinkedExpressionTerms(ArgumentDecoder& decoder, ScrollLinkedExpression::Terms& terms)
+{
+    uint32_t size;
+    if (!decoder.decode(size))
+        return false;
+
+    for (uint32_t i = 0; i < size; ++i) {
+        ScrollLinkedExpression::Term term;
+        if (!decoder.decode(term.coefficient))
+            return false;
+        if (!decoder.decode(term.base))
+            return false;
+        if (!decoder.decode(term.minimum))
+            return false;
+        if (!decoder.decode(term.maximum))
+            return false;
+        terms.append(term);
+    }
+
+    return true;
+}
+
+void ArgumentCoder<ScrollLinkedExpression>::encode(ArgumentEncoder& encoder, const ScrollLinkedExpression& expression)
+{
+    encodeScrollLinkedExpressionTerms(encoder, expression.horizontalTerms());
+    encodeScrollLinkedExpressionTerms(encoder, expression.verticalTerms());
+}
+
+bool ArgumentCoder<ScrollLinkedExpression>::decode(ArgumentDecoder& decoder, ScrollLinkedExpression& expression)
+{
+    ScrollLinkedExpression::Terms horizontalTerms;
+    if (!decodeScrollLinkedExpressionTerms(decoder, horizontalTerms))
+        return false;
+
+    ScrollLinkedExpression::Terms verticalTerms;
+    if (!decodeScrollLinkedExpressionTerms(decoder, verticalTerms))
+        return false;
+
+    for (auto& term : horizontalTerms)
+        expression.addHorizontalTerm(term);
+    for (auto& term : verticalTerms)
+        expression.addVerticalTerm(term);
+
+    return true;
+}
+
 void ArgumentCoder<CoordinatedGraphicsLayerState>::encode(ArgumentEncoder& encoder, const CoordinatedGraphicsLayerState& state)
 {
     encoder << state.changeMask;
@@ -678,6 +736,9 @@ void ArgumentCoder<CoordinatedGraphicsLayerState>::encode(ArgumentEncoder& encod
 
     if (state.committedScrollOffsetChanged)
         encoder << state.committedScrollOffset;
+
+    if (state.scrollLinkedExpressionChanged)
+        encoder << state.scrollLinkedExpression;
 }
 
 bool ArgumentCoder<CoordinatedGraphicsLayerState>::decode(ArgumentDecoder& decoder, CoordinatedGraphicsLayerState& state)
@@ -774,6 +835,9 @@ bool ArgumentCoder<CoordinatedGraphicsLayerState>::decode(ArgumentDecoder& decod
     if (state.committedScrollOffsetChanged && !decoder.decode(state.committedScrollOffset))
         return false;
 
+    if (state.scrollLinkedExpressionChanged && !decoder.decode(state.scrollLinkedExpression))
+        return false;
+
     return true;
 }
 
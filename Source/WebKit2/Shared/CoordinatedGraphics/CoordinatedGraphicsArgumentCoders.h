@@ -45,6 +45,7 @@ class TransformOperations;
 struct Length;
 
 class FilterOperations;
+class ScrollLinkedExpression;
 
 #if USE(GRAPHICS_SURFACE)
 struct GraphicsSurfaceToken;
@@ -85,6 +86,11 @@ template<> struct ArgumentCoder<WebCore::SurfaceUpdateInfo> {
     static bool decode(ArgumentDecoder&, WebCore::SurfaceUpdateInfo&);
 };
 
+template<> struct ArgumentCoder<WebCore::ScrollLinkedExpression> {
+    static void encode(ArgumentEncoder&, const WebCore::ScrollLinkedExpression&);
+    static bool decode(ArgumentDecoder&, WebCore::ScrollLinkedExpression&);
+};
+
 template<> struct ArgumentCoder<WebCore::CoordinatedGraphicsLayerState> {
     static void encode(ArgumentEncoder&, const WebCore::CoordinatedGraphicsLayerState&);
     static bool decode(ArgumentDecoder&, WebCore::CoordinatedGraphicsLayerState&);
@@ -157,7 +157,7 @@ void CoordinatedGraphicsScene::updateViewport()
 
 void CoordinatedGraphicsScene::adjustPositionForFixedLayers(const FloatPoint& contentPosition)
 {
-    if (m_fixedLayers.isEmpty())
+    if (m_fixedLayers.isEmpty() && m_scrollLinkedLayers.isEmpty())
         return;
 
     // Fixed layer positions are updated by the web process when we update the visible contents rect / scroll position.
@@ -167,6 +167,11 @@ void CoordinatedGraphicsScene::adjustPositionForFixedLayers(const FloatPoint& co
 
     for (auto& fixedLayer : m_fixedLayers.values())
         fixedLayer->setScrollPositionDeltaIfNeeded(delta);
+
+    // Scroll-linked layers (sticky boxes, parallax effects) track the same delta through
+    // their expressions, so they stay in sync with the viewport between updates too.
+    for (auto& scrollLinkedLayer : m_scrollLinkedLayers.values())
+        scrollLinkedLayer->setScrollPositionDeltaIfNeeded(scrollLinkedLayer->scrollLinkedExpression().evaluate(delta));
 }
 
 void CoordinatedGraphicsScene::syncPlatformLayerIfNeeded(TextureMapperLayer* layer, const CoordinatedGraphicsLayerState& state)
@@ -329,6 +334,14 @@ void CoordinatedGraphicsScene::setLayerState(CoordinatedLayerID id, const Coordi
         layer->setIsScrollable(layerState.isScrollable);
     }
 
+    if (layerState.scrollLinkedExpressionChanged) {
+        layer->setScrollLinkedExpression(layerState.scrollLinkedExpression);
+        if (layerState.scrollLinkedExpression.isEmpty())
+            m_scrollLinkedLayers.remove(id);
+        else
+            m_scrollLinkedLayers.add(id, layer);
+    }
+
     if (layerState.committedScrollOffsetChanged)
         layer->didCommitScrollOffset(layerState.committedScrollOffset);
 
@@ -377,6 +390,7 @@ void CoordinatedGraphicsScene::deleteLayer(CoordinatedLayerID layerID)
 
     m_backingStores.remove(layer.get());
     m_fixedLayers.remove(layerID);
+    m_scrollLinkedLayers.remove(layerID);
 #if USE(GRAPHICS_SURFACE)
     m_surfaceBackingStores.remove(layer.get());
 #endif
@@ -671,6 +685,7 @@ void CoordinatedGraphicsScene::purgeGLResources()
     m_rootLayerID = InvalidCoordinatedLayerID;
     m_layers.clear();
     m_fixedLayers.clear();
+    m_scrollLinkedLayers.clear();
     m_textureMapper = nullptr;
     m_backingStores.clear();
     m_backingStoresWithPendingBuffers.clear();
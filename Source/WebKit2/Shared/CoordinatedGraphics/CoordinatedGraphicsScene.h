@@ -194,6 +194,7 @@ private:
     LayerMap m_layers;
     typedef HashMap<WebCore::CoordinatedLayerID, WebCore::TextureMapperLayer*> LayerRawPtrMap;
     LayerRawPtrMap m_fixedLayers;
+    LayerRawPtrMap m_scrollLinkedLayers;
     WebCore::CoordinatedLayerID m_rootLayerID;
     WebCore::FloatPoint m_scrollPosition;
     WebCore::FloatPoint m_renderedContentsScrollPosition;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "SharedICUData.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unicode/putil.h>
+#include <unicode/udata.h>
+#include <unicode/utypes.h>
+#include <unicode/uvernum.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebKit {
+
+static CString icuCommonDataPath()
+{
+    const char* directory = u_getDataDirectory();
+    if (!directory || !directory[0])
+        directory = getenv("ICU_DATA");
+    if (!directory || !directory[0])
+        return CString();
+
+    // The common data file name encodes the ICU version and endianness,
+    // e.g. icudt55l.dat.
+    return String::format("%s/icudt" U_ICU_VERSION_SHORT "%c.dat", directory, U_IS_BIG_ENDIAN ? 'b' : 'l').utf8();
+}
+
+RefPtr<SharedMemory> sharedICUData()
+{
+    static NeverDestroyed<RefPtr<SharedMemory>> sharedData;
+    static bool triedToLoad;
+    if (triedToLoad)
+        return sharedData.get();
+    triedToLoad = true;
+
+    CString path = icuCommonDataPath();
+    if (path.isNull())
+        return nullptr;
+
+    FILE* file = fopen(path.data(), "rb");
+    if (!file)
+        return nullptr;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size <= 0) {
+        fclose(file);
+        return nullptr;
+    }
+
+    RefPtr<SharedMemory> memory = SharedMemory::allocate(size);
+    if (!memory || fread(memory->data(), 1, size, file) != static_cast<size_t>(size)) {
+        fclose(file);
+        return nullptr;
+    }
+    fclose(file);
+
+    sharedData.get() = memory;
+    return sharedData.get();
+}
+
+void applySharedICUData(const SharedMemory& memory)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    udata_setCommonData(memory.data(), &status);
+    // On failure ICU keeps loading its data privately; there is nothing to
+    // undo, so errors are deliberately ignored.
+}
+
+} // namespace WebKit
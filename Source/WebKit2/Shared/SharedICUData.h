@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SharedICUData_h
+#define SharedICUData_h
+
+#include "SharedMemory.h"
+#include <wtf/RefPtr.h>
+
+namespace WebKit {
+
+// The ICU common data file is immutable and identical in every process, and
+// ICU normally maps or reads a private copy per process. The UI process loads
+// it into shared memory once and vends a read-only handle to each web process
+// through WebProcessCreationParameters, so one resident copy serves the whole
+// machine.
+
+// UI process: returns the shared copy of the ICU common data, loading it on
+// first use. Returns null if the data file can't be located; web processes
+// then fall back to letting ICU open the file themselves.
+RefPtr<SharedMemory> sharedICUData();
+
+// Web process: hands mapped read-only common data to ICU. Must be called
+// before anything triggers ICU initialization. Failure is harmless — ICU
+// keeps loading its data privately, which only costs memory.
+void applySharedICUData(const SharedMemory&);
+
+} // namespace WebKit
+
+#endif // SharedICUData_h
@@ -81,6 +81,9 @@ void WebProcessCreationParameters::encode(IPC::ArgumentEncoder& encoder) const
 #endif
     encoder << mediaKeyStorageDirectory;
     encoder << mediaKeyStorageDirectoryExtensionHandle;
+    encoder << !icuDataHandle.isNull();
+    if (!icuDataHandle.isNull())
+        encoder << icuDataHandle;
     encoder << shouldUseTestingNetworkSession;
     encoder << urlSchemesRegisteredAsEmptyDocument;
     encoder << urlSchemesRegisteredAsSecure;
@@ -185,6 +188,13 @@ bool WebProcessCreationParameters::decode(IPC::ArgumentDecoder& decoder, WebProc
         return false;
     if (!decoder.decode(parameters.mediaKeyStorageDirectoryExtensionHandle))
         return false;
+    bool hasICUDataHandle;
+    if (!decoder.decode(hasICUDataHandle))
+        return false;
+    if (hasICUDataHandle) {
+        if (!decoder.decode(parameters.icuDataHandle))
+            return false;
+    }
     if (!decoder.decode(parameters.shouldUseTestingNetworkSession))
         return false;
     if (!decoder.decode(parameters.urlSchemesRegisteredAsEmptyDocument))
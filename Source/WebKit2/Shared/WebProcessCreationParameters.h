@@ -28,6 +28,7 @@
 
 #include "CacheModel.h"
 #include "SandboxExtension.h"
+#include "SharedMemory.h"
 #include "TextCheckerState.h"
 #include "UserData.h"
 #include <WebCore/SessionID.h>
@@ -86,6 +87,10 @@ struct WebProcessCreationParameters {
     SandboxExtension::Handle mediaKeyStorageDirectoryExtensionHandle;
     String mediaKeyStorageDirectory;
 
+    // Read-only copy of the ICU common data, shared across all web processes
+    // (see SharedICUData.h). Null if the UI process couldn't locate the data.
+    SharedMemory::Handle icuDataHandle;
+
     bool shouldUseTestingNetworkSession;
 
     Vector<String> urlSchemesRegisteredAsEmptyDocument;
@@ -281,7 +281,10 @@ static std::error_code compiledToFile(String&& json, const String& finalFilePath
 
 static RefPtr<API::UserContentExtension> createExtension(const String& identifier, const ContentExtensionMetaData& metaData, const Data& fileData)
 {
-    auto sharedMemory = WebKit::SharedMemory::create(const_cast<uint8_t*>(fileData.data()), fileData.size(), WebKit::SharedMemory::Protection::ReadOnly);
+    // The compiled file is already memory-mapped; share the mapping itself instead of copying
+    // the bytecode into freshly allocated shared memory. That keeps the rules file-backed in
+    // every process, so only the pages the interpreter actually touches ever become resident.
+    auto sharedMemory = fileData.tryCreateSharedMemory();
     auto compiledContentExtensionData = WebKit::WebCompiledContentExtensionData(
         WTFMove(sharedMemory),
         fileData,
@@ -2598,6 +2598,11 @@ void WKPagePostMessageToInjectedBundle(WKPageRef pageRef, WKStringRef messageNam
     toImpl(pageRef)->postMessageToInjectedBundle(toImpl(messageNameRef)->string(), toImpl(messageBodyRef));
 }
 
+void WKPagePrefetchResources(WKPageRef pageRef, WKArrayRef urlsRef, uint64_t byteBudget)
+{
+    toImpl(pageRef)->prefetchResources(toImpl(urlsRef)->toStringVector(), byteBudget);
+}
+
 WKArrayRef WKPageCopyRelatedPages(WKPageRef pageRef)
 {
     Vector<RefPtr<API::Object>> relatedPages;
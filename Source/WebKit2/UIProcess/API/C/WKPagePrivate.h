@@ -98,6 +98,11 @@ WK_EXPORT void WKPageIsWebProcessResponsive(WKPageRef page, void* context, WKPag
     
 WK_EXPORT WKArrayRef WKPageCopyRelatedPages(WKPageRef page);
 
+// Requests that the page pull the given resources (an array of WKStringRef URLs, in
+// priority order) into its caches at the lowest network priority. A byteBudget of 0
+// means unlimited; otherwise prefetching stops once that many bytes have been fetched.
+WK_EXPORT void WKPagePrefetchResources(WKPageRef page, WKArrayRef urls, uint64_t byteBudget);
+
 enum {
     kWKScrollPinningBehaviorDoNotPin,
     kWKScrollPinningBehaviorPinToTop,
@@ -830,6 +830,8 @@ void WebPageProxy::close()
 
     m_isClosed = true;
 
+    m_process->processPool().sendToNetworkingProcess(Messages::NetworkProcess::WebPageVisibilityDidChange(m_pageID, false));
+
     if (m_activePopupMenu)
         m_activePopupMenu->cancelTracking();
 
@@ -1083,6 +1085,14 @@ void WebPageProxy::stopLoading()
     m_process->responsivenessTimer().start();
 }
 
+void WebPageProxy::prefetchResources(const Vector<String>& urls, uint64_t byteBudget)
+{
+    if (!isValid())
+        return;
+
+    m_process->send(Messages::WebPage::PrefetchResources(urls, byteBudget), m_pageID);
+}
+
 RefPtr<API::Navigation> WebPageProxy::reload(bool reloadFromOrigin, bool contentBlockersEnabled)
 {
     SandboxExtension::Handle sandboxExtensionHandle;
@@ -1459,6 +1469,10 @@ void WebPageProxy::dispatchViewStateChange()
     if (changed || m_viewStateChangeWantsSynchronousReply || !m_nextViewStateChangeCallbacks.isEmpty())
         m_process->send(Messages::WebPage::SetViewState(m_viewState, m_viewStateChangeWantsSynchronousReply, m_nextViewStateChangeCallbacks), m_pageID);
 
+    // Let the network process load scheduler favor loads for visible pages.
+    if (changed & ViewState::IsVisible)
+        m_process->processPool().sendToNetworkingProcess(Messages::NetworkProcess::WebPageVisibilityDidChange(m_pageID, isViewVisible()));
+
     m_nextViewStateChangeCallbacks.clear();
 
     // This must happen after the SetViewState message is sent, to ensure the page visibility event can fire.
@@ -2694,6 +2708,17 @@ void WebPageProxy::getBytecodeProfile(std::function<void (const String&, Callbac
     m_process->send(Messages::WebPage::GetBytecodeProfile(callbackID), m_pageID);
 }
 
+void WebPageProxy::getMemorySnapshot(std::function<void (const String&, CallbackBase::Error)> callbackFunction)
+{
+    if (!isValid()) {
+        callbackFunction(String(), CallbackBase::Error::Unknown);
+        return;
+    }
+
+    uint64_t callbackID = m_callbacks.put(WTFMove(callbackFunction), m_process->throttler().backgroundActivityToken());
+    m_process->send(Messages::WebPage::GetMemorySnapshot(callbackID), m_pageID);
+}
+
 void WebPageProxy::isWebProcessResponsive(std::function<void (bool isWebProcessResponsive)> callbackFunction)
 {
     if (!isValid()) {
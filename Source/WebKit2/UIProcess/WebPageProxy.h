@@ -377,6 +377,7 @@ public:
     void navigateToPDFLinkWithSimulatedClick(const String& url, WebCore::IntPoint documentPoint, WebCore::IntPoint screenPoint);
 
     void stopLoading();
+    void prefetchResources(const Vector<String>& urls, uint64_t byteBudget);
     RefPtr<API::Navigation> reload(bool reloadFromOrigin, bool contentBlockersEnabled);
 
     RefPtr<API::Navigation> goForward();
@@ -755,6 +756,10 @@ public:
 
     void getContentsAsString(std::function<void (const String&, CallbackBase::Error)>);
     void getBytecodeProfile(std::function<void (const String&, CallbackBase::Error)>);
+
+    // Returns a JSON dictionary with this page's share of process memory (documents,
+    // renderers, cached resources) plus the process-wide JS heap and malloc numbers.
+    void getMemorySnapshot(std::function<void (const String&, CallbackBase::Error)>);
     void isWebProcessResponsive(std::function<void (bool isWebProcessResponsive)>);
 
 #if ENABLE(MHTML)
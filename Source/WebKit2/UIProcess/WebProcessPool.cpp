@@ -40,6 +40,7 @@
 #include "NetworkProcessMessages.h"
 #include "NetworkProcessProxy.h"
 #include "SandboxExtension.h"
+#include "SharedICUData.h"
 #include "StatisticsData.h"
 #include "TextChecker.h"
 #include "WKContextPrivate.h"
@@ -560,6 +561,9 @@ WebProcessProxy& WebProcessPool::createNewWebProcess()
     if (!parameters.mediaKeyStorageDirectory.isEmpty())
         SandboxExtension::createHandleForReadWriteDirectory(parameters.mediaKeyStorageDirectory, parameters.mediaKeyStorageDirectoryExtensionHandle);
 
+    if (RefPtr<SharedMemory> icuData = sharedICUData())
+        icuData->createHandle(parameters.icuDataHandle, SharedMemory::Protection::ReadOnly);
+
     parameters.shouldUseTestingNetworkSession = m_shouldUseTestingNetworkSession;
 
     parameters.cacheModel = cacheModel();
@@ -665,6 +669,15 @@ void WebProcessPool::warmInitialProcess()
     m_haveInitialEmptyProcess = true;
 }
 
+void WebProcessPool::prewarmProcesses()
+{
+    // Top up the pool of prewarmed processes. They are fully launched and initialized (the
+    // initialization parameters are pool-wide, not page-specific), so adopting one for a new
+    // page skips the process spin-up cost entirely.
+    while (m_prewarmedProcesses.size() < m_configuration->maximumPrewarmedProcessCount() && m_processes.size() < maximumNumberOfProcesses())
+        m_prewarmedProcesses.append(&createNewWebProcess());
+}
+
 void WebProcessPool::enableProcessTermination()
 {
     m_processTerminationEnabled = true;
@@ -726,6 +739,7 @@ void WebProcessPool::disconnectProcess(WebProcessProxy* process)
 
     static_cast<WebContextSupplement*>(supplement<WebGeolocationManagerProxy>())->processDidClose(process);
 
+    m_prewarmedProcesses.removeFirst(process);
     m_processes.removeFirst(process);
 }
 
@@ -763,9 +777,20 @@ Ref<WebPageProxy> WebProcessPool::createWebPage(PageClient& pageClient, Ref<API:
     } else if (pageConfiguration->relatedPage()) {
         // Sharing processes, e.g. when creating the page via window.open().
         process = &pageConfiguration->relatedPage()->process();
-    } else
+    } else if (!m_prewarmedProcesses.isEmpty())
+        process = m_prewarmedProcesses.takeLast();
+    else
         process = &createNewWebProcessRespectingProcessCountLimit();
 
+    if (m_configuration->maximumPrewarmedProcessCount()) {
+        // Refill the prewarmed process pool asynchronously so launching the replacement doesn't
+        // compete with setting up the new page.
+        RefPtr<WebProcessPool> protectedThis(this);
+        RunLoop::main().dispatch([protectedThis] {
+            protectedThis->prewarmProcesses();
+        });
+    }
+
     return process->createWebPage(pageClient, WTFMove(pageConfiguration));
 }
 
@@ -249,6 +249,7 @@ public:
 
     WebProcessProxy& createNewWebProcessRespectingProcessCountLimit(); // Will return an existing one if limit is met.
     void warmInitialProcess();
+    void prewarmProcesses();
 
     bool shouldTerminate(WebProcessProxy*);
 
@@ -416,6 +417,10 @@ private:
     Vector<RefPtr<WebProcessProxy>> m_processes;
     bool m_haveInitialEmptyProcess;
 
+    // Processes that have been launched and initialized ahead of time, waiting for their first page.
+    // These are also in m_processes.
+    Vector<RefPtr<WebProcessProxy>> m_prewarmedProcesses;
+
     WebProcessProxy* m_processWithPageCache;
 
     Ref<WebPageGroup> m_defaultPageGroup;
@@ -56,7 +56,7 @@
 
 #endif
 
-#if PLATFORM(GTK)
+#if PLATFORM(GTK) || PLATFORM(EFL)
 #define ENABLE_SHAREABLE_RESOURCE 1
 #endif
 
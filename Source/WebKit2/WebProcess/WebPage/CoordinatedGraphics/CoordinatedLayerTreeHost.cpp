@@ -40,6 +40,7 @@
 #include "WebPageProxyMessages.h"
 #include <WebCore/Frame.h>
 #include <WebCore/FrameView.h>
+#include <WebCore/GCController.h>
 #include <WebCore/MainFrame.h>
 #include <WebCore/PageOverlayController.h>
 #include <WebCore/Settings.h>
@@ -235,6 +236,13 @@ void CoordinatedLayerTreeHost::commitSceneState(const WebCore::CoordinatedGraphi
 {
     m_webPage->send(Messages::CoordinatedLayerTreeHostProxy::CommitCoordinatedGraphicsState(state));
     m_isWaitingForRenderer = true;
+
+#if ENABLE(REQUEST_ANIMATION_FRAME)
+    // We just handed a frame to the UI process and won't flush again before the next
+    // animation service time, so the rest of the frame interval is expected idle time.
+    // Offer it to the garbage collector for pending eden collections and sweep slices.
+    GCController::singleton().garbageCollectDuringIdlePeriod(m_coordinator->nextAnimationServiceTime());
+#endif
 }
 
 PassRefPtr<CoordinatedSurface> CoordinatedLayerTreeHost::createCoordinatedSurface(const IntSize& size, CoordinatedSurface::Flags flags)
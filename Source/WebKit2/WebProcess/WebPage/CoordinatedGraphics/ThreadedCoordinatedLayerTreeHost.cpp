@@ -39,6 +39,7 @@
 #include <WebCore/CoordinatedGraphicsState.h>
 #include <WebCore/Frame.h>
 #include <WebCore/FrameView.h>
+#include <WebCore/GCController.h>
 #include <WebCore/GraphicsContext.h>
 #include <WebCore/MainFrame.h>
 #include <WebCore/Page.h>
@@ -290,6 +291,13 @@ void ThreadedCoordinatedLayerTreeHost::commitSceneState(const CoordinatedGraphic
 {
     m_isWaitingForRenderer = true;
     m_compositor->updateSceneState(state);
+
+#if ENABLE(REQUEST_ANIMATION_FRAME)
+    // The compositor thread owns the frame from here until it calls back with
+    // renderNextFrame(), so the rest of the frame interval is expected idle time on this
+    // thread. Offer it to the garbage collector for pending eden collections and sweep slices.
+    GCController::singleton().garbageCollectDuringIdlePeriod(m_coordinator->nextAnimationServiceTime());
+#endif
 }
 
 void ThreadedCoordinatedLayerTreeHost::paintLayerContents(const GraphicsLayer*, GraphicsContext&, const IntRect&)
@@ -143,6 +143,7 @@
 #include <WebCore/RenderLayer.h>
 #include <WebCore/RenderTreeAsText.h>
 #include <WebCore/RenderView.h>
+#include <WebCore/ResourcePrefetcher.h>
 #include <WebCore/ResourceRequest.h>
 #include <WebCore/ResourceResponse.h>
 #include <WebCore/RuntimeEnabledFeatures.h>
@@ -168,6 +169,7 @@
 #include <runtime/JSLock.h>
 #include <wtf/RunLoop.h>
 #include <wtf/TemporaryChange.h>
+#include <wtf/text/StringBuilder.h>
 
 #if ENABLE(DATA_DETECTION)
 #include "DataDetectionResult.h"
@@ -1172,6 +1174,16 @@ void WebPage::stopLoading()
     corePage()->userInputBridge().stopLoadingFrame(m_mainFrame->coreFrame());
 }
 
+void WebPage::prefetchResources(const Vector<String>& urlStrings, uint64_t byteBudget)
+{
+    Vector<URL> urls;
+    urls.reserveInitialCapacity(urlStrings.size());
+    for (auto& urlString : urlStrings)
+        urls.uncheckedAppend(URL(URL(), urlString));
+
+    m_page->resourcePrefetcher().prefetch(WTFMove(urls), byteBudget);
+}
+
 bool WebPage::defersLoading() const
 {
     return m_page->defersLoading();
@@ -5034,6 +5046,49 @@ void WebPage::getBytecodeProfile(uint64_t callbackID)
     send(Messages::WebPageProxy::StringCallback(result, callbackID));
 }
 
+static void appendMemorySnapshotNumber(StringBuilder& snapshot, const char* key, uint64_t value)
+{
+    if (snapshot.length() > 1)
+        snapshot.append(',');
+    snapshot.append('"');
+    snapshot.append(key);
+    snapshot.appendLiteral("\":");
+    snapshot.appendNumber(value);
+}
+
+void WebPage::getMemorySnapshot(uint64_t callbackID)
+{
+    // The per-page numbers come from WebCore; the JS heap and the malloc pools are
+    // shared by every page in this process, so they are included as process-wide
+    // context rather than attributed to this page.
+    Page::MemoryUsage pageMemoryUsage;
+    if (m_page)
+        pageMemoryUsage = m_page->memoryUsage();
+
+    StringBuilder snapshot;
+    snapshot.append('{');
+    appendMemorySnapshotNumber(snapshot, "DocumentCount", pageMemoryUsage.documentCount);
+    appendMemorySnapshotNumber(snapshot, "RendererCount", pageMemoryUsage.rendererCount);
+    appendMemorySnapshotNumber(snapshot, "CachedResourceCount", pageMemoryUsage.cachedResourceCount);
+    appendMemorySnapshotNumber(snapshot, "CachedResourceEncodedBytes", pageMemoryUsage.cachedResourceEncodedBytes);
+    appendMemorySnapshotNumber(snapshot, "CachedResourceDecodedBytes", pageMemoryUsage.cachedResourceDecodedBytes);
+
+    {
+        JSLockHolder lock(JSDOMWindow::commonVM());
+        uint64_t javaScriptHeapSize = JSDOMWindow::commonVM().heap.size();
+        appendMemorySnapshotNumber(snapshot, "JavaScriptHeapSize", javaScriptHeapSize);
+        appendMemorySnapshotNumber(snapshot, "JavaScriptHeapCapacity", JSDOMWindow::commonVM().heap.capacity());
+    }
+
+    WTF::FastMallocStatistics fastMallocStatistics = WTF::fastMallocStatistics();
+    appendMemorySnapshotNumber(snapshot, "FastMallocReservedVMBytes", fastMallocStatistics.reservedVMBytes);
+    appendMemorySnapshotNumber(snapshot, "FastMallocCommittedVMBytes", fastMallocStatistics.committedVMBytes);
+    appendMemorySnapshotNumber(snapshot, "FastMallocFreeListBytes", fastMallocStatistics.freeListBytes);
+    snapshot.append('}');
+
+    send(Messages::WebPageProxy::StringCallback(snapshot.toString(), callbackID));
+}
+
 PassRefPtr<WebCore::Range> WebPage::rangeFromEditingRange(WebCore::Frame& frame, const EditingRange& range, EditingRangeIsRelativeTo editingRangeIsRelativeTo)
 {
     ASSERT(range.location != notFound);
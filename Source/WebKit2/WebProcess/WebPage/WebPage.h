@@ -412,6 +412,7 @@ public:
 
     void stopLoading();
     void stopLoadingFrame(uint64_t frameID);
+    void prefetchResources(const Vector<String>& urls, uint64_t byteBudget);
     bool defersLoading() const;
     void setDefersLoading(bool deferLoading);
 
@@ -889,7 +890,8 @@ public:
     void updateCachedDocumentLoader(WebDocumentLoader&, WebCore::Frame&);
 
     void getBytecodeProfile(uint64_t callbackID);
-    
+    void getMemorySnapshot(uint64_t callbackID);
+
 #if ENABLE(SERVICE_CONTROLS) || ENABLE(TELEPHONE_NUMBER_DETECTION)
     void handleTelephoneNumberClick(const String& number, const WebCore::IntPoint&);
     void handleSelectionServiceClick(WebCore::FrameSelection&, const Vector<String>& telephoneNumbers, const WebCore::IntPoint&);
@@ -39,6 +39,7 @@
 #include "NetworkProcessConnection.h"
 #include "PluginProcessConnectionManager.h"
 #include "SessionTracker.h"
+#include "SharedICUData.h"
 #include "StatisticsData.h"
 #include "UserData.h"
 #include "WebConnectionToUIProcess.h"
@@ -244,6 +245,17 @@ void WebProcess::initializeWebProcess(WebProcessCreationParameters&& parameters)
 {
     ASSERT(m_pageMap.isEmpty());
 
+    // Adopt the UI process's copy of the ICU common data before anything
+    // makes ICU load the data privately.
+    if (!parameters.icuDataHandle.isNull()) {
+        if (RefPtr<SharedMemory> icuData = SharedMemory::map(parameters.icuDataHandle, SharedMemory::Protection::ReadOnly)) {
+            applySharedICUData(*icuData);
+            // ICU references the data for the life of the process, so the
+            // mapping is never torn down.
+            icuData.leakRef();
+        }
+    }
+
 #if OS(LINUX)
     WebCore::MemoryPressureHandler::ReliefLogger::setLoggingEnabled(parameters.shouldEnableMemoryPressureReliefLogging);
 #endif
@@ -361,6 +373,9 @@ void WebProcess::initializeWebProcess(WebProcessCreationParameters&& parameters)
         }
     }
 #endif
+
+    // Create the common VM now so the first page created in this process doesn't have to pay for it.
+    JSDOMWindow::commonVM();
 }
 
 void WebProcess::ensureNetworkProcessConnection()
@@ -943,7 +958,20 @@ void WebProcess::getWebCoreStatistics(uint64_t callbackID)
     
     // Get WebCore memory cache statistics
     getWebCoreMemoryCacheStatistics(data.webCoreCacheStatistics);
-    
+
+    // Gather sync IPC wait statistics.
+    for (auto& entry : IPC::Connection::syncWaitStatistics()) {
+        String prefix = "SyncIPCWait " + entry.key + " ";
+        auto& histogram = entry.value;
+        data.statisticsNumbers.set(prefix + "Count", histogram.count);
+        data.statisticsNumbers.set(prefix + "TotalMilliseconds", histogram.totalMilliseconds);
+        data.statisticsNumbers.set(prefix + "MaximumMilliseconds", histogram.maximumMilliseconds);
+        for (unsigned i = 0; i < IPC::Connection::SyncWaitHistogram::bucketCount; ++i) {
+            if (histogram.buckets[i])
+                data.statisticsNumbers.set(prefix + "Bucket" + String::number(i), histogram.buckets[i]);
+        }
+    }
+
     parentProcessConnection()->send(Messages::WebProcessPool::DidGetStatistics(data, callbackID), 0);
 }
 
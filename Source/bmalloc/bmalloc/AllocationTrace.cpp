@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "AllocationTrace.h"
+
+#if BENABLE_ALLOCATION_TRACE
+
+#include "StaticMutex.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+namespace bmalloc {
+
+static StaticMutex s_traceMutex;
+static int s_traceFile = -1;
+
+static void writeTraceRecord(const char* record, size_t length)
+{
+    std::lock_guard<StaticMutex> lock(s_traceMutex);
+
+    if (s_traceFile == -1) {
+        char path[64];
+        snprintf(path, sizeof(path), "bmalloc-trace-%d.log", getpid());
+        s_traceFile = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (s_traceFile == -1)
+            return;
+    }
+
+    write(s_traceFile, record, length);
+}
+
+void traceAllocate(void* object, size_t size)
+{
+    char record[64];
+    int length = snprintf(record, sizeof(record), "a %p %zu\n", object, size);
+    if (length > 0)
+        writeTraceRecord(record, length);
+}
+
+void traceDeallocate(void* object)
+{
+    char record[64];
+    int length = snprintf(record, sizeof(record), "d %p\n", object);
+    if (length > 0)
+        writeTraceRecord(record, length);
+}
+
+} // namespace bmalloc
+
+#endif // BENABLE_ALLOCATION_TRACE
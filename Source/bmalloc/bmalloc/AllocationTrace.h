@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AllocationTrace_h
+#define AllocationTrace_h
+
+#include <stddef.h>
+
+// Compile-time-gated capture of every allocate / deallocate as a text trace,
+// for replaying real WebContent allocation mixes through MallocBench
+// (PerformanceTests/MallocBench trace_replay). Off by default; builds with it
+// enabled pay for a function call and a mutex on every malloc operation, so
+// never ship with it on.
+#ifndef BENABLE_ALLOCATION_TRACE
+#define BENABLE_ALLOCATION_TRACE 0
+#endif
+
+#if BENABLE_ALLOCATION_TRACE
+
+namespace bmalloc {
+
+// The trace is written to bmalloc-trace-<pid>.log in the process's working
+// directory, one operation per line:
+//
+//     a <pointer> <size>
+//     d <pointer>
+//
+// Records are written with the write() syscall out of a static buffer, so
+// tracing never allocates and is safe to call from inside the allocator.
+void traceAllocate(void*, size_t);
+void traceDeallocate(void*);
+
+} // namespace bmalloc
+
+#endif // BENABLE_ALLOCATION_TRACE
+
+#endif // AllocationTrace_h
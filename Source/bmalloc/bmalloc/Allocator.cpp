@@ -31,6 +31,7 @@
 #include "PerProcess.h"
 #include "Sizes.h"
 #include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 
 using namespace std;
@@ -38,11 +39,16 @@ using namespace std;
 namespace bmalloc {
 
 Allocator::Allocator(Heap* heap, Deallocator& deallocator)
-    : m_isBmallocEnabled(heap->environment().isBmallocEnabled())
+    : m_refillsSinceAdaptation(0)
+    , m_isBmallocEnabled(heap->environment().isBmallocEnabled())
     , m_deallocator(deallocator)
 {
     for (size_t sizeClass = 0; sizeClass < sizeClassCount; ++sizeClass)
         m_bumpAllocators[sizeClass].init(objectSize(sizeClass));
+
+    m_refillHits.fill(0);
+    m_refillMisses.fill(0);
+    m_epochsSinceUse.fill(0);
 }
 
 Allocator::~Allocator()
@@ -59,7 +65,12 @@ void* Allocator::tryAllocate(size_t size)
         return allocate(size);
 
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
-    return PerProcess<Heap>::getFastCase()->tryAllocateLarge(lock, alignment, size);
+    void* object = PerProcess<Heap>::getFastCase()->tryAllocateLarge(lock, alignment, size);
+#if BENABLE_ALLOCATION_TRACE
+    if (object)
+        traceAllocate(object, size);
+#endif
+    return object;
 }
 
 void* Allocator::allocate(size_t alignment, size_t size)
@@ -80,7 +91,11 @@ void* Allocator::allocate(size_t alignment, size_t size)
         return allocate(roundUpToMultipleOf(alignment, size));
 
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
-    return PerProcess<Heap>::getFastCase()->allocateLarge(lock, alignment, size);
+    void* object = PerProcess<Heap>::getFastCase()->allocateLarge(lock, alignment, size);
+#if BENABLE_ALLOCATION_TRACE
+    traceAllocate(object, size);
+#endif
+    return object;
 }
 
 void* Allocator::reallocate(void* object, size_t newSize)
@@ -118,22 +133,56 @@ void* Allocator::reallocate(void* object, size_t newSize)
     return result;
 }
 
-void Allocator::scavenge()
+void Allocator::scavenge(size_t sizeClass)
 {
-    for (size_t sizeClass = 0; sizeClass < sizeClassCount; ++sizeClass) {
-        BumpAllocator& allocator = m_bumpAllocators[sizeClass];
-        BumpRangeCache& bumpRangeCache = m_bumpRangeCaches[sizeClass];
+    BumpAllocator& allocator = m_bumpAllocators[sizeClass];
+    BumpRangeCache& bumpRangeCache = m_bumpRangeCaches[sizeClass];
+
+    while (allocator.canAllocate())
+        m_deallocator.deallocate(allocator.allocate());
 
+    while (bumpRangeCache.size()) {
+        allocator.refill(bumpRangeCache.pop());
         while (allocator.canAllocate())
             m_deallocator.deallocate(allocator.allocate());
+    }
 
-        while (bumpRangeCache.size()) {
-            allocator.refill(bumpRangeCache.pop());
-            while (allocator.canAllocate())
-                m_deallocator.deallocate(allocator.allocate());
-        }
+    allocator.clear();
+}
+
+void Allocator::scavenge()
+{
+    for (size_t sizeClass = 0; sizeClass < sizeClassCount; ++sizeClass)
+        scavenge(sizeClass);
+}
+
+void Allocator::adapt()
+{
+    // Refill activity is our proxy for whether a size class is still in use: a class whose
+    // working set fits its current bump ranges doesn't refill, but it also isn't holding
+    // much. A class that goes allocatorColdEpochThreshold adaptation epochs without a
+    // refill gets its cached ranges returned to the heap so other size classes (or other
+    // threads) can reuse the memory.
+    m_refillsSinceAdaptation = 0;
+    for (size_t sizeClass = 0; sizeClass < sizeClassCount; ++sizeClass) {
+        if (m_epochsSinceUse[sizeClass] >= allocatorColdEpochThreshold)
+            continue;
+        if (++m_epochsSinceUse[sizeClass] == allocatorColdEpochThreshold)
+            scavenge(sizeClass);
+    }
+}
 
-        allocator.clear();
+void Allocator::dumpStats()
+{
+    fprintf(stderr, "bmalloc per-thread refill stats:\n");
+    fprintf(stderr, "%10s %12s %12s %8s\n", "size", "cache hits", "heap trips", "hit%");
+    for (size_t sizeClass = 0; sizeClass < sizeClassCount; ++sizeClass) {
+        unsigned hits = m_refillHits[sizeClass];
+        unsigned misses = m_refillMisses[sizeClass];
+        if (!hits && !misses)
+            continue;
+        fprintf(stderr, "%10zu %12u %12u %7.1f%%\n", objectSize(sizeClass), hits, misses,
+            100.0 * hits / (hits + misses));
     }
 }
 
@@ -141,6 +190,10 @@ NO_INLINE void Allocator::refillAllocatorSlowCase(BumpAllocator& allocator, size
 {
     BumpRangeCache& bumpRangeCache = m_bumpRangeCaches[sizeClass];
 
+    ++m_refillMisses[sizeClass];
+    if (++m_refillsSinceAdaptation >= allocatorAdaptationInterval)
+        adapt();
+
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
     m_deallocator.processObjectLog(lock);
     PerProcess<Heap>::getFastCase()->allocateSmallBumpRanges(lock, sizeClass, allocator, bumpRangeCache);
@@ -148,9 +201,11 @@ NO_INLINE void Allocator::refillAllocatorSlowCase(BumpAllocator& allocator, size
 
 INLINE void Allocator::refillAllocator(BumpAllocator& allocator, size_t sizeClass)
 {
+    m_epochsSinceUse[sizeClass] = 0;
     BumpRangeCache& bumpRangeCache = m_bumpRangeCaches[sizeClass];
     if (!bumpRangeCache.size())
         return refillAllocatorSlowCase(allocator, sizeClass);
+    ++m_refillHits[sizeClass];
     return allocator.refill(bumpRangeCache.pop());
 }
 
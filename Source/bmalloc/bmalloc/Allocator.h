@@ -26,6 +26,7 @@
 #ifndef Allocator_h
 #define Allocator_h
 
+#include "AllocationTrace.h"
 #include "BumpAllocator.h"
 #include <array>
 
@@ -47,20 +48,31 @@ public:
     void* reallocate(void*, size_t);
 
     void scavenge();
+    void dumpStats();
 
 private:
     bool allocateFastCase(size_t, void*&);
     void* allocateSlowCase(size_t);
-    
+
     void* allocateLogSizeClass(size_t);
     void* allocateLarge(size_t);
-    
+
     void refillAllocator(BumpAllocator&, size_t sizeClass);
     void refillAllocatorSlowCase(BumpAllocator&, size_t sizeClass);
-    
+
+    void scavenge(size_t sizeClass);
+    void adapt();
+
     std::array<BumpAllocator, sizeClassCount> m_bumpAllocators;
     std::array<BumpRangeCache, sizeClassCount> m_bumpRangeCaches;
 
+    // Refill telemetry. A hit is a refill served from the per-thread range cache; a miss
+    // required taking the heap lock. The fast bump path is deliberately not counted.
+    std::array<unsigned, sizeClassCount> m_refillHits;
+    std::array<unsigned, sizeClassCount> m_refillMisses;
+    std::array<unsigned char, sizeClassCount> m_epochsSinceUse;
+    unsigned m_refillsSinceAdaptation;
+
     bool m_isBmallocEnabled;
     Deallocator& m_deallocator;
 };
@@ -82,7 +94,10 @@ inline void* Allocator::allocate(size_t size)
 {
     void* object;
     if (!allocateFastCase(size, object))
-        return allocateSlowCase(size);
+        object = allocateSlowCase(size);
+#if BENABLE_ALLOCATION_TRACE
+    traceAllocate(object, size);
+#endif
     return object;
 }
 
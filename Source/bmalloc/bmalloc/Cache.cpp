@@ -50,6 +50,15 @@ void Cache::scavenge()
     cache->deallocator().scavenge();
 }
 
+void Cache::dumpStats()
+{
+    Cache* cache = PerThread<Cache>::getFastCase();
+    if (!cache)
+        return;
+
+    cache->allocator().dumpStats();
+}
+
 Cache::Cache()
     : m_deallocator(PerProcess<Heap>::get())
     , m_allocator(PerProcess<Heap>::get(), m_deallocator)
@@ -26,6 +26,7 @@
 #ifndef Deallocator_h
 #define Deallocator_h
 
+#include "AllocationTrace.h"
 #include "FixedVector.h"
 #include <mutex>
 
@@ -70,6 +71,9 @@ inline bool Deallocator::deallocateFastCase(void* object)
 
 inline void Deallocator::deallocate(void* object)
 {
+#if BENABLE_ALLOCATION_TRACE
+    traceDeallocate(object);
+#endif
     if (!deallocateFastCase(object))
         deallocateSlowCase(object);
 }
@@ -29,12 +29,16 @@
 #include "PerProcess.h"
 #include "SmallLine.h"
 #include "SmallPage.h"
+#include <algorithm>
 #include <thread>
 
 namespace bmalloc {
 
 Heap::Heap(std::lock_guard<StaticMutex>&)
     : m_vmPageSizePhysical(vmPageSizePhysical())
+    , m_physicalFootprint(0)
+    , m_freeSmallPageBytes(0)
+    , m_footprintTarget(0)
     , m_isAllocatingPages(false)
     , m_scavenger(*this, &Heap::concurrentScavenge)
 {
@@ -109,6 +113,12 @@ void Heap::concurrentScavenge()
 
 void Heap::scavenge(std::unique_lock<StaticMutex>& lock, std::chrono::milliseconds sleepDuration)
 {
+    // Above the embedder's footprint target we shorten the back-off so free memory is
+    // decommitted promptly. The back-off must stay non-zero: with no sleep at all the
+    // scavenger can get into a decommit/recommit war with an allocating thread.
+    if (m_footprintTarget && m_physicalFootprint > m_footprintTarget)
+        sleepDuration = std::min(sleepDuration, aggressiveScavengeSleepDuration);
+
     waitUntilFalse(lock, sleepDuration, m_isAllocatingPages);
 
     scavengeSmallPages(lock, sleepDuration);
@@ -121,8 +131,13 @@ void Heap::scavengeSmallPages(std::unique_lock<StaticMutex>& lock, std::chrono::
 {
     for (auto& smallPages : m_smallPages) {
         while (!smallPages.isEmpty()) {
+            if (isUnderFootprintTarget())
+                return;
+
             SmallPage* page = smallPages.pop();
             size_t pageClass = m_pageClasses[page->sizeClass()];
+            m_freeSmallPageBytes -= pageSize(pageClass);
+            m_physicalFootprint -= pageSize(pageClass);
             m_vmHeap.deallocateSmallPage(lock, pageClass, page);
             waitUntilFalse(lock, sleepDuration, m_isAllocatingPages);
         }
@@ -132,10 +147,16 @@ void Heap::scavengeSmallPages(std::unique_lock<StaticMutex>& lock, std::chrono::
 void Heap::scavengeLargeObjects(std::unique_lock<StaticMutex>& lock, std::chrono::milliseconds sleepDuration)
 {
     while (XLargeRange range = m_largeFree.removePhysical()) {
+        if (isUnderFootprintTarget()) {
+            m_largeFree.add(range);
+            return;
+        }
+
+        m_physicalFootprint -= range.physicalSize();
         lock.unlock();
         vmDeallocatePhysicalPagesSloppy(range.begin(), range.size());
         lock.lock();
-        
+
         range.setPhysicalSize(0);
         m_largeFree.add(range);
 
@@ -150,12 +171,15 @@ SmallPage* Heap::allocateSmallPage(std::lock_guard<StaticMutex>& lock, size_t si
 
     SmallPage* page = [&]() {
         size_t pageClass = m_pageClasses[sizeClass];
-        if (!m_smallPages[pageClass].isEmpty())
+        if (!m_smallPages[pageClass].isEmpty()) {
+            m_freeSmallPageBytes -= pageSize(pageClass);
             return m_smallPages[pageClass].pop();
+        }
 
         m_isAllocatingPages = true;
 
         SmallPage* page = m_vmHeap.allocateSmallPage(lock, pageClass);
+        m_physicalFootprint += pageSize(pageClass);
         m_objectTypes.set(Chunk::get(page), ObjectType::Small);
         return page;
     }();
@@ -183,6 +207,7 @@ void Heap::deallocateSmallLine(std::lock_guard<StaticMutex>& lock, Object object
 
     m_smallPagesWithFreeLines[sizeClass].remove(page);
     m_smallPages[pageClass].push(page);
+    m_freeSmallPageBytes += pageSize(pageClass);
 
     m_scavenger.run();
 }
@@ -325,6 +350,7 @@ XLargeRange Heap::splitAndAllocate(XLargeRange& range, size_t alignment, size_t
         m_isAllocatingPages = true;
 
         vmAllocatePhysicalPagesSloppy(range.begin() + range.physicalSize(), range.size() - range.physicalSize());
+        m_physicalFootprint += range.size() - range.physicalSize();
         range.setPhysicalSize(range.size());
     }
     
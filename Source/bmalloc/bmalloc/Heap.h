@@ -66,6 +66,13 @@ public:
 
     void scavenge(std::unique_lock<StaticMutex>&, std::chrono::milliseconds sleepDuration);
 
+    // Soft ceiling (in bytes) on the heap's physical footprint; zero means no ceiling.
+    // Above the ceiling the scavenger decommits free memory without back-off; below it,
+    // free memory stays cached for reuse.
+    void setFootprintTarget(std::lock_guard<StaticMutex>&, size_t bytes) { m_footprintTarget = bytes; }
+    size_t footprint(std::lock_guard<StaticMutex>&) { return m_physicalFootprint; }
+    size_t reclaimableBytes(std::lock_guard<StaticMutex>&) { return m_freeSmallPageBytes + m_largeFree.physicalSize(); }
+
 private:
     struct LargeObjectHash {
         static unsigned hash(void* key)
@@ -99,6 +106,8 @@ private:
     void scavengeSmallPages(std::unique_lock<StaticMutex>&, std::chrono::milliseconds);
     void scavengeLargeObjects(std::unique_lock<StaticMutex>&, std::chrono::milliseconds);
 
+    bool isUnderFootprintTarget() { return m_footprintTarget && m_physicalFootprint <= m_footprintTarget; }
+
     size_t m_vmPageSizePhysical;
     Vector<LineMetadata> m_smallLineMetadata;
     std::array<size_t, sizeClassCount> m_pageClasses;
@@ -111,6 +120,10 @@ private:
 
     Map<Chunk*, ObjectType, ChunkHash> m_objectTypes;
 
+    size_t m_physicalFootprint;
+    size_t m_freeSmallPageBytes;
+    size_t m_footprintTarget;
+
     bool m_isAllocatingPages;
     AsyncTask<Heap, decltype(&Heap::concurrentScavenge)> m_scavenger;
 
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "IsolatedHeap.h"
+#include "VMAllocate.h"
+
+namespace bmalloc {
+
+IsolatedHeap::IsolatedHeap(size_t objectSize)
+    : m_objectSize(roundUpToMultipleOf<alignment>(std::max(objectSize, sizeof(FreeObject))))
+    , m_slabs(nullptr)
+    , m_freeList(nullptr)
+{
+    RELEASE_BASSERT(m_objectSize <= isolatedSlabSize / 8);
+}
+
+IsolatedHeap::Slab* IsolatedHeap::allocateSlab(std::lock_guard<Mutex>&)
+{
+    Slab* slab = static_cast<Slab*>(vmAllocate(isolatedSlabSize, isolatedSlabSize));
+    slab->next = m_slabs;
+    slab->heap = this;
+    slab->objectCount = 0;
+    slab->isDying = false;
+
+    char* objectsBegin = reinterpret_cast<char*>(slab) + roundUpToMultipleOf<alignment>(sizeof(Slab));
+    char* slabEnd = reinterpret_cast<char*>(slab) + isolatedSlabSize;
+    slab->bumpPtr = objectsBegin;
+    slab->bumpRemaining = (slabEnd - objectsBegin) / m_objectSize;
+
+    m_slabs = slab;
+    return slab;
+}
+
+void* IsolatedHeap::allocate()
+{
+    std::lock_guard<Mutex> lock(m_mutex);
+
+    if (FreeObject* object = m_freeList) {
+        m_freeList = object->next;
+        ++slab(object)->objectCount;
+        return object;
+    }
+
+    Slab* bumpSlab = m_slabs;
+    if (!bumpSlab || !bumpSlab->bumpRemaining)
+        bumpSlab = allocateSlab(lock);
+
+    char* object = bumpSlab->bumpPtr;
+    bumpSlab->bumpPtr += m_objectSize;
+    --bumpSlab->bumpRemaining;
+    ++bumpSlab->objectCount;
+    return object;
+}
+
+void IsolatedHeap::deallocate(void* object)
+{
+    if (!object)
+        return;
+
+    std::lock_guard<Mutex> lock(m_mutex);
+
+    BASSERT(slab(object)->heap == this);
+    BASSERT(slab(object)->objectCount);
+    --slab(object)->objectCount;
+
+    FreeObject* freeObject = static_cast<FreeObject*>(object);
+    freeObject->next = m_freeList;
+    m_freeList = freeObject;
+}
+
+void IsolatedHeap::scavenge()
+{
+    std::lock_guard<Mutex> lock(m_mutex);
+
+    // The newest slab stays even when empty because the bump pointer is still
+    // walking through it.
+    Slab* dying = nullptr;
+    Slab** previousNext = m_slabs ? &m_slabs->next : &m_slabs;
+    while (Slab* slab = *previousNext) {
+        if (slab->objectCount) {
+            previousNext = &slab->next;
+            continue;
+        }
+        *previousNext = slab->next;
+        slab->isDying = true;
+        slab->next = dying;
+        dying = slab;
+    }
+
+    if (!dying)
+        return;
+
+    // Drop dying slabs' objects from the free list before unmapping.
+    FreeObject* survivors = nullptr;
+    while (FreeObject* object = m_freeList) {
+        m_freeList = object->next;
+        if (slab(object)->isDying)
+            continue;
+        object->next = survivors;
+        survivors = object;
+    }
+    m_freeList = survivors;
+
+    while (Slab* slab = dying) {
+        dying = slab->next;
+        vmDeallocate(slab, isolatedSlabSize);
+    }
+}
+
+} // namespace bmalloc
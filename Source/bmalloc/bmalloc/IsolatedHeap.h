@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef IsolatedHeap_h
+#define IsolatedHeap_h
+
+#include "BAssert.h"
+#include "Mutex.h"
+#include "Sizes.h"
+#include <mutex>
+
+namespace bmalloc {
+
+// A heap for objects of a single size, kept in dedicated VM ranges that are never
+// shared with the main heap or with other isolated heaps. Use it for type partitioning:
+// a use-after-free in an isolated heap can only alias an object of the same type, and
+// densely packing one type improves traversal locality.
+//
+// Objects come from slab-aligned slabs, so an object's slab is found by masking its
+// address. Allocation bumps through the newest slab and then recycles a free list;
+// scavenge() returns fully-empty slabs to the OS.
+//
+// Thread-safe, but takes a per-heap lock on every operation; it has no per-thread
+// cache. Use it for allocation sites that value isolation and locality over raw
+// allocator throughput.
+
+class IsolatedHeap {
+public:
+    explicit IsolatedHeap(size_t objectSize);
+
+    size_t objectSize() { return m_objectSize; }
+
+    void* allocate();
+    void deallocate(void*);
+
+    void scavenge();
+
+private:
+    struct Slab {
+        Slab* next;
+        IsolatedHeap* heap;
+        unsigned objectCount;
+        bool isDying;
+        char* bumpPtr;
+        unsigned bumpRemaining;
+    };
+
+    struct FreeObject {
+        FreeObject* next;
+    };
+
+    static Slab* slab(void* object)
+    {
+        return reinterpret_cast<Slab*>(
+            reinterpret_cast<uintptr_t>(object) & ~(isolatedSlabSize - 1));
+    }
+
+    Slab* allocateSlab(std::lock_guard<Mutex>&);
+
+    size_t m_objectSize;
+    Mutex m_mutex;
+    Slab* m_slabs;
+    FreeObject* m_freeList;
+};
+
+} // namespace bmalloc
+
+#endif // IsolatedHeap_h
@@ -67,8 +67,14 @@ namespace Sizes {
 
     static const size_t deallocatorLogCapacity = 256;
     static const size_t bumpRangeCacheCapacity = 3;
+
+    static const size_t allocatorAdaptationInterval = 64; // refills between adaptation passes
+    static const size_t allocatorColdEpochThreshold = 2; // idle epochs before a size class is scavenged
+
+    static const size_t isolatedSlabSize = 128 * kB;
     
     static const std::chrono::milliseconds scavengeSleepDuration = std::chrono::milliseconds(512);
+    static const std::chrono::milliseconds aggressiveScavengeSleepDuration = std::chrono::milliseconds(2);
 
     static const size_t maskSizeClassCount = maskSizeClassMax / alignment;
 
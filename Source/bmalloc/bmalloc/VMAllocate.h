@@ -180,6 +180,11 @@ inline void vmDeallocatePhysicalPages(void* p, size_t vmSize)
     vmValidatePhysical(p, vmSize);
 #if BOS(DARWIN)
     SYSCALL(madvise(p, vmSize, MADV_FREE_REUSABLE));
+#elif defined(MADV_FREE)
+    // MADV_FREE reclaims lazily, under memory pressure, so it's much cheaper than
+    // MADV_DONTNEED when the page is reused soon after. We never rely on decommitted
+    // pages reading back as zero.
+    SYSCALL(madvise(p, vmSize, MADV_FREE));
 #else
     SYSCALL(madvise(p, vmSize, MADV_DONTNEED));
 #endif
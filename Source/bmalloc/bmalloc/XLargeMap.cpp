@@ -88,4 +88,12 @@ XLargeRange XLargeMap::removePhysical()
     return m_free.pop(it);
 }
 
+size_t XLargeMap::physicalSize()
+{
+    size_t result = 0;
+    for (auto& range : m_free)
+        result += range.physicalSize();
+    return result;
+}
+
 } // namespace bmalloc
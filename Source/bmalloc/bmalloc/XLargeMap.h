@@ -38,6 +38,8 @@ public:
     XLargeRange remove(size_t alignment, size_t);
     XLargeRange removePhysical();
 
+    size_t physicalSize();
+
 private:
     Vector<XLargeRange> m_free;
 };
@@ -25,12 +25,15 @@
 
 #include "Cache.h"
 #include "Heap.h"
+#include "IsolatedHeap.h"
 #include "PerProcess.h"
 #include "StaticMutex.h"
 
 namespace bmalloc {
 namespace api {
 
+using bmalloc::IsolatedHeap;
+
 // Returns null on failure.
 inline void* tryMalloc(size_t size)
 {
@@ -65,6 +68,12 @@ inline void scavengeThisThread()
     Cache::scavenge();
 }
 
+// Dumps this thread's per-size-class cache telemetry to stderr.
+inline void dumpStatsForThisThread()
+{
+    Cache::dumpStats();
+}
+
 inline void scavenge()
 {
     scavengeThisThread();
@@ -73,5 +82,31 @@ inline void scavenge()
     PerProcess<Heap>::get()->scavenge(lock, std::chrono::milliseconds(0));
 }
 
+// Sets a soft ceiling (in bytes) on the heap's physical footprint; zero clears it.
+// Above the ceiling the background scavenger decommits free memory without backing
+// off; below it, free memory stays cached for reuse.
+inline void setFootprintTarget(size_t bytes)
+{
+    Heap* heap = PerProcess<Heap>::get();
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    heap->setFootprintTarget(lock, bytes);
+}
+
+// An estimate of the heap's committed physical memory.
+inline size_t footprint()
+{
+    Heap* heap = PerProcess<Heap>::get();
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    return heap->footprint(lock);
+}
+
+// Bytes of free memory the scavenger could return to the OS right now.
+inline size_t reclaimableBytes()
+{
+    Heap* heap = PerProcess<Heap>::get();
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    return heap->reclaimableBytes(lock);
+}
+
 } // namespace api
 } // namespace bmalloc
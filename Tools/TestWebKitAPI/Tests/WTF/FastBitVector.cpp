@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2016 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <wtf/FastBitVector.h>
+#include <wtf/Vector.h>
+
+namespace TestWebKitAPI {
+
+TEST(WTF_FastBitVector, ForEachSetBit)
+{
+    const size_t size = 100;
+    Vector<size_t> setBits = { 0, 1, 31, 32, 33, 63, 64, 65, 99 };
+
+    FastBitVector vector;
+    vector.resize(size);
+    for (size_t bit : setBits)
+        vector.set(bit);
+
+    Vector<size_t> visitedBits;
+    vector.forEachSetBit([&](size_t bit) {
+        visitedBits.append(bit);
+    });
+
+    EXPECT_EQ(setBits.size(), visitedBits.size());
+    for (size_t i = 0; i < setBits.size(); ++i)
+        EXPECT_EQ(setBits[i], visitedBits[i]);
+}
+
+TEST(WTF_FastBitVector, ForEachSetBitEmpty)
+{
+    FastBitVector vector;
+    vector.resize(100);
+
+    unsigned count = 0;
+    vector.forEachSetBit([&](size_t) {
+        count++;
+    });
+    EXPECT_EQ(0u, count);
+}
+
+TEST(WTF_FastBitVector, FindNextSetBit)
+{
+    const size_t size = 100;
+
+    FastBitVector vector;
+    vector.resize(size);
+
+    EXPECT_EQ(size, vector.findNextSetBit(0));
+
+    vector.set(3);
+    vector.set(32);
+    vector.set(97);
+
+    EXPECT_EQ(static_cast<size_t>(3), vector.findNextSetBit(0));
+    EXPECT_EQ(static_cast<size_t>(3), vector.findNextSetBit(3));
+    EXPECT_EQ(static_cast<size_t>(32), vector.findNextSetBit(4));
+    EXPECT_EQ(static_cast<size_t>(32), vector.findNextSetBit(31));
+    EXPECT_EQ(static_cast<size_t>(97), vector.findNextSetBit(33));
+    EXPECT_EQ(size, vector.findNextSetBit(98));
+    EXPECT_EQ(size, vector.findNextSetBit(size));
+    EXPECT_EQ(size, vector.findNextSetBit(size + 1));
+}
+
+TEST(WTF_FastBitVector, FindNextSetBitAfterSetAll)
+{
+    const size_t size = 33;
+
+    FastBitVector vector;
+    vector.resize(size);
+    vector.setAll();
+
+    // The padding bits in the last word are set by setAll(); make sure they are
+    // not reported as valid indices.
+    EXPECT_EQ(static_cast<size_t>(32), vector.findNextSetBit(32));
+    EXPECT_EQ(size, vector.findNextSetBit(33));
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/MPSCQueue.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+
+using namespace WTF;
+
+namespace TestWebKitAPI {
+
+TEST(WTF_MPSCQueue, SingleThreadFIFO)
+{
+    MPSCQueue<unsigned> queue;
+    EXPECT_TRUE(queue.isEmpty());
+
+    for (unsigned i = 0; i < 100; ++i)
+        queue.append(1000 + i);
+
+    EXPECT_FALSE(queue.isEmpty());
+
+    unsigned value;
+    for (unsigned i = 0; i < 100; ++i) {
+        EXPECT_TRUE(queue.tryTake(value));
+        EXPECT_EQ(1000 + i, value);
+    }
+
+    EXPECT_FALSE(queue.tryTake(value));
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(WTF_MPSCQueue, AppendReportsEmptiness)
+{
+    MPSCQueue<unsigned> queue;
+
+    EXPECT_TRUE(queue.append(1));
+    EXPECT_FALSE(queue.append(2));
+
+    unsigned value;
+    EXPECT_TRUE(queue.tryTake(value));
+    EXPECT_EQ(1u, value);
+    EXPECT_TRUE(queue.tryTake(value));
+    EXPECT_EQ(2u, value);
+
+    // Once the backlog is drained the next producer sees an empty queue again.
+    EXPECT_TRUE(queue.append(3));
+    EXPECT_TRUE(queue.tryTake(value));
+    EXPECT_EQ(3u, value);
+}
+
+TEST(WTF_MPSCQueue, ManyProducers)
+{
+    const unsigned numProducers = 8;
+    const unsigned itemsPerProducer = 10000;
+
+    MPSCQueue<uint64_t> queue;
+    Vector<ThreadIdentifier> threads;
+
+    for (unsigned producer = 0; producer < numProducers; ++producer) {
+        threads.append(createThread("MPSCQueue test producer", [&queue, producer] {
+            for (unsigned i = 0; i < itemsPerProducer; ++i)
+                queue.append((static_cast<uint64_t>(producer) << 32) | i);
+        }));
+    }
+
+    // Consume concurrently with the producers. Items from different producers interleave
+    // arbitrarily, but each producer's own items have to come out in production order.
+    Vector<unsigned> nextExpected(numProducers, 0);
+    unsigned itemsReceived = 0;
+    while (itemsReceived < numProducers * itemsPerProducer) {
+        uint64_t value;
+        if (!queue.tryTake(value))
+            continue;
+        unsigned producer = static_cast<unsigned>(value >> 32);
+        unsigned sequence = static_cast<unsigned>(value);
+        EXPECT_EQ(nextExpected[producer], sequence);
+        nextExpected[producer] = sequence + 1;
+        itemsReceived++;
+    }
+
+    for (auto thread : threads)
+        waitForThreadCompletion(thread);
+
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2016 Igalia S.L.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND ITS CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR ITS
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <wtf/TinyPtrSet.h>
+
+namespace TestWebKitAPI {
+
+struct TestObject { };
+
+// TinyPtrSet steals the low bits of the pointer for flags, so test values
+// need to be suitably aligned. Never dereferenced.
+static TestObject* fakePointer(uintptr_t value)
+{
+    return reinterpret_cast<TestObject*>(value * 8);
+}
+
+TEST(WTF_TinyPtrSet, ThinToFatTransition)
+{
+    TinyPtrSet<TestObject*> set;
+    EXPECT_TRUE(set.isEmpty());
+
+    EXPECT_TRUE(set.add(fakePointer(1)));
+    EXPECT_FALSE(set.add(fakePointer(1)));
+    EXPECT_EQ(static_cast<size_t>(1), set.size());
+    EXPECT_EQ(fakePointer(1), set.onlyEntry());
+
+    for (uintptr_t i = 2; i <= 10; ++i)
+        EXPECT_TRUE(set.add(fakePointer(i)));
+    EXPECT_EQ(static_cast<size_t>(10), set.size());
+    for (uintptr_t i = 1; i <= 10; ++i)
+        EXPECT_TRUE(set.contains(fakePointer(i)));
+    EXPECT_FALSE(set.contains(fakePointer(11)));
+}
+
+TEST(WTF_TinyPtrSet, RemoveToEmpty)
+{
+    TinyPtrSet<TestObject*> set;
+    for (uintptr_t i = 1; i <= 4; ++i)
+        set.add(fakePointer(i));
+
+    EXPECT_FALSE(set.remove(fakePointer(5)));
+    for (uintptr_t i = 1; i <= 4; ++i)
+        EXPECT_TRUE(set.remove(fakePointer(i)));
+    EXPECT_TRUE(set.isEmpty());
+}
+
+TEST(WTF_TinyPtrSet, CopyIsIndependentOfOriginal)
+{
+    TinyPtrSet<TestObject*> original;
+    for (uintptr_t i = 1; i <= 8; ++i)
+        original.add(fakePointer(i));
+
+    TinyPtrSet<TestObject*> copy(original);
+    EXPECT_TRUE(copy == original);
+
+    // Mutating the original must not be visible through the copy, even though
+    // the out-of-line storage starts out shared.
+    EXPECT_TRUE(original.remove(fakePointer(3)));
+    EXPECT_TRUE(copy.contains(fakePointer(3)));
+    EXPECT_EQ(static_cast<size_t>(8), copy.size());
+    EXPECT_EQ(static_cast<size_t>(7), original.size());
+
+    // And vice versa.
+    EXPECT_TRUE(copy.add(fakePointer(9)));
+    EXPECT_FALSE(original.contains(fakePointer(9)));
+}
+
+TEST(WTF_TinyPtrSet, AssignmentOverwrites)
+{
+    TinyPtrSet<TestObject*> first;
+    for (uintptr_t i = 1; i <= 8; ++i)
+        first.add(fakePointer(i));
+
+    TinyPtrSet<TestObject*> second;
+    second.add(fakePointer(100));
+
+    second = first;
+    EXPECT_TRUE(second == first);
+    EXPECT_FALSE(second.contains(fakePointer(100)));
+
+    first.clear();
+    EXPECT_TRUE(first.isEmpty());
+    EXPECT_EQ(static_cast<size_t>(8), second.size());
+}
+
+TEST(WTF_TinyPtrSet, MergeAndFilter)
+{
+    TinyPtrSet<TestObject*> a;
+    TinyPtrSet<TestObject*> b;
+    for (uintptr_t i = 1; i <= 6; ++i)
+        a.add(fakePointer(i));
+    for (uintptr_t i = 4; i <= 9; ++i)
+        b.add(fakePointer(i));
+
+    TinyPtrSet<TestObject*> merged(a);
+    EXPECT_TRUE(merged.merge(b));
+    EXPECT_EQ(static_cast<size_t>(9), merged.size());
+    EXPECT_FALSE(merged.merge(b));
+
+    TinyPtrSet<TestObject*> intersection(a);
+    intersection.filter(b);
+    EXPECT_EQ(static_cast<size_t>(3), intersection.size());
+    for (uintptr_t i = 4; i <= 6; ++i)
+        EXPECT_TRUE(intersection.contains(fakePointer(i)));
+
+    // Filtering through a shared list must leave the other sharer alone.
+    EXPECT_EQ(static_cast<size_t>(6), a.size());
+
+    TinyPtrSet<TestObject*> difference(a);
+    difference.exclude(b);
+    EXPECT_EQ(static_cast<size_t>(3), difference.size());
+    for (uintptr_t i = 1; i <= 3; ++i)
+        EXPECT_TRUE(difference.contains(fakePointer(i)));
+}
+
+TEST(WTF_TinyPtrSet, SubsetAndOverlap)
+{
+    TinyPtrSet<TestObject*> small;
+    TinyPtrSet<TestObject*> large;
+    for (uintptr_t i = 1; i <= 3; ++i)
+        small.add(fakePointer(i));
+    for (uintptr_t i = 1; i <= 6; ++i)
+        large.add(fakePointer(i));
+
+    EXPECT_TRUE(small.isSubsetOf(large));
+    EXPECT_FALSE(large.isSubsetOf(small));
+    EXPECT_TRUE(large.isSupersetOf(small));
+    EXPECT_TRUE(small.overlaps(large));
+
+    TinyPtrSet<TestObject*> disjoint;
+    disjoint.add(fakePointer(100));
+    EXPECT_FALSE(disjoint.overlaps(large));
+}
+
+} // namespace TestWebKitAPI
@@ -614,4 +614,21 @@ TEST(WTF_Vector, RemoveAllMatching)
     EXPECT_TRUE(v.isEmpty());
 }
 
+TEST(WTF_Vector, AppendVectorRValue)
+{
+    Vector<MoveOnly> a;
+    Vector<MoveOnly> b;
+    a.append(MoveOnly(100));
+    for (unsigned i = 0; i < 5; ++i)
+        b.append(MoveOnly(i));
+
+    a.appendVector(WTFMove(b));
+
+    EXPECT_EQ(6U, a.size());
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_EQ(100U, a[0].value());
+    for (unsigned i = 0; i < 5; ++i)
+        EXPECT_EQ(i, a[i + 1].value());
+}
+
 } // namespace TestWebKitAPI